@@ -0,0 +1,63 @@
+# Copyright (c) 2024 The STE||AR-Group
+#
+# SPDX-License-Identifier: BSL-1.0
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# compatibility with older CMake versions
+if(ZSTD_ROOT AND NOT Zstd_ROOT)
+  set(Zstd_ROOT
+      ${ZSTD_ROOT}
+      CACHE PATH "Zstd base directory"
+  )
+  unset(ZSTD_ROOT CACHE)
+endif()
+
+find_package(PkgConfig QUIET)
+pkg_check_modules(PC_Zstd QUIET libzstd)
+
+find_path(
+  Zstd_INCLUDE_DIR zstd.h
+  HINTS ${Zstd_ROOT}
+        ENV
+        ZSTD_ROOT
+        ${PC_Zstd_MINIMAL_INCLUDEDIR}
+        ${PC_Zstd_MINIMAL_INCLUDE_DIRS}
+        ${PC_Zstd_INCLUDEDIR}
+        ${PC_Zstd_INCLUDE_DIRS}
+  PATH_SUFFIXES include
+)
+
+find_library(
+  Zstd_LIBRARY
+  NAMES zstd libzstd
+  HINTS ${Zstd_ROOT}
+        ENV
+        ZSTD_ROOT
+        ${PC_Zstd_MINIMAL_LIBDIR}
+        ${PC_Zstd_MINIMAL_LIBRARY_DIRS}
+        ${PC_Zstd_LIBDIR}
+        ${PC_Zstd_LIBRARY_DIRS}
+  PATH_SUFFIXES lib lib64
+)
+
+set(Zstd_LIBRARIES ${Zstd_LIBRARY})
+set(Zstd_INCLUDE_DIRS ${Zstd_INCLUDE_DIR})
+
+find_package_handle_standard_args(
+  Zstd DEFAULT_MSG Zstd_LIBRARY Zstd_INCLUDE_DIR
+)
+
+get_property(
+  _type
+  CACHE Zstd_ROOT
+  PROPERTY TYPE
+)
+if(_type)
+  set_property(CACHE Zstd_ROOT PROPERTY ADVANCED 1)
+  if("x${_type}" STREQUAL "xUNINITIALIZED")
+    set_property(CACHE Zstd_ROOT PROPERTY TYPE PATH)
+  endif()
+endif()
+
+mark_as_advanced(Zstd_ROOT Zstd_LIBRARY Zstd_INCLUDE_DIR)
@@ -0,0 +1,92 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/binary_filter/adaptive_serialization_filter_registration.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+#include <hpx/modules/serialization.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    /// A serialization filter compressing the archive data in separate
+    /// frames using LZ4 or zstd. Large chunks of data (which would otherwise
+    /// be sent as zero-copy chunks) are compressed separately, all other data
+    /// is compressed in between those. The codec is selected for each frame:
+    /// the compressibility of large frames is estimated from a sample first,
+    /// incompressible chunks are sent as zero-copy chunks, other
+    /// incompressible frames are stored uncompressed.
+    struct HPX_LIBRARY_EXPORT adaptive_serialization_filter
+      : public serialization::binary_filter
+    {
+        adaptive_serialization_filter(bool compress = false,
+            serialization::binary_filter* next_filter = nullptr) noexcept
+          : current_(0)
+          , next_chunk_(0)
+          , compress_(compress)
+        {
+        }
+
+        void load(void* dst, std::size_t dst_count) override;
+        bool load_chunk(void* dst, std::size_t dst_count) override;
+        void save(void const* src, std::size_t src_count) override;
+        bool save_chunk(void const* src, std::size_t src_count) override;
+        bool flush(
+            void* dst, std::size_t dst_count, std::size_t& written) override;
+
+        void set_max_length(std::size_t size) override;
+        std::size_t init_data(void const* buffer, std::size_t size,
+            std::size_t buffer_size) override;
+
+    private:
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        HPX_FORCEINLINE void serialize(Archive& ar, const unsigned int)
+        {
+        }
+
+        HPX_SERIALIZATION_POLYMORPHIC(adaptive_serialization_filter, override);
+
+        // A range of data compressed separately. The data is either stored
+        // in buffer_ (chunk_ is nullptr) or is a chunk referenced by the
+        // archive. Chunks which are sent as zero-copy chunks are recorded as
+        // well (skipped_ is true).
+        struct frame
+        {
+            char const* chunk_;
+            std::size_t offset_;
+            std::size_t size_;
+            bool skipped_;
+        };
+
+        std::vector<char> buffer_;
+        std::vector<frame> frames_;
+
+        // positions of the zero-copy chunks in the decompressed data
+        std::vector<std::size_t> chunks_;
+
+        // used for estimating the compressibility of data
+        std::vector<char> scratch_;
+
+        std::size_t current_;
+        std::size_t next_chunk_;
+        bool compress_;
+    };
+}    // namespace hpx::plugins::compression
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
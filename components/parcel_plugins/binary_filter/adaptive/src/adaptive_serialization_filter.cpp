@@ -0,0 +1,573 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/binary_filter/adaptive_serialization_filter.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(HPX_COMPRESSION_ADAPTIVE_HAVE_LZ4)
+#include <lz4.h>
+#endif
+#if defined(HPX_COMPRESSION_ADAPTIVE_HAVE_ZSTD)
+#include <zstd.h>
+#endif
+
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.adaptive_serialization_filter]
+    //      ...
+    //      codec = auto
+    //      zstd_level = 3
+    //      zstd_threshold = 65536
+    //      min_size = 256
+    //      sample_size = 4096
+    //      incompressible_ratio = 90
+    //
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::adaptive_serialization_filter>
+    {
+        static constexpr char const* call() noexcept
+        {
+            return "codec = auto\n"
+                   "zstd_level = 3\n"
+                   "zstd_threshold = 65536\n"
+                   "min_size = 256\n"
+                   "sample_size = 4096\n"
+                   "incompressible_ratio = 90";
+        }
+    };
+}    // namespace hpx::traits
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::adaptive_serialization_filter,
+    adaptive_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace detail {
+
+        // the codec used for a frame, this is stored in the frame header
+        enum class codec : std::uint8_t
+        {
+            none = 0,
+            lz4 = 1,
+            zstd = 2,
+            skipped = 3    // the data was sent as a zero-copy chunk
+        };
+
+#if defined(HPX_COMPRESSION_ADAPTIVE_HAVE_LZ4)
+        inline constexpr bool have_lz4 = true;
+#else
+        inline constexpr bool have_lz4 = false;
+#endif
+#if defined(HPX_COMPRESSION_ADAPTIVE_HAVE_ZSTD)
+        inline constexpr bool have_zstd = true;
+#else
+        inline constexpr bool have_zstd = false;
+#endif
+
+        // each frame starts with the codec, the size of the data, and the
+        // size of the stored data
+        inline constexpr std::size_t frame_header_size =
+            1 + 2 * sizeof(std::uint64_t);
+
+        // larger ranges of data are split into several frames
+        inline constexpr std::size_t max_frame_size =
+            static_cast<std::size_t>(1) << 26;
+
+        // the number of slices sampled to estimate the compressibility
+        inline constexpr std::size_t num_sample_slices = 4;
+
+        ///////////////////////////////////////////////////////////////////////
+        struct settings
+        {
+            settings()
+              : adaptive_(true)
+              , codec_(have_zstd ? codec::zstd : codec::lz4)
+              , zstd_level_(util::from_string<int>(get_config_entry(
+                    "hpx.plugins.adaptive_serialization_filter.zstd_level",
+                    3)))
+              , zstd_threshold_(util::from_string<std::size_t>(
+                    get_config_entry("hpx.plugins.adaptive_serialization_"
+                                     "filter.zstd_threshold",
+                        65536)))
+              , min_size_(util::from_string<std::size_t>(get_config_entry(
+                    "hpx.plugins.adaptive_serialization_filter.min_size",
+                    256)))
+              , sample_size_(util::from_string<std::size_t>(get_config_entry(
+                    "hpx.plugins.adaptive_serialization_filter.sample_size",
+                    4096)))
+              , incompressible_ratio_(
+                    util::from_string<std::size_t>(get_config_entry(
+                        "hpx.plugins.adaptive_serialization_filter."
+                        "incompressible_ratio",
+                        90)))
+            {
+                // a codec which is not available selects the codecs
+                // adaptively
+                std::string const value = get_config_entry(
+                    "hpx.plugins.adaptive_serialization_filter.codec", "auto");
+                if (value == "lz4" && have_lz4)
+                {
+                    adaptive_ = false;
+                    codec_ = codec::lz4;
+                }
+                else if (value == "zstd" && have_zstd)
+                {
+                    adaptive_ = false;
+                    codec_ = codec::zstd;
+                }
+            }
+
+            bool adaptive_;
+            codec codec_;
+            int zstd_level_;
+            std::size_t zstd_threshold_;
+            std::size_t min_size_;
+            std::size_t sample_size_;
+            std::size_t incompressible_ratio_;
+        };
+
+        settings const& get_settings()
+        {
+            static settings const s;
+            return s;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::size_t compress_bound(codec c, std::size_t size) noexcept
+        {
+            switch (c)
+            {
+#if defined(HPX_COMPRESSION_ADAPTIVE_HAVE_LZ4)
+            case codec::lz4:
+                return static_cast<std::size_t>(
+                    LZ4_compressBound(static_cast<int>(size)));
+#endif
+#if defined(HPX_COMPRESSION_ADAPTIVE_HAVE_ZSTD)
+            case codec::zstd:
+                return ZSTD_compressBound(size);
+#endif
+            default:
+                break;
+            }
+            return size;
+        }
+
+        // the space needed to store the given data with any of the codecs
+        std::size_t max_stored_size(std::size_t size) noexcept
+        {
+            return (std::max)(compress_bound(codec::lz4, size),
+                compress_bound(codec::zstd, size));
+        }
+
+        // returns the size of the compressed data, zero on failure
+        std::size_t compress(codec c, [[maybe_unused]] int level,
+            [[maybe_unused]] char const* src, [[maybe_unused]] std::size_t size,
+            [[maybe_unused]] char* dst,
+            [[maybe_unused]] std::size_t dst_count) noexcept
+        {
+            switch (c)
+            {
+#if defined(HPX_COMPRESSION_ADAPTIVE_HAVE_LZ4)
+            case codec::lz4:
+            {
+                int const compressed = LZ4_compress_default(src, dst,
+                    static_cast<int>(size),
+                    static_cast<int>((std::min)(
+                        dst_count, static_cast<std::size_t>(INT_MAX))));
+                return compressed > 0 ? static_cast<std::size_t>(compressed) :
+                                        0;
+            }
+#endif
+#if defined(HPX_COMPRESSION_ADAPTIVE_HAVE_ZSTD)
+            case codec::zstd:
+            {
+                std::size_t const compressed =
+                    ZSTD_compress(dst, dst_count, src, size, level);
+                return ZSTD_isError(compressed) ? 0 : compressed;
+            }
+#endif
+            default:
+                break;
+            }
+            return 0;
+        }
+
+        void decompress(codec c, char const* src, std::size_t size, char* dst,
+            std::size_t dst_count)
+        {
+            bool success = false;
+            switch (c)
+            {
+            case codec::none:
+                success = size == dst_count;
+                if (success)
+                {
+                    std::memcpy(dst, src, size);
+                }
+                break;
+
+#if defined(HPX_COMPRESSION_ADAPTIVE_HAVE_LZ4)
+            case codec::lz4:
+            {
+                int const decompressed = LZ4_decompress_safe(src, dst,
+                    static_cast<int>(size), static_cast<int>(dst_count));
+                success = decompressed >= 0 &&
+                    static_cast<std::size_t>(decompressed) == dst_count;
+                break;
+            }
+#endif
+#if defined(HPX_COMPRESSION_ADAPTIVE_HAVE_ZSTD)
+            case codec::zstd:
+            {
+                std::size_t const decompressed =
+                    ZSTD_decompress(dst, dst_count, src, size);
+                success = !ZSTD_isError(decompressed) &&
+                    decompressed == dst_count;
+                break;
+            }
+#endif
+            default:
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "adaptive_serialization_filter::init_data",
+                    "unsupported compression codec: {}",
+                    static_cast<int>(c));
+            }
+
+            if (!success)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "adaptive_serialization_filter::init_data",
+                    "decompression failure, corrupted archive data");
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Estimate whether the given data is compressible by compressing a
+        // couple of slices spread over the data with the fastest codec.
+        bool is_compressible(settings const& s, char const* data,
+            std::size_t size, std::vector<char>& scratch)
+        {
+            std::size_t const slice = s.sample_size_ / num_sample_slices;
+            if (slice == 0 || size <= s.sample_size_)
+            {
+                return true;
+            }
+
+            std::size_t const sample = slice * num_sample_slices;
+            std::size_t const stride = (size - slice) / (num_sample_slices - 1);
+
+            constexpr codec c = have_lz4 ? codec::lz4 : codec::zstd;
+            std::size_t const bound = compress_bound(c, sample);
+
+            scratch.resize(sample + bound);
+            for (std::size_t i = 0; i != num_sample_slices; ++i)
+            {
+                std::memcpy(&scratch[i * slice], data + i * stride, slice);
+            }
+
+            std::size_t const compressed =
+                compress(c, 1, scratch.data(), sample, &scratch[sample], bound);
+            return compressed != 0 &&
+                compressed * 100 < sample * s.incompressible_ratio_;
+        }
+
+        // Select the codec for the given data, codec::none if the data
+        // should be stored uncompressed.
+        codec select_codec(settings const& s, char const* data,
+            std::size_t size, bool sample, std::vector<char>& scratch)
+        {
+            if (size < s.min_size_ ||
+                (sample && !is_compressible(s, data, size, scratch)))
+            {
+                return codec::none;
+            }
+
+            if (!s.adaptive_)
+            {
+                return s.codec_;
+            }
+
+            // larger frames are compressed using zstd which achieves better
+            // compression ratios, smaller ones using the faster LZ4
+            if (have_zstd && (!have_lz4 || size >= s.zstd_threshold_))
+            {
+                return codec::zstd;
+            }
+            return codec::lz4;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void write_header(
+            char* dst, codec c, std::uint64_t size, std::uint64_t stored)
+        {
+            dst[0] = static_cast<char>(c);
+            for (std::size_t i = 0; i != sizeof(std::uint64_t); ++i)
+            {
+                dst[1 + i] = static_cast<char>(size >> (8 * i));
+                dst[1 + sizeof(std::uint64_t) + i] =
+                    static_cast<char>(stored >> (8 * i));
+            }
+        }
+
+        std::uint64_t read_size(char const* src) noexcept
+        {
+            std::uint64_t size = 0;
+            for (std::size_t i = 0; i != sizeof(std::uint64_t); ++i)
+            {
+                size |= static_cast<std::uint64_t>(
+                            static_cast<unsigned char>(src[i]))
+                    << (8 * i);
+            }
+            return size;
+        }
+
+        // Call the given function for each frame to write, larger frames
+        // are split.
+        template <typename Frames, typename F>
+        void for_each_frame(Frames const& frames, char const* buffer, F&& f)
+        {
+            for (auto const& frame : frames)
+            {
+                char const* data = frame.chunk_ != nullptr ?
+                    frame.chunk_ :
+                    buffer + frame.offset_;
+
+                if (frame.skipped_)
+                {
+                    f(data, frame.size_, true, false);
+                    continue;
+                }
+
+                // chunks have already been sampled
+                bool const sample = frame.chunk_ == nullptr;
+                for (std::size_t pos = 0; pos != frame.size_; /**/)
+                {
+                    std::size_t const size =
+                        (std::min)(frame.size_ - pos, max_frame_size);
+                    f(data + pos, size, false, sample);
+                    pos += size;
+                }
+            }
+        }
+    }    // namespace detail
+
+    void adaptive_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t adaptive_serialization_filter::init_data(
+        void const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        char const* src = static_cast<char const*>(buffer);
+        char const* const end = src + size;
+
+        buffer_.resize(buffer_size);
+        chunks_.clear();
+
+        std::size_t pos = 0;
+        while (src != end)
+        {
+            if (static_cast<std::size_t>(end - src) < detail::frame_header_size)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "adaptive_serialization_filter::init_data",
+                    "archive data bstream is too short");
+            }
+
+            auto const c = static_cast<detail::codec>(src[0]);
+            auto const frame_size =
+                static_cast<std::size_t>(detail::read_size(src + 1));
+            auto const stored = static_cast<std::size_t>(
+                detail::read_size(src + 1 + sizeof(std::uint64_t)));
+            src += detail::frame_header_size;
+
+            if (c == detail::codec::skipped)
+            {
+                // the data was sent as a zero-copy chunk
+                chunks_.push_back(pos);
+                continue;
+            }
+
+            if (stored > static_cast<std::size_t>(end - src) ||
+                frame_size > buffer_.size() - pos)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "adaptive_serialization_filter::init_data",
+                    "archive data bstream is too short");
+            }
+
+            detail::decompress(c, src, stored, &buffer_[pos], frame_size);
+
+            src += stored;
+            pos += frame_size;
+        }
+
+        buffer_.resize(pos);
+        current_ = 0;
+        next_chunk_ = 0;
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_ + dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "adaptive_serialization_filter::load",
+                "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    bool adaptive_serialization_filter::load_chunk(
+        void* dst, std::size_t dst_count)
+    {
+        // chunks sent as zero-copy chunks are not part of the compressed data
+        if (next_chunk_ != chunks_.size() && chunks_[next_chunk_] == current_)
+        {
+            ++next_chunk_;
+            return false;
+        }
+
+        load(dst, dst_count);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_serialization_filter::save(
+        void const* src, std::size_t src_count)
+    {
+        if (frames_.empty() || frames_.back().chunk_ != nullptr)
+        {
+            frames_.push_back(frame{nullptr, buffer_.size(), 0, false});
+        }
+        frames_.back().size_ += src_count;
+
+        char const* src_begin = static_cast<char const*>(src);
+        buffer_.insert(buffer_.end(), src_begin, src_begin + src_count);
+    }
+
+    bool adaptive_serialization_filter::save_chunk(
+        void const* src, std::size_t src_count)
+    {
+        // incompressible chunks are sent as zero-copy chunks, this is
+        // recorded to allow for the receiving end to tell them apart
+        char const* chunk = static_cast<char const*>(src);
+        bool const skipped = !detail::is_compressible(
+            detail::get_settings(), chunk, src_count, scratch_);
+
+        frames_.push_back(frame{chunk, 0, src_count, skipped});
+        return !skipped;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool adaptive_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        // make sure we have enough memory
+        std::size_t needed = 0;
+        detail::for_each_frame(frames_, buffer_.data(),
+            [&](char const*, std::size_t size, bool skipped, bool) {
+                needed += detail::frame_header_size;
+                if (!skipped)
+                {
+                    needed += detail::max_stored_size(size);
+                }
+            });
+
+        if (needed > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        // compress each frame separately
+        detail::settings const& s = detail::get_settings();
+
+        char* const dst_begin = static_cast<char*>(dst);
+        char* const dst_end = dst_begin + dst_count;
+        char* current = dst_begin;
+
+        detail::for_each_frame(frames_, buffer_.data(),
+            [&](char const* data, std::size_t size, bool skipped,
+                bool sample) {
+                char* const frame_data = current + detail::frame_header_size;
+
+                if (skipped)
+                {
+                    detail::write_header(
+                        current, detail::codec::skipped, size, 0);
+                    current = frame_data;
+                    return;
+                }
+
+                detail::codec c =
+                    detail::select_codec(s, data, size, sample, scratch_);
+
+                std::size_t stored = 0;
+                if (c != detail::codec::none)
+                {
+                    stored = detail::compress(c, s.zstd_level_, data, size,
+                        frame_data,
+                        static_cast<std::size_t>(dst_end - frame_data));
+
+                    // store the data uncompressed if compressing it does not
+                    // pay off
+                    if (stored == 0 ||
+                        stored * 100 >= size * s.incompressible_ratio_)
+                    {
+                        c = detail::codec::none;
+                    }
+                }
+
+                if (c == detail::codec::none)
+                {
+                    std::memcpy(frame_data, data, size);
+                    stored = size;
+                }
+
+                detail::write_header(current, c, size, stored);
+                current = frame_data + stored;
+            });
+
+        written = static_cast<std::size_t>(current - dst_begin);
+        return true;
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
@@ -0,0 +1,187 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that data compressed by the adaptive serialization filter is restored
+// correctly and that incompressible chunks are still sent as zero-copy chunks.
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+#include <hpx/include/compression_adaptive.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using hpx::serialization::serialization_chunk;
+
+constexpr std::size_t zero_copy_threshold = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+struct archive_data
+{
+    std::vector<char> buffer_;
+    std::vector<serialization_chunk> chunks_;
+    std::size_t size_ = 0;
+
+    std::size_t num_pointer_chunks() const
+    {
+        std::size_t result = 0;
+        for (serialization_chunk const& c : chunks_)
+        {
+            if (c.type_ == hpx::serialization::chunk_type::chunk_type_pointer)
+            {
+                ++result;
+            }
+        }
+        return result;
+    }
+};
+
+template <typename... Ts>
+archive_data save(Ts const&... ts)
+{
+    archive_data data;
+
+    hpx::plugins::compression::adaptive_serialization_filter filter(true);
+    {
+        hpx::serialization::output_archive archive(data.buffer_,
+            hpx::serialization::archive_flags::enable_compression,
+            &data.chunks_, &filter, zero_copy_threshold);
+
+        (archive << ... << ts);
+
+        archive.flush();
+        data.size_ = archive.bytes_written();
+    }
+    return data;
+}
+
+template <typename... Ts>
+void load(archive_data& data, Ts&... ts)
+{
+    hpx::serialization::input_archive archive(
+        data.buffer_, data.size_, &data.chunks_);
+
+    (archive >> ... >> ts);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint64_t> random_data(std::size_t size)
+{
+    std::mt19937_64 gen(size);
+
+    std::vector<std::uint64_t> data(size);
+    for (std::uint64_t& v : data)
+    {
+        v = gen();
+    }
+    return data;
+}
+
+std::vector<std::uint64_t> sparse_data(std::size_t size)
+{
+    std::vector<std::uint64_t> data(size, 0);
+    for (std::size_t i = 0; i < size; i += 97)
+    {
+        data[i] = i;
+    }
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_small_data()
+{
+    std::string const s1("the quick brown fox jumps over the lazy dog");
+    std::vector<int> const v1(64, 42);
+
+    archive_data data = save(s1, v1);
+    HPX_TEST_EQ(data.num_pointer_chunks(), static_cast<std::size_t>(0));
+
+    std::string s2;
+    std::vector<int> v2;
+    load(data, s2, v2);
+
+    HPX_TEST_EQ(s1, s2);
+    HPX_TEST(v1 == v2);
+}
+
+// compressible chunks are compressed as part of the archive data
+void test_sparse_chunk()
+{
+    std::vector<std::uint64_t> const v1 = sparse_data(64 * 1024);
+
+    archive_data data = save(v1);
+    HPX_TEST_EQ(data.num_pointer_chunks(), static_cast<std::size_t>(0));
+    HPX_TEST_LT(data.buffer_.size(), v1.size() * sizeof(std::uint64_t) / 4);
+
+    std::vector<std::uint64_t> v2;
+    load(data, v2);
+
+    HPX_TEST(v1 == v2);
+}
+
+// incompressible chunks are not copied, they are still sent separately
+void test_random_chunk()
+{
+    std::vector<std::uint64_t> const v1 = random_data(64 * 1024);
+
+    archive_data data = save(v1);
+    HPX_TEST_EQ(data.num_pointer_chunks(), static_cast<std::size_t>(1));
+    HPX_TEST_LT(data.buffer_.size(), zero_copy_threshold);
+
+    std::vector<std::uint64_t> v2;
+    load(data, v2);
+
+    HPX_TEST(v1 == v2);
+}
+
+// the receiving side has to tell compressed and zero-copy chunks apart
+void test_mixed_chunks()
+{
+    std::string const s1("mixed chunks");
+    std::vector<std::uint64_t> const v1 = random_data(8 * 1024);
+    std::vector<std::uint64_t> const v2 = sparse_data(16 * 1024);
+    std::vector<std::uint64_t> const v3 = sparse_data(1024);
+    std::vector<std::uint64_t> const v4 = random_data(32 * 1024);
+
+    archive_data data = save(s1, v1, v2, v3, v4, s1, v2, v1);
+    HPX_TEST_EQ(data.num_pointer_chunks(), static_cast<std::size_t>(3));
+
+    std::string r1, r6;
+    std::vector<std::uint64_t> r2, r3, r4, r5, r7, r8;
+    load(data, r1, r2, r3, r4, r5, r6, r7, r8);
+
+    HPX_TEST_EQ(s1, r1);
+    HPX_TEST(v1 == r2);
+    HPX_TEST(v2 == r3);
+    HPX_TEST(v3 == r4);
+    HPX_TEST(v4 == r5);
+    HPX_TEST_EQ(s1, r6);
+    HPX_TEST(v2 == r7);
+    HPX_TEST(v1 == r8);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_small_data();
+    test_sparse_chunk();
+    test_random_chunk();
+    test_mixed_chunks();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,210 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE) && defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/compression_adaptive.hpp>
+#include <hpx/include/parcelset.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const numparcels_default = 10;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Action, typename T>
+hpx::parcelset::parcel generate_parcel(
+    hpx::id_type const& dest_id, hpx::id_type const& cont, T&& data)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::naming::detail::strip_credits_from_gid(dest);
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<std::uint64_t>(cont), Action(),
+        hpx::launch::async, std::forward<T>(data)));
+
+    p.set_source_id(hpx::find_here());
+    p.size() = 4096;
+
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t sum(std::vector<std::uint64_t> const& data)
+{
+    std::uint64_t result = 0;
+    for (std::uint64_t v : data)
+    {
+        result += v;
+    }
+    return result;
+}
+
+HPX_DECLARE_PLAIN_ACTION(sum, sum_action);
+HPX_ACTION_USES_ADAPTIVE_COMPRESSION(sum_action)
+
+HPX_PLAIN_ACTION(sum, sum_action)
+
+///////////////////////////////////////////////////////////////////////////////
+// compressible data
+std::vector<std::uint64_t> sparse_data(std::size_t size)
+{
+    std::vector<std::uint64_t> data(size, 0);
+    for (std::size_t i = 0; i < size; i += 97)
+    {
+        data[i] = i;
+    }
+    return data;
+}
+
+// incompressible data, this is sent as zero-copy chunks if large enough
+std::vector<std::uint64_t> random_data(std::mt19937_64& gen, std::size_t size)
+{
+    std::vector<std::uint64_t> data(size);
+    for (std::uint64_t& v : data)
+    {
+        v = gen();
+    }
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_data(hpx::id_type const& id, std::mt19937_64& gen)
+{
+    std::vector<hpx::future<std::uint64_t>> results;
+    results.reserve(numparcels_default);
+
+    std::vector<std::uint64_t> expected;
+    expected.reserve(numparcels_default);
+
+    // create parcels of different sizes holding compressible and
+    // incompressible data
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        std::size_t const size = std::size_t(16) << i;
+
+        std::vector<std::uint64_t> data =
+            (i % 2) ? random_data(gen, size) : sparse_data(size);
+        expected.push_back(sum(data));
+
+        hpx::distributed::promise<std::uint64_t> p;
+        results.push_back(p.get_future());
+
+        parcels.push_back(
+            generate_parcel<sum_action>(id, p.get_id(), std::move(data)));
+    }
+
+    // send parcels
+    hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
+        std::move(parcels));
+
+    // verify all messages have been received unchanged
+    hpx::wait_all(results);
+
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void verify_counters()
+{
+    using namespace hpx::performance_counters;
+
+    std::vector<performance_counter> data_counters =
+        discover_counters("/data/count/*/*");
+    std::vector<performance_counter> serialize_counters =
+        discover_counters("/serialize/count/*/*");
+
+    HPX_TEST_EQ(data_counters.size(), serialize_counters.size());
+
+    for (std::size_t i = 0; i != data_counters.size(); ++i)
+    {
+        performance_counter const& serialize_counter = serialize_counters[i];
+        performance_counter const& data_counter = data_counters[i];
+
+        counter_value serialize_value =
+            serialize_counter.get_counter_value(hpx::launch::sync);
+        counter_value data_value =
+            data_counter.get_counter_value(hpx::launch::sync);
+
+        double serialize_val = serialize_value.get_value<double>();
+        double data_val = data_value.get_value<double>();
+
+        if (data_val != 0 && serialize_val != 0)
+        {
+            // compression should reduce the transmitted amount of data
+            HPX_TEST_LTE(serialize_val, data_val);
+        }
+
+        std::string serialize_name =
+            serialize_counter.get_name(hpx::launch::sync);
+        std::string data_name = data_counter.get_name(hpx::launch::sync);
+
+        std::cout << "counter: " << serialize_name
+                  << ", value: " << serialize_val << std::endl;
+        std::cout << "counter: " << data_name << ", value: " << data_val
+                  << std::endl;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::mt19937_64 gen(seed);
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_data(id, gen);
+    }
+
+    // make sure compression was actually invoked
+    verify_counters();
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
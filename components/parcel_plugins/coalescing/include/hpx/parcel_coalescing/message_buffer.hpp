@@ -164,6 +164,13 @@ namespace hpx::plugins::parcel::detail {
             return max_messages_;
         }
 
+        // the write handler of the parcel appended last
+        parcelset::write_handler_type& last_handler()
+        {
+            HPX_ASSERT(!handlers_.empty());
+            return handlers_.back();
+        }
+
     private:
         parcelset::locality dest_;
         std::vector<parcelset::parcel> messages_;
@@ -58,6 +58,9 @@ namespace hpx::plugins::parcel {
         std::int64_t get_average_time_between_parcels(bool reset);
         std::vector<std::int64_t> get_time_between_parcels_histogram(
             bool reset);
+        std::int64_t get_batch_size(bool reset);
+        std::int64_t get_flush_interval(bool reset);
+        std::int64_t get_message_latency(bool reset);
         void get_time_between_parcels_histogram_creator(
             std::int64_t min_boundary, std::int64_t max_boundary,
             std::int64_t num_buckets,
@@ -75,6 +78,12 @@ namespace hpx::plugins::parcel {
         void update_num_messages();
         void update_interval();
 
+        // adaptive mode: adjust the number of coalesced parcels and the
+        // flush interval to the observed arrival rate and message latency
+        void adapt_parameters(std::int64_t time_since_last_parcel);
+        write_handler_type measure_latency(write_handler_type f);
+        void update_latency(std::int64_t latency);
+
     private:
         mutable mutex_type mtx_;
         parcelset::parcelport* pp_;
@@ -86,6 +95,18 @@ namespace hpx::plugins::parcel {
         bool allow_background_flush_;
         std::string action_name_;
 
+        // the configured num_messages and interval, in adaptive mode these
+        // are upper bounds for num_coalesced_parcels_ and interval_
+        bool adaptive_;
+        std::size_t max_coalesced_parcels_;
+        std::size_t max_interval_;
+        std::size_t latency_target_;
+
+        // exponentially weighted averages of the time between parcels and
+        // of the time needed to send a message [ns]
+        double average_time_between_parcels_;
+        double average_latency_;
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
@@ -23,11 +23,14 @@
 
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -41,6 +44,8 @@ namespace hpx::traits {
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
+    //      latency_target = 1000
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -49,7 +54,9 @@ namespace hpx::traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "latency_target = 1000";
         }
     };
 }    // namespace hpx::traits
@@ -84,19 +91,54 @@ namespace hpx::plugins::parcel {
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        std::size_t get_latency_target()
+        {
+            auto const target =
+                hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                    "hpx.plugins.coalescing_message_handler.latency_target",
+                    1000));
+            return (std::max)(target, static_cast<std::size_t>(1));
+        }
+
+        // weight of a new sample for the exponentially weighted averages
+        // used in adaptive mode
+        constexpr double adaptation_weight = 0.125;
+
+        // the smallest flush interval used in adaptive mode [ns]
+        constexpr double min_adaptive_interval = 1000.0;
     }    // namespace detail
 
     void coalescing_message_handler::update_num_messages()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        num_coalesced_parcels_ =
-            detail::get_num_messages(num_coalesced_parcels_);
+        max_coalesced_parcels_ =
+            detail::get_num_messages(max_coalesced_parcels_);
+
+        // in adaptive mode the configured value is an upper bound only
+        if (!adaptive_ || num_coalesced_parcels_ > max_coalesced_parcels_)
+        {
+            num_coalesced_parcels_ = max_coalesced_parcels_;
+        }
     }
 
     void coalescing_message_handler::update_interval()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        interval_ = detail::get_interval(interval_);
+        max_interval_ = detail::get_interval(max_interval_);
+
+        // in adaptive mode the configured value is an upper bound only
+        if (!adaptive_ || interval_ > max_interval_)
+        {
+            interval_ = max_interval_;
+        }
     }
 
     coalescing_message_handler::coalescing_message_handler(
@@ -112,6 +154,12 @@ namespace hpx::plugins::parcel {
       , stopped_(false)
       , allow_background_flush_(detail::get_background_flush())
       , action_name_(action_name)
+      , adaptive_(detail::get_adaptive())
+      , max_coalesced_parcels_(num_coalesced_parcels_)
+      , max_interval_(interval_)
+      , latency_target_(detail::get_latency_target())
+      , average_time_between_parcels_(0.0)
+      , average_latency_(0.0)
       , num_parcels_(0)
       , reset_num_parcels_(0)
       , reset_num_parcels_per_message_parcels_(0)
@@ -139,7 +187,12 @@ namespace hpx::plugins::parcel {
                 this),
             hpx::bind_front(&coalescing_message_handler::
                                 get_time_between_parcels_histogram_creator,
-                this));
+                this),
+            hpx::bind_front(&coalescing_message_handler::get_batch_size, this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_flush_interval, this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_message_latency, this));
 
         // register parameter update callbacks
         set_config_entry_callback(
@@ -165,17 +218,25 @@ namespace hpx::plugins::parcel {
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        if (adaptive_)
+            adapt_parameters(time_since_last_parcel);
+
         std::chrono::microseconds interval(interval_);
 
         // just send parcel if the coalescing was stopped or the buffer is
-        // empty and time since last parcel is larger than coalescing interval.
+        // empty and time since last parcel is larger than coalescing interval
+        // (or if no other parcel is expected to arrive in time).
         if (stopped_ ||
             (buffer_.empty() &&
-                std::chrono::nanoseconds(time_since_last_parcel) > interval))
+                (std::chrono::nanoseconds(time_since_last_parcel) > interval ||
+                    (adaptive_ && num_coalesced_parcels_ <= 1))))
         {
             ++num_messages_;
             l.unlock();
 
+            if (adaptive_)
+                f = measure_latency(HPX_MOVE(f));
+
             // this instance should not buffer parcels anymore
             pp_->put_parcel(dest, HPX_MOVE(p), HPX_MOVE(f));
             return;
@@ -184,6 +245,14 @@ namespace hpx::plugins::parcel {
         detail::message_buffer::message_buffer_append_state s =
             buffer_.append(dest, HPX_MOVE(p), HPX_MOVE(f));
 
+        // flush right away if the arrival rate has dropped since the buffer
+        // was created
+        if (adaptive_ && s != detail::message_buffer::buffer_now_full &&
+            buffer_.size() >= num_coalesced_parcels_)
+        {
+            s = detail::message_buffer::buffer_now_full;
+        }
+
         switch (s)
         {
         case detail::message_buffer::first_message:
@@ -278,12 +347,91 @@ namespace hpx::plugins::parcel {
         ++num_messages_;
         l.unlock();
 
+        if (adaptive_)
+        {
+            parcelset::write_handler_type& f = buff.last_handler();
+            f = measure_latency(HPX_MOVE(f));
+        }
+
         HPX_ASSERT(nullptr != pp_);
         buff(pp_);    // 'invoke' the buffer
 
         return true;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    void coalescing_message_handler::adapt_parameters(
+        std::int64_t time_since_last_parcel)
+    {
+        // a single long pause should not dominate the estimated arrival rate
+        double const latency_target =
+            static_cast<double>(latency_target_) * 1000.0;
+        double const sample = (std::min)(
+            static_cast<double>(time_since_last_parcel), 2.0 * latency_target);
+
+        average_time_between_parcels_ +=
+            (sample - average_time_between_parcels_) *
+            detail::adaptation_weight;
+
+        // the time a parcel may wait in the buffer without violating the
+        // latency target, given the time needed to send a message
+        double interval = (std::min)(latency_target - average_latency_,
+            static_cast<double>(max_interval_) * 1000.0);
+        interval = (std::max)(interval, detail::min_adaptive_interval);
+
+        // the number of parcels expected to arrive during that time
+        double expected = static_cast<double>(max_coalesced_parcels_);
+        if (average_time_between_parcels_ > 0.0)
+        {
+            expected = (std::min)(
+                interval / average_time_between_parcels_, expected);
+        }
+
+        interval_ = static_cast<std::size_t>(interval / 1000.0);
+        num_coalesced_parcels_ =
+            (std::max)(static_cast<std::size_t>(expected), std::size_t(1));
+    }
+
+    coalescing_message_handler::write_handler_type
+    coalescing_message_handler::measure_latency(write_handler_type f)
+    {
+        std::int64_t const started = hpx::chrono::high_resolution_clock::now();
+
+        // the handler might be invoked after this instance has been removed
+        // from the parcel handler
+        auto self = std::static_pointer_cast<coalescing_message_handler>(
+            shared_from_this());
+
+        return [self = HPX_MOVE(self), started, f = HPX_MOVE(f)](
+                   std::error_code const& ec, parcelset::parcel const& p) {
+            if (!ec)
+            {
+                std::int64_t const now =
+                    hpx::chrono::high_resolution_clock::now();
+                self->update_latency(now - started);
+            }
+            if (f)
+            {
+                f(ec, p);
+            }
+        };
+    }
+
+    void coalescing_message_handler::update_latency(std::int64_t latency)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        if (average_latency_ == 0.0)
+        {
+            average_latency_ = static_cast<double>(latency);
+        }
+        else
+        {
+            average_latency_ +=
+                (static_cast<double>(latency) - average_latency_) *
+                detail::adaptation_weight;
+        }
+    }
+
     // performance counter values
     std::int64_t coalescing_message_handler::get_average_time_between_parcels(
         bool reset)
@@ -367,6 +515,26 @@ namespace hpx::plugins::parcel {
         return num_messages;
     }
 
+    std::int64_t coalescing_message_handler::get_batch_size(bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(num_coalesced_parcels_);
+    }
+
+    std::int64_t coalescing_message_handler::get_flush_interval(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(interval_) * 1000;
+    }
+
+    std::int64_t coalescing_message_handler::get_message_latency(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(average_latency_);
+    }
+
     std::vector<std::int64_t>
     coalescing_message_handler::get_time_between_parcels_histogram(
         bool /* reset */)
@@ -552,6 +552,97 @@ namespace hpx::plugins::parcel {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The counters exposing the current coalescing parameters only differ in
+    // the registry function used to access the value.
+    using get_parameter_counter_type =
+        coalescing_counter_registry::get_counter_type (
+            coalescing_counter_registry::*)(std::string const&) const;
+
+    template <get_parameter_counter_type GetCounter>
+    struct parameter_counter_surrogate
+    {
+        explicit parameter_counter_surrogate(std::string const& parameters)
+          : parameters_(parameters)
+        {
+        }
+
+        std::int64_t operator()(bool reset)
+        {
+            if (counter_.empty())
+            {
+                counter_ = (coalescing_counter_registry::instance().*
+                    GetCounter)(parameters_);
+                if (counter_.empty())
+                    return 0;    // no counter available yet
+            }
+
+            // dispatch to actual counter
+            return counter_(reset);
+        }
+
+        hpx::function<std::int64_t(bool)> counter_;
+        std::string parameters_;
+    };
+
+    template <get_parameter_counter_type GetCounter>
+    hpx::naming::gid_type parameter_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        switch (info.type_)
+        {
+        case performance_counters::counter_type::raw:
+        {
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "parameter_counter_creator",
+                    "invalid counter name for coalescing parameter (instance "
+                    "name must not be a valid base counter name)");
+                return naming::invalid_gid;
+            }
+
+            if (paths.parameters_.empty())
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "parameter_counter_creator",
+                    "invalid counter parameter for coalescing parameter: must "
+                    "specify an action type");
+                return naming::invalid_gid;
+            }
+
+            // ask registry
+            hpx::function<std::int64_t(bool)> f =
+                (coalescing_counter_registry::instance().*GetCounter)(
+                    paths.parameters_);
+
+            if (!f.empty())
+            {
+                return performance_counters::detail::create_raw_counter(
+                    info, HPX_MOVE(f), ec);
+            }
+
+            // the counter is not available yet, create surrogate function
+            return performance_counters::detail::create_raw_counter(info,
+                parameter_counter_surrogate<GetCounter>(paths.parameters_),
+                ec);
+        }
+        break;
+
+        default:
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "parameter_counter_creator", "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // This function will be registered as a startup function for HPX below.
     //
@@ -604,7 +695,34 @@ namespace hpx::plugins::parcel {
                 "the action which is given by the counter parameter",
                 HPX_PERFORMANCE_COUNTER_V1,
                 &time_between_parcels_histogram_counter_creator,
-                &counter_discoverer, "ns/0.1%"}};
+                &counter_discoverer, "ns/0.1%"},
+            // /coalescing(...)/count/batch-size@action-name
+            {"/coalescing/count/batch-size", counter_type::raw,
+                "returns the number of parcels after which the message "
+                "handler associated with the action which is given by the "
+                "counter parameter sends a message",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &parameter_counter_creator<
+                    &coalescing_counter_registry::get_batch_size_counter>,
+                &counter_discoverer, ""},
+            // /coalescing(...)/time/flush-interval@action-name
+            {"/coalescing/time/flush-interval", counter_type::raw,
+                "returns the time after which the message handler associated "
+                "with the action which is given by the counter parameter "
+                "sends a message",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &parameter_counter_creator<
+                    &coalescing_counter_registry::get_flush_interval_counter>,
+                &counter_discoverer, "ns"},
+            // /coalescing(...)/time/message-latency@action-name
+            {"/coalescing/time/message-latency", counter_type::raw,
+                "returns the average time needed to send a message generated "
+                "by the message handler associated with the action which is "
+                "given by the counter parameter (adaptive mode only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &parameter_counter_creator<
+                    &coalescing_counter_registry::get_message_latency_counter>,
+                &counter_discoverer, "ns"}};
 
         // Install the counter types, un-installation of the types is handled
         // automatically.
@@ -0,0 +1,203 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the adaptive coalescing mode adjusts the batch size and the
+// flush interval while keeping them within the configured bounds.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/include/actions.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// configured upper bounds for the batch size and the flush interval [us]
+constexpr std::int64_t max_num_messages = 50;
+constexpr std::int64_t max_interval = 5000;
+
+// configured latency target [us]
+constexpr std::int64_t latency_target = 1000;
+
+constexpr std::size_t num_parcels = 100;
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::id_type test(int)
+{
+    return hpx::find_here();
+}
+HPX_DECLARE_PLAIN_ACTION(test, test_action)
+HPX_ACTION_USES_MESSAGE_COALESCING(test_action)
+HPX_PLAIN_ACTION(test, test_action)
+
+hpx::parcelset::parcel generate_parcel(
+    hpx::id_type const& dest_id, hpx::id_type const& cont)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::naming::detail::strip_credits_from_gid(dest);
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<hpx::id_type>(cont), test_action(),
+        hpx::launch::async, 42));
+
+    p.set_source_id(hpx::find_here());
+    p.size() = 4096;
+
+    return p;
+}
+
+std::int64_t query_counter(std::string const& name)
+{
+    using namespace hpx::performance_counters;
+
+    std::vector<performance_counter> counters = discover_counters(
+        "/coalescing{locality#0/total}/" + name + "@test_action");
+    HPX_TEST_EQ(counters.size(), static_cast<std::size_t>(1));
+    if (counters.empty())
+    {
+        return 0;
+    }
+    return counters[0].get_value<std::int64_t>(hpx::launch::sync);
+}
+
+// the chosen parameters have to stay within the configured bounds
+void check_bounds(std::int64_t num_messages, std::int64_t interval)
+{
+    std::int64_t const batch_size = query_counter("count/batch-size");
+    HPX_TEST_LTE(std::int64_t(1), batch_size);
+    HPX_TEST_LTE(batch_size, num_messages);
+
+    std::int64_t const flush_interval = query_counter("time/flush-interval");
+    HPX_TEST_LTE(flush_interval, interval * 1000);
+    HPX_TEST_LTE(flush_interval, latency_target * 1000);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// send the parcels all at once
+void test_burst(hpx::id_type const& id)
+{
+    std::vector<hpx::future<hpx::id_type>> results;
+    results.reserve(num_parcels);
+
+    std::vector<hpx::parcelset::parcel> parcels;
+    parcels.reserve(num_parcels);
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        hpx::distributed::promise<hpx::id_type> p;
+        results.push_back(p.get_future());
+        parcels.push_back(generate_parcel(id, p.get_id()));
+    }
+
+    hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
+        std::move(parcels));
+
+    hpx::wait_all(results);
+    for (hpx::future<hpx::id_type>& f : results)
+    {
+        HPX_TEST_EQ(f.get(), id);
+    }
+}
+
+// send the parcels one by one, leaving more time between two parcels than
+// the latency target allows a parcel to be buffered
+std::int64_t test_paced(hpx::id_type const& id)
+{
+    std::int64_t const messages = query_counter("count/messages");
+
+    std::vector<hpx::future<hpx::id_type>> results;
+    results.reserve(num_parcels);
+
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        hpx::distributed::promise<hpx::id_type> p;
+        results.push_back(p.get_future());
+
+        hpx::get_runtime_distributed().get_parcel_handler().put_parcel(
+            generate_parcel(id, p.get_id()));
+
+        hpx::this_thread::sleep_for(
+            std::chrono::microseconds(2 * latency_target));
+    }
+
+    hpx::wait_all(results);
+    for (hpx::future<hpx::id_type>& f : results)
+    {
+        HPX_TEST_EQ(f.get(), id);
+    }
+
+    return query_counter("count/messages") - messages;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_burst(id);
+        check_bounds(max_num_messages, max_interval);
+
+        // no other parcel is expected to arrive within the latency target,
+        // almost all parcels have to be sent in a message of their own
+        std::int64_t const messages = test_paced(id);
+        check_bounds(max_num_messages, max_interval);
+
+        HPX_TEST_EQ(query_counter("count/batch-size"), std::int64_t(1));
+        HPX_TEST_LTE(static_cast<std::int64_t>(num_parcels) / 2, messages);
+
+        // the flush interval adapts to the latency target which is smaller
+        // than the configured interval
+        HPX_TEST_LT(query_counter("time/flush-interval"), max_interval * 1000);
+
+        // changing the configured bounds at runtime must constrain the
+        // adapted parameters without replacing them
+        hpx::set_config_entry(
+            "hpx.plugins.coalescing_message_handler.num_messages", "10");
+        hpx::set_config_entry(
+            "hpx.plugins.coalescing_message_handler.interval", "500");
+
+        HPX_TEST_EQ(query_counter("count/batch-size"), std::int64_t(1));
+
+        test_burst(id);
+        check_bounds(10, 500);
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.parcel.message_handlers=1",
+        "hpx.plugins.coalescing_message_handler.adaptive=1",
+        "hpx.plugins.coalescing_message_handler.num_messages=" +
+            std::to_string(max_num_messages),
+        "hpx.plugins.coalescing_message_handler.interval=" +
+            std::to_string(max_interval),
+        "hpx.plugins.coalescing_message_handler.latency_target=" +
+            std::to_string(latency_target)};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -525,7 +525,8 @@ namespace hpx::local::detail {
                 "'local', 'local-priority-fifo','local-priority-lifo', "
                 "'abp-priority-fifo', 'abp-priority-lifo', 'static', "
                 "'static-priority', 'local-workrequesting-fifo',"
-                "'local-workrequesting-lifo', and 'local-workrequesting-mc' "
+                "'local-workrequesting-lifo', 'local-workrequesting-mc', "
+                "and 'deadline' "
                 "(default: 'local-priority'; all option values can be "
                 "abbreviated)")
             ("hpx:high-priority-threads", value<std::size_t>(),
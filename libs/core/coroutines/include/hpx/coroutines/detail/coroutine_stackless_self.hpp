@@ -11,9 +11,11 @@
 #include <hpx/coroutines/detail/coroutine_self.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/coroutines/thread_id_type.hpp>
+#include <hpx/modules/errors.hpp>
 
 #include <cstddef>
 #include <limits>
+#include <thread>
 #include <utility>
 
 namespace hpx::threads::coroutines {
@@ -33,11 +35,29 @@ namespace hpx::threads::coroutines::detail {
             HPX_ASSERT(pimpl_);
         }
 
-        arg_type yield_impl(result_type) override
-        {
-            // stackless coroutines don't support suspension
-            HPX_ASSERT(false);
-            return threads::thread_restart_state::abort;
+        arg_type yield_impl(result_type arg) override
+        {
+            // stackless coroutines don't support suspension, however a plain
+            // yield (without a thread to switch to) can be emulated by
+            // yielding the underlying OS thread
+            if ((arg.first == thread_schedule_state::pending ||
+                    arg.first == thread_schedule_state::pending_boost) &&
+                arg.second == invalid_thread_id)
+            {
+                std::this_thread::yield();
+                return threads::thread_restart_state::signaled;
+            }
+
+            // any other suspension is rejected, blocking the worker OS thread
+            // instead could deadlock the thread pool. Stackless threads that
+            // may suspend are run on a stackful runner instead (see
+            // hpx.stacks.stackless_leaf_tasks), which provides its own
+            // coroutine_self.
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "coroutine_stackless_self::yield_impl",
+                "stackless threads run on the stack of their worker thread and "
+                "can't be suspended (requested state: {})",
+                get_thread_state_name(arg.first));
         }
 
         thread_id_type get_thread_id() const noexcept override
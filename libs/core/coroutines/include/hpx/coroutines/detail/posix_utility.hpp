@@ -32,6 +32,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 
 // include unistd.h conditionally to check for POSIX version. Not all OSs have the
 // unistd header...
@@ -81,7 +82,9 @@ namespace hpx::threads::coroutines::detail::posix {
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
-    inline void* alloc_stack(std::size_t size)
+    // Map a new stack of the given size (plus the guard page, if enabled)
+    inline void* map_stack(std::size_t size, bool prefault = false,
+        [[maybe_unused]] bool use_huge_pages = false)
     {
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
@@ -89,15 +92,22 @@ namespace hpx::threads::coroutines::detail::posix {
             size += EXEC_PAGESIZE;
         }
 #endif
-        void* real_stack = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
 #if defined(__APPLE__)
-            MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+        int flags = MAP_PRIVATE | MAP_ANON | MAP_NORESERVE;
 #elif defined(__FreeBSD__)
-            MAP_PRIVATE | MAP_ANON,
+        int flags = MAP_PRIVATE | MAP_ANON;
 #else
-            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+#endif
+#if defined(MAP_POPULATE)
+        if (prefault)
+        {
+            // pre-faulted stacks must not be lazily reserved
+            flags = (flags & ~MAP_NORESERVE) | MAP_POPULATE;
+        }
 #endif
-            -1, 0);
+        void* real_stack =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
 
         if (real_stack == MAP_FAILED)
         {
@@ -114,6 +124,23 @@ namespace hpx::threads::coroutines::detail::posix {
             throw std::runtime_error(error_message);
         }
 
+#if defined(MADV_HUGEPAGE)
+        if (use_huge_pages)
+        {
+            ::madvise(real_stack, size, MADV_HUGEPAGE);
+        }
+#endif
+#if !defined(MAP_POPULATE)
+        if (prefault)
+        {
+            // touch all pages to make them resident
+            for (std::size_t i = 0; i < size; i += EXEC_PAGESIZE)
+            {
+                static_cast<char volatile*>(real_stack)[i] = 0;
+            }
+        }
+#endif
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
         {
@@ -158,7 +185,8 @@ namespace hpx::threads::coroutines::detail::posix {
         return false;
     }
 
-    inline void free_stack(void* stack, std::size_t size)
+    // Unmap a stack previously allocated using map_stack
+    inline void unmap_stack(void* stack, std::size_t size) noexcept
     {
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
@@ -176,6 +204,25 @@ namespace hpx::threads::coroutines::detail::posix {
 #endif
     }
 
+    inline void* alloc_stack(std::size_t size)
+    {
+        if (stack_pool::use_stack_pool)
+        {
+            return stack_pool::allocate(size);
+        }
+        return map_stack(size);
+    }
+
+    inline void free_stack(void* stack, std::size_t size)
+    {
+        if (stack_pool::use_stack_pool)
+        {
+            stack_pool::deallocate(stack, size);
+            return;
+        }
+        unmap_stack(stack, size);
+    }
+
 #else
     // non-mmap()
 
@@ -0,0 +1,80 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// The stack pool keeps the stacks of destroyed coroutines around for later
+// reuse instead of returning them to the operating system right away. It is
+// organized in two tiers:
+//
+//  - a per-worker (thread local) cache holding a small number of hot stacks
+//    whose pages are still resident,
+//  - a global overflow tier (one per NUMA domain) holding stacks that were
+//    evicted from the per-worker caches. The pages of those stacks are given
+//    back to the operating system using madvise(MADV_DONTNEED), only the
+//    address range (and the guard page) is kept.
+//
+// Newly mapped stacks can be optionally pre-faulted (MAP_POPULATE) and backed
+// by transparent huge pages. As the pages are touched by the allocating
+// worker thread, the stacks are placed on the NUMA domain of that worker
+// (first touch).
+namespace hpx::threads::coroutines::detail::stack_pool {
+
+    struct parameters
+    {
+        // enable the use of the stack pool
+        bool enabled = true;
+
+        // maximal number of stacks kept in each of the per-worker caches
+        std::size_t max_local_stacks = 32;
+
+        // maximal number of stacks kept in the global overflow tier of each
+        // NUMA domain
+        std::size_t max_global_stacks = 256;
+
+        // pre-fault all pages of newly allocated stacks
+        bool prefault = false;
+
+        // advise the operating system to back stacks by huge pages
+        bool use_huge_pages = false;
+    };
+
+    // this global variable is used to control whether the stack pool will be
+    // used or not (set from hpx.stacks.pool)
+    HPX_CORE_EXPORT extern bool use_stack_pool;
+
+    // Set the parameters for the stack pool, this is expected to be called
+    // once during startup, before any of the worker threads are created.
+    HPX_CORE_EXPORT void set_parameters(parameters const& params) noexcept;
+    HPX_CORE_EXPORT parameters const& get_parameters() noexcept;
+
+    // Retrieve a stack of the given size (not including a possible guard
+    // page) from the pool, allocate a new one if none is available.
+    HPX_CORE_EXPORT void* allocate(std::size_t size);
+
+    // Return a stack to the pool, it will be unmapped if all tiers are full.
+    HPX_CORE_EXPORT void deallocate(void* stack, std::size_t size) noexcept;
+
+    // Move all stacks held by the per-worker cache of the calling thread to
+    // the global overflow tier. This is called by the thread pools whenever
+    // one of their worker threads exits (e.g. while the pool is stopped or a
+    // processing unit is removed from it).
+    HPX_CORE_EXPORT void release_local_cache() noexcept;
+
+    // Unmap all stacks currently held by the global overflow tier.
+    HPX_CORE_EXPORT void trim() noexcept;
+
+    // Performance counter data
+    HPX_CORE_EXPORT std::int64_t get_hit_count(bool reset) noexcept;
+    HPX_CORE_EXPORT std::int64_t get_miss_count(bool reset) noexcept;
+    HPX_CORE_EXPORT std::int64_t get_resident_bytes(bool reset) noexcept;
+}    // namespace hpx::threads::coroutines::detail::stack_pool
@@ -218,6 +218,12 @@ namespace hpx::threads::coroutines {
     public:
         HPX_FORCEINLINE result_type operator()(arg_type arg = arg_type());
 
+        // Invoke the wrapped function on the stack of the (stackful)
+        // coroutine currently running, that coroutine provides the
+        // coroutine_self the function may suspend through.
+        HPX_FORCEINLINE result_type invoke_on_current_self(
+            arg_type arg = arg_type());
+
         explicit constexpr operator bool() const noexcept
         {
             return !exited();
@@ -298,4 +304,31 @@ namespace hpx::threads::coroutines {
 
         return result;
     }
+
+    HPX_FORCEINLINE stackless_coroutine::result_type
+    stackless_coroutine::invoke_on_current_self(arg_type arg)
+    {
+        HPX_ASSERT(is_ready());
+        HPX_ASSERT(detail::coroutine_self::get_self() != nullptr);
+
+        result_type result(
+            thread_schedule_state::terminated, invalid_thread_id);
+
+        {
+            state_ = context_state::running;
+            auto on_exit_inner = hpx::experimental::scope_exit(
+                [this] { state_ = context_state::exited; });
+
+            result = f_(arg);    // invoke wrapped function
+
+            // we always have to run to completion
+            HPX_ASSERT(
+                result.first == threads::thread_schedule_state::terminated);
+        }
+
+        reset_tss();
+        reset();
+
+        return result;
+    }
 }    // namespace hpx::threads::coroutines
@@ -0,0 +1,361 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#if (defined(__linux) || defined(linux) || defined(__linux__) ||               \
+    defined(__FreeBSD__) || defined(__APPLE__)) &&                             \
+    defined(HPX_HAVE_THREAD_STACK_MMAP)
+
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace hpx::threads::coroutines::detail::stack_pool {
+
+    bool use_stack_pool = true;
+
+    namespace {
+
+        struct cached_stack
+        {
+            void* stack;
+            std::size_t size;
+        };
+
+        using stacks_type = std::vector<cached_stack>;
+
+        parameters pool_parameters;
+
+        std::atomic<std::int64_t> hits(0);
+        std::atomic<std::int64_t> misses(0);
+        std::atomic<std::int64_t> resident_bytes(0);
+
+        // Return the NUMA domain the calling thread is currently running on
+        std::size_t current_numa_domain() noexcept
+        {
+#if (defined(__linux) || defined(linux) || defined(__linux__)) &&              \
+    defined(SYS_getcpu)
+            unsigned cpu = 0;
+            unsigned node = 0;
+            if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+            {
+                return node;
+            }
+#endif
+            return 0;
+        }
+
+        void release_pages(cached_stack const& s) noexcept
+        {
+            ::madvise(s.stack, s.size, MADV_DONTNEED);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The global overflow tier, one list of stacks per NUMA domain
+        struct global_tier
+        {
+            global_tier() = default;
+
+            global_tier(global_tier const&) = delete;
+            global_tier(global_tier&&) = delete;
+            global_tier& operator=(global_tier const&) = delete;
+            global_tier& operator=(global_tier&&) = delete;
+
+            ~global_tier()
+            {
+                trim();
+                destroyed = true;
+            }
+
+            bool take(std::size_t domain, std::size_t size, void*& stack)
+            {
+                std::lock_guard<std::mutex> l(mtx);
+                if (domain >= stacks.size())
+                    return false;
+
+                stacks_type& s = stacks[domain];
+                for (auto it = s.rbegin(); it != s.rend(); ++it)
+                {
+                    if (it->size == size)
+                    {
+                        stack = it->stack;
+                        *it = s.back();
+                        s.pop_back();
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            bool put(std::size_t domain, cached_stack const& stack)
+            {
+                std::lock_guard<std::mutex> l(mtx);
+                if (domain >= stacks.size())
+                    stacks.resize(domain + 1);
+
+                stacks_type& s = stacks[domain];
+                if (s.size() >= pool_parameters.max_global_stacks)
+                    return false;
+
+                s.push_back(stack);
+                return true;
+            }
+
+            void trim() noexcept
+            {
+                std::vector<stacks_type> to_unmap;
+                {
+                    std::lock_guard<std::mutex> l(mtx);
+                    std::swap(to_unmap, stacks);
+                }
+
+                for (auto const& s : to_unmap)
+                {
+                    for (cached_stack const& stack : s)
+                    {
+                        posix::unmap_stack(stack.stack, stack.size);
+                    }
+                }
+            }
+
+            std::mutex mtx;
+            std::vector<stacks_type> stacks;
+
+            // the global tier is a static object, deallocation requests may
+            // arrive after it has been destroyed (e.g. during static
+            // destruction)
+            static bool destroyed;
+        };
+
+        bool global_tier::destroyed = false;
+
+        global_tier& get_global_tier()
+        {
+            static global_tier tier;
+            return tier;
+        }
+
+        void return_to_global_tier(cached_stack const& stack) noexcept
+        {
+            if (!global_tier::destroyed)
+            {
+                // release the physical pages, only the mapping is kept
+                release_pages(stack);
+                try
+                {
+                    if (get_global_tier().put(current_numa_domain(), stack))
+                        return;
+                }
+                catch (...)
+                {
+                    // failed to store the stack, unmap it instead
+                }
+            }
+            posix::unmap_stack(stack.stack, stack.size);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The per-worker tier, stacks in here are kept resident
+        struct local_cache
+        {
+            local_cache() = default;
+
+            local_cache(local_cache const&) = delete;
+            local_cache(local_cache&&) = delete;
+            local_cache& operator=(local_cache const&) = delete;
+            local_cache& operator=(local_cache&&) = delete;
+
+            ~local_cache()
+            {
+                release();
+                destroyed = true;
+            }
+
+            bool take(std::size_t size, void*& stack) noexcept
+            {
+                for (auto it = stacks.rbegin(); it != stacks.rend(); ++it)
+                {
+                    if (it->size == size)
+                    {
+                        stack = it->stack;
+                        *it = stacks.back();
+                        stacks.pop_back();
+                        resident_bytes.fetch_sub(
+                            static_cast<std::int64_t>(size),
+                            std::memory_order_relaxed);
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            bool put(cached_stack const& stack)
+            {
+                if (stacks.size() >= pool_parameters.max_local_stacks)
+                    return false;
+
+                stacks.push_back(stack);
+                resident_bytes.fetch_add(static_cast<std::int64_t>(stack.size),
+                    std::memory_order_relaxed);
+                return true;
+            }
+
+            void release() noexcept
+            {
+                for (cached_stack const& stack : stacks)
+                {
+                    resident_bytes.fetch_sub(
+                        static_cast<std::int64_t>(stack.size),
+                        std::memory_order_relaxed);
+                    return_to_global_tier(stack);
+                }
+                stacks.clear();
+            }
+
+            stacks_type stacks;
+
+            // thread local destruction order is unspecified with regard to
+            // other thread local objects that might free stacks
+            static thread_local bool destroyed;
+        };
+
+        thread_local bool local_cache::destroyed = false;
+
+        local_cache& get_local_cache()
+        {
+            static thread_local local_cache cache;
+            return cache;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void set_parameters(parameters const& params) noexcept
+    {
+        pool_parameters = params;
+        use_stack_pool = params.enabled;
+    }
+
+    parameters const& get_parameters() noexcept
+    {
+        return pool_parameters;
+    }
+
+    void* allocate(std::size_t size)
+    {
+        void* stack = nullptr;
+        if ((!local_cache::destroyed && get_local_cache().take(size, stack)) ||
+            (!global_tier::destroyed &&
+                get_global_tier().take(current_numa_domain(), size, stack)))
+        {
+            hits.fetch_add(1, std::memory_order_relaxed);
+            return stack;
+        }
+
+        misses.fetch_add(1, std::memory_order_relaxed);
+        return posix::map_stack(
+            size, pool_parameters.prefault, pool_parameters.use_huge_pages);
+    }
+
+    void deallocate(void* stack, std::size_t size) noexcept
+    {
+        cached_stack const s{stack, size};
+        try
+        {
+            if (!local_cache::destroyed && get_local_cache().put(s))
+                return;
+        }
+        catch (...)
+        {
+            // failed to grow the local cache, fall back to the global tier
+        }
+        return_to_global_tier(s);
+    }
+
+    void release_local_cache() noexcept
+    {
+        if (!local_cache::destroyed)
+            get_local_cache().release();
+    }
+
+    void trim() noexcept
+    {
+        if (!global_tier::destroyed)
+            get_global_tier().trim();
+    }
+
+    std::int64_t get_hit_count(bool reset) noexcept
+    {
+        return util::get_and_reset_value(hits, reset);
+    }
+
+    std::int64_t get_miss_count(bool reset) noexcept
+    {
+        return util::get_and_reset_value(misses, reset);
+    }
+
+    std::int64_t get_resident_bytes(bool) noexcept
+    {
+        return resident_bytes.load(std::memory_order_relaxed);
+    }
+}    // namespace hpx::threads::coroutines::detail::stack_pool
+
+#else
+
+namespace hpx::threads::coroutines::detail::stack_pool {
+
+    // stacks are not allocated using mmap(), no pooling is performed
+    bool use_stack_pool = false;
+
+    void set_parameters(parameters const&) noexcept {}
+
+    parameters const& get_parameters() noexcept
+    {
+        static parameters const params{false};
+        return params;
+    }
+
+    void* allocate(std::size_t)
+    {
+        return nullptr;
+    }
+
+    void deallocate(void*, std::size_t) noexcept {}
+
+    void release_local_cache() noexcept {}
+
+    void trim() noexcept {}
+
+    std::int64_t get_hit_count(bool) noexcept
+    {
+        return 0;
+    }
+
+    std::int64_t get_miss_count(bool) noexcept
+    {
+        return 0;
+    }
+
+    std::int64_t get_resident_bytes(bool) noexcept
+    {
+        return 0;
+    }
+}    // namespace hpx::threads::coroutines::detail::stack_pool
+
+#endif
@@ -0,0 +1,116 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace stack_pool = hpx::threads::coroutines::detail::stack_pool;
+
+void test_stack_pool()
+{
+#if (defined(__linux) || defined(linux) || defined(__linux__)) &&              \
+    defined(HPX_HAVE_THREAD_STACK_MMAP)
+    stack_pool::parameters params;
+    params.enabled = true;
+    params.max_local_stacks = 2;
+    params.max_global_stacks = 4;
+    stack_pool::set_parameters(params);
+
+    std::size_t const size =
+        16 * static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    std::int64_t const isize = static_cast<std::int64_t>(size);
+
+    (void) stack_pool::get_hit_count(true);
+    (void) stack_pool::get_miss_count(true);
+
+    // the first allocation has to be a miss
+    void* s1 = stack_pool::allocate(size);
+    HPX_TEST(s1 != nullptr);
+    HPX_TEST_EQ(stack_pool::get_miss_count(false), 1);
+    HPX_TEST_EQ(stack_pool::get_hit_count(false), 0);
+
+    std::memset(s1, 0xff, size);
+
+    // returned stacks are kept in the local cache and are reused
+    stack_pool::deallocate(s1, size);
+    HPX_TEST_EQ(stack_pool::get_resident_bytes(false), isize);
+
+    void* s2 = stack_pool::allocate(size);
+    HPX_TEST_EQ(s1, s2);
+    HPX_TEST_EQ(stack_pool::get_hit_count(false), 1);
+    HPX_TEST_EQ(stack_pool::get_resident_bytes(false), 0);
+
+    // stacks of a different size are not handed out
+    stack_pool::deallocate(s2, size);
+    void* s3 = stack_pool::allocate(2 * size);
+    HPX_TEST(s3 != s2);
+    HPX_TEST_EQ(stack_pool::get_miss_count(false), 2);
+
+    void* s4 = stack_pool::allocate(size);
+    HPX_TEST_EQ(s4, s2);
+    HPX_TEST_EQ(stack_pool::get_hit_count(false), 2);
+
+    void* s5 = stack_pool::allocate(size);
+    HPX_TEST_EQ(stack_pool::get_miss_count(false), 3);
+
+    // overflowing stacks end up in the global tier
+    stack_pool::deallocate(s4, size);
+    stack_pool::deallocate(s5, size);
+    HPX_TEST_EQ(stack_pool::get_resident_bytes(false), 2 * isize);
+
+    stack_pool::deallocate(s3, 2 * size);
+    HPX_TEST_EQ(stack_pool::get_resident_bytes(false), 2 * isize);
+
+    stack_pool::release_local_cache();
+    HPX_TEST_EQ(stack_pool::get_resident_bytes(false), 0);
+
+    // stacks released to the global tier can be picked up by other threads
+    std::thread t([&]() {
+        std::vector<void*> stacks;
+        for (int i = 0; i != 2; ++i)
+        {
+            stacks.push_back(stack_pool::allocate(size));
+        }
+        HPX_TEST_EQ(stack_pool::get_miss_count(false), 3);
+
+        // the pages of stacks taken from the global tier have been released
+        HPX_TEST_EQ(static_cast<unsigned char*>(stacks[0])[0], 0);
+
+        for (void* s : stacks)
+        {
+            stack_pool::deallocate(s, size);
+        }
+    });
+    t.join();
+
+    void* s6 = stack_pool::allocate(2 * size);
+    HPX_TEST_EQ(s6, s3);
+    stack_pool::deallocate(s6, 2 * size);
+
+    HPX_TEST_EQ(stack_pool::get_hit_count(true), 5);
+    HPX_TEST_EQ(stack_pool::get_miss_count(true), 3);
+
+    stack_pool::trim();
+#endif
+}
+
+int main()
+{
+    test_stack_pool();
+
+    return hpx::util::report_errors();
+}
@@ -19,15 +19,18 @@
 #include <hpx/execution/detail/post_policy_dispatch.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/fused_bulk_execute.hpp>
+#include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/pack_traversal/unwrap.hpp>
 #include <hpx/synchronization/latch.hpp>
+#include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 
 #include <algorithm>
@@ -40,6 +43,16 @@
 
 namespace hpx::parallel::execution::detail {
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Return whether tasks launched using the given policy are run on newly
+    // created (not yet running) threads
+    template <typename Launch>
+    constexpr bool posts_new_threads(Launch const& policy) noexcept
+    {
+        return !(policy == hpx::launch::sync ||
+            policy == hpx::launch::deferred || policy == hpx::launch::fork);
+    }
+
     ////////////////////////////////////////////////////////////////////////////
     template <typename Launch, typename F, typename S, typename... Ts>
     std::vector<hpx::future<detail::bulk_function_result_t<F, S, Ts...>>>
@@ -59,7 +72,7 @@ namespace hpx::parallel::execution::detail {
         results.resize(size);
 
         auto post_policy = hpx::execution::experimental::with_stacksize(
-            policy, threads::thread_stacksize::small_);
+            policy, threads::detail::get_leaf_task_stacksize());
 
         hpx::latch l(size + 1);
         std::size_t part_begin = 0;
@@ -69,7 +82,10 @@ namespace hpx::parallel::execution::detail {
             std::size_t const part_end = ((t + 1) * size) / num_threads;
             std::size_t const part_size = part_end - part_begin;
 
-            auto async_policy = hpx::execution::experimental::with_hint(policy,
+            auto async_policy = hpx::execution::experimental::with_hint(
+                hpx::execution::experimental::with_stacksize(policy,
+                    threads::detail::get_leaf_task_stacksize(
+                        policy.stacksize())),
                 threads::thread_schedule_hint{
                     static_cast<std::int16_t>(first_thread + t)});
 
@@ -136,7 +152,11 @@ namespace hpx::parallel::execution::detail {
                 std::decay_t<Ts>... ts) {
                 std::size_t const size = hpx::util::size(shape);
                 auto post_policy = hpx::execution::experimental::with_stacksize(
-                    policy, threads::thread_stacksize::small_);
+                    policy, threads::detail::get_leaf_task_stacksize());
+                auto leaf_policy = hpx::execution::experimental::with_stacksize(
+                    policy,
+                    threads::detail::get_leaf_task_stacksize(
+                        policy.stacksize()));
 
                 std::exception_ptr e;
                 hpx::spinlock mtx_e;
@@ -162,7 +182,7 @@ namespace hpx::parallel::execution::detail {
                 for (std::size_t t = 0; t != num_threads; ++t)
                 {
                     auto inner_post_policy =
-                        hpx::execution::experimental::with_hint(policy,
+                        hpx::execution::experimental::with_hint(leaf_policy,
                             threads::thread_schedule_hint{
                                 static_cast<std::int16_t>(first_thread + t)});
 
@@ -173,12 +193,39 @@ namespace hpx::parallel::execution::detail {
                                           bool direct) mutable {
                         // launch N-1 tasks
                         auto iter = it;
-                        for (std::size_t i = begin + direct; i != end;
-                             (void) ++iter, ++i)
+                        if (posts_new_threads(inner_post_policy))
+                        {
+                            // all tasks go to the same queue, create them
+                            // using a single call into the scheduler
+                            auto hint = inner_post_policy.hint();
+                            hint.runs_as_child_mode(
+                                hpx::threads::thread_execution_hint::none);
+
+                            std::vector<threads::thread_init_data> data;
+                            data.reserve(end - begin - direct);
+                            for (std::size_t i = begin + direct; i != end;
+                                 (void) ++iter, ++i)
+                            {
+                                data.emplace_back(
+                                    threads::make_thread_function_nullary(
+                                        hpx::util::deferred_call(
+                                            wrapped, *iter, ts...)),
+                                    desc, inner_post_policy.priority(), hint,
+                                    inner_post_policy.stacksize(),
+                                    threads::thread_schedule_state::pending);
+                            }
+                            threads::register_work_bulk(
+                                data.data(), data.size(), pool);
+                        }
+                        else
                         {
-                            hpx::detail::post_policy_dispatch<Launch>::call(
-                                inner_post_policy, desc, pool, wrapped, *iter,
-                                ts...);
+                            for (std::size_t i = begin + direct; i != end;
+                                 (void) ++iter, ++i)
+                            {
+                                hpx::detail::post_policy_dispatch<Launch>::call(
+                                    inner_post_policy, desc, pool, wrapped,
+                                    *iter, ts...);
+                            }
                         }
 
                         // execute last task directly, if needed
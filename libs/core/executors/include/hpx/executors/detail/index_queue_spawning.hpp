@@ -25,6 +25,7 @@
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/modules/memory.hpp>
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
+#include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #include <hpx/topology/cpu_mask.hpp>
 #include <hpx/type_support/pack.hpp>
@@ -314,9 +315,9 @@ namespace hpx::parallel::execution::detail {
                 return;
             }
 
-            // run task on small stack
+            // run task on small stack (or stackless, if enabled)
             auto post_policy = hpx::execution::experimental::with_stacksize(
-                policy, threads::thread_stacksize::small_);
+                policy, threads::detail::get_leaf_task_stacksize());
 
             if (dont_bind_to_core)
             {
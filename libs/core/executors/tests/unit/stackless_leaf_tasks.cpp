@@ -0,0 +1,147 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the leaf tasks of the parallel_executor run on stackless threads
+// if hpx.stacks.stackless_leaf_tasks is set, and that those tasks may wait
+// (and thus be suspended) like any other thread.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/mutex.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+constexpr std::size_t num_tasks = 1000;
+
+bool is_stackless() noexcept
+{
+    return hpx::threads::get_self_id_data()->get_stack_size_enum() ==
+        hpx::threads::thread_stacksize::nostack;
+}
+
+void test_stackless_bulk()
+{
+    hpx::execution::parallel_executor exec;
+
+    std::atomic<std::size_t> count(0);
+    std::atomic<std::size_t> stackless(0);
+    hpx::experimental::for_loop(
+        hpx::execution::par.on(exec), 0, num_tasks, [&](std::size_t) {
+            ++count;
+            if (is_stackless())
+            {
+                ++stackless;
+            }
+        });
+
+    HPX_TEST_EQ(count.load(), num_tasks);
+    HPX_TEST_NEQ(stackless.load(), std::size_t(0));
+}
+
+void test_stackless_suspension()
+{
+    hpx::execution::parallel_executor exec;
+
+    hpx::promise<std::size_t> p;
+    hpx::shared_future<std::size_t> f = p.get_future();
+
+    // the value is set by a task spawned by one of the leaf tasks, thus the
+    // leaf tasks waiting for it have to be suspended
+    std::atomic<bool> spawned(false);
+
+    std::atomic<std::size_t> count(0);
+    std::atomic<std::size_t> suspended(0);
+    hpx::experimental::for_loop(
+        hpx::execution::par.on(exec), 0, num_tasks, [&](std::size_t) {
+            hpx::this_thread::yield();
+
+            if (!spawned.exchange(true))
+            {
+                hpx::post([&p]() {
+                    hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    p.set_value(42);
+                });
+            }
+
+            bool const stackless = is_stackless();
+
+            HPX_TEST_EQ(f.get(), std::size_t(42));
+            hpx::this_thread::sleep_for(std::chrono::microseconds(10));
+
+            // the task keeps its identity while being suspended
+            HPX_TEST_EQ(is_stackless(), stackless);
+            if (stackless)
+            {
+                ++suspended;
+            }
+            ++count;
+        });
+
+    HPX_TEST_EQ(count.load(), num_tasks);
+    HPX_TEST_NEQ(suspended.load(), std::size_t(0));
+}
+
+void test_stackless_mutex()
+{
+    hpx::execution::parallel_executor exec;
+
+    // the mutex is contended, the waiting tasks are suspended
+    hpx::mutex mtx;
+    std::size_t sum = 0;
+    hpx::experimental::for_loop(
+        hpx::execution::par.on(exec), 0, num_tasks, [&](std::size_t i) {
+            std::lock_guard<hpx::mutex> l(mtx);
+            hpx::this_thread::yield();
+            sum += i;
+        });
+
+    HPX_TEST_EQ(sum, num_tasks * (num_tasks - 1) / 2);
+}
+
+void test_stackless_nested()
+{
+    hpx::execution::parallel_executor exec;
+
+    // the leaf tasks wait for nested parallel algorithms
+    std::atomic<std::size_t> count(0);
+    hpx::experimental::for_loop(
+        hpx::execution::par.on(exec), 0, 100, [&](std::size_t) {
+            hpx::experimental::for_loop(hpx::execution::par.on(exec), 0, 100,
+                [&](std::size_t) { ++count; });
+        });
+
+    HPX_TEST_EQ(count.load(), std::size_t(100 * 100));
+}
+
+int hpx_main()
+{
+    HPX_TEST(hpx::threads::detail::use_stackless_leaf_tasks);
+
+    test_stackless_bulk();
+    test_stackless_suspension();
+    test_stackless_mutex();
+    test_stackless_nested();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.stacks.stackless_leaf_tasks=1"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/ini/ini.hpp>
 #include <hpx/modules/filesystem.hpp>
@@ -91,6 +92,10 @@ namespace hpx::util {
 
         std::size_t get_agas_max_pending_refcnt_requests() const;
 
+        // Get the interval (in milliseconds) after which pending reference
+        // count decrements are sent at the latest
+        std::size_t get_agas_refcnt_flush_interval() const;
+
         // Load application specific configuration and merge it with the
         // default configuration loaded from hpx.ini
         bool load_application_configuration(
@@ -112,6 +117,14 @@ namespace hpx::util {
         bool use_stack_guard_pages() const;
 #endif
 
+        // Return the parameters controlling the pooling of thread stacks
+        threads::coroutines::detail::stack_pool::parameters
+        get_stack_pool_parameters() const;
+
+        // Return whether leaf tasks of the parallel executors should be run
+        // on stackless threads
+        bool use_stackless_leaf_tasks() const;
+
         // return trace_depth for stack-backtraces
         std::size_t trace_depth() const;
 
@@ -215,6 +215,12 @@ namespace hpx::util {
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
 #endif
+            "pool = ${HPX_STACK_POOL:1}",
+            "pool_max_local_stacks = ${HPX_STACK_POOL_MAX_LOCAL_STACKS:32}",
+            "pool_max_global_stacks = ${HPX_STACK_POOL_MAX_GLOBAL_STACKS:256}",
+            "pool_prefault = ${HPX_STACK_POOL_PREFAULT:0}",
+            "pool_use_huge_pages = ${HPX_STACK_POOL_USE_HUGE_PAGES:0}",
+            "stackless_leaf_tasks = ${HPX_STACKLESS_LEAF_TASKS:0}",
 
             "[hpx.threadpools]",
 #if defined(HPX_HAVE_IO_POOL)
@@ -257,6 +263,12 @@ namespace hpx::util {
             "init_threads_count = "
             "${HPX_THREAD_QUEUE_INIT_THREADS_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_INIT_THREADS_COUNT)) "}",
+            "min_tasks_to_steal_core_group = "
+            "${HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_CORE_GROUP:1}",
+            "min_tasks_to_steal_numa_domain = "
+            "${HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_NUMA_DOMAIN:1}",
+            "min_tasks_to_steal_remote = "
+            "${HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_REMOTE:1}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -304,6 +316,7 @@ namespace hpx::util {
             "${HPX_AGAS_MAX_PENDING_REFCNT_REQUESTS:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(
                     HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)) "}",
+            "refcnt_flush_interval = ${HPX_AGAS_REFCNT_FLUSH_INTERVAL:10}",
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
@@ -920,6 +933,16 @@ namespace hpx::util {
         return HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS;
     }
 
+    std::size_t runtime_configuration::get_agas_refcnt_flush_interval() const
+    {
+        if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "refcnt_flush_interval", 10);
+        }
+        return 10;
+    }
+
     bool runtime_configuration::get_itt_notify_mode() const
     {
 #if HPX_HAVE_ITTNOTIFY != 0
@@ -1101,6 +1124,38 @@ namespace hpx::util {
     }
 #endif
 
+    threads::coroutines::detail::stack_pool::parameters
+    runtime_configuration::get_stack_pool_parameters() const
+    {
+        threads::coroutines::detail::stack_pool::parameters params;
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            params.enabled =
+                hpx::util::get_entry_as<int>(*sec, "pool", 1) != 0;
+            params.max_local_stacks = hpx::util::get_entry_as<std::size_t>(
+                *sec, "pool_max_local_stacks", params.max_local_stacks);
+            params.max_global_stacks = hpx::util::get_entry_as<std::size_t>(
+                *sec, "pool_max_global_stacks", params.max_global_stacks);
+            params.prefault =
+                hpx::util::get_entry_as<int>(*sec, "pool_prefault", 0) != 0;
+            params.use_huge_pages = hpx::util::get_entry_as<int>(
+                                        *sec, "pool_use_huge_pages", 0) != 0;
+        }
+        return params;
+    }
+
+    bool runtime_configuration::use_stackless_leaf_tasks() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(
+                       *sec, "stackless_leaf_tasks", 0) != 0;
+        }
+        return false;    // default is false
+    }
+
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
     {
         return init_stack_size("small_size",
@@ -70,6 +70,15 @@ namespace hpx::threads::policies {
             scheduler_base::set_scheduler_mode(mode);
         }
 
+        // new threads are created in bulk on the queues of the base
+        // scheduler, consecutive threads targeting the same queue are
+        // created at once
+        void create_thread_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            base_type::create_thread_bulk(data, count, ec);
+        }
+
         // Return the next thread to be executed, return false if none is
         // available
         static constexpr bool get_next_thread(
@@ -0,0 +1,343 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/schedulers/local_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/topology/topology.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::threads::policies {
+
+    namespace detail {
+
+        using deadline_type = std::chrono::steady_clock::time_point;
+
+        // threads without a deadline are run after all threads that have one
+        inline constexpr deadline_type no_deadline = (deadline_type::max)();
+
+        // access the thread stored in an entry of the pending queue
+        inline thread_data* get_queued_thread_data(
+            thread_id_ref_type::thread_repr* thrd) noexcept
+        {
+            return static_cast<thread_data*>(thrd);
+        }
+
+        template <typename ThreadDescription>
+        thread_data* get_queued_thread_data(ThreadDescription* desc) noexcept
+        {
+            return get_thread_id_data(desc->data);
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Earliest deadline first: the queued threads are kept in a binary heap
+    // ordered by their deadline. Threads with the same deadline (including
+    // all threads without a deadline) are handed out in FIFO order.
+    template <typename T>
+    struct deadline_heap_backend
+    {
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        static constexpr bool support_bulk_dequeue = false;
+
+        explicit deadline_heap_backend(size_type initial_size = 0,
+            size_type /* num_thread */ = static_cast<size_type>(-1))
+          : sequence_(0)
+          , earliest_deadline_(detail::no_deadline)
+        {
+            heap_.reserve(static_cast<std::size_t>(initial_size));
+        }
+
+        bool push(const_reference val, bool /*other_end*/ = false)    //-V659
+        {
+            detail::deadline_type const deadline =
+                detail::get_queued_thread_data(val)->get_deadline();
+
+            std::lock_guard<mutex_type> l(mtx_);
+
+            heap_.push_back(entry{deadline, sequence_++, val});
+            std::push_heap(heap_.begin(), heap_.end(), later{});
+
+            earliest_deadline_.store(
+                heap_.front().deadline, std::memory_order_relaxed);
+            return true;
+        }
+
+        bool push(rvalue_reference val, bool other_end = false)    //-V659
+        {
+            return push(static_cast<const_reference>(val), other_end);
+        }
+
+        bool pop(reference val, bool /* steal */ = true) noexcept
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (heap_.empty())
+                return false;
+
+            std::pop_heap(heap_.begin(), heap_.end(), later{});
+            val = heap_.back().value;
+            heap_.pop_back();
+
+            earliest_deadline_.store(
+                heap_.empty() ? detail::no_deadline : heap_.front().deadline,
+                std::memory_order_relaxed);
+            return true;
+        }
+
+        bool empty() noexcept
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return heap_.empty();
+        }
+
+        // Return the earliest deadline of all queued threads. This does not
+        // acquire the lock, thus the returned value might be outdated.
+        detail::deadline_type get_earliest_deadline() const noexcept
+        {
+            return earliest_deadline_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        using mutex_type = hpx::util::spinlock;
+
+        struct entry
+        {
+            detail::deadline_type deadline;
+            std::uint64_t sequence;
+            T value;
+        };
+
+        struct later
+        {
+            bool operator()(entry const& lhs, entry const& rhs) const noexcept
+            {
+                return lhs.deadline > rhs.deadline ||
+                    (lhs.deadline == rhs.deadline &&
+                        lhs.sequence > rhs.sequence);
+            }
+        };
+
+        mutex_type mtx_;
+        std::vector<entry> heap_;
+        std::uint64_t sequence_;
+        std::atomic<detail::deadline_type> earliest_deadline_;
+    };
+
+    struct deadline_heap
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = deadline_heap_backend<T>;
+        };
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    using default_deadline_queue_scheduler_terminated_queue = lockfree_lifo;
+#else
+    using default_deadline_queue_scheduler_terminated_queue = lockfree_fifo;
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The deadline_queue_scheduler maintains exactly one queue of work items
+    /// (threads) per OS thread, just as the local_queue_scheduler. The
+    /// threads in each queue are executed in the order of their deadline
+    /// (earliest deadline first, see thread_init_data::deadline), threads
+    /// without a deadline are executed after all threads that have one. An
+    /// idle OS thread steals from the queue holding the thread with the least
+    /// slack (i.e. the earliest deadline) first.
+    template <typename Mutex = std::mutex,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing =
+            default_deadline_queue_scheduler_terminated_queue>
+    class deadline_queue_scheduler final
+      : public local_queue_scheduler<Mutex, deadline_heap, StagedQueuing,
+            TerminatedQueuing>
+    {
+    public:
+        using base_type = local_queue_scheduler<Mutex, deadline_heap,
+            StagedQueuing, TerminatedQueuing>;
+        using thread_queue_type = typename base_type::thread_queue_type;
+        using init_parameter_type = typename base_type::init_parameter_type;
+
+        explicit deadline_queue_scheduler(init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+          , deadline_misses_(init.num_queues_)
+        {
+        }
+
+        static std::string_view get_scheduler_name()
+        {
+            return "deadline_queue_scheduler";
+        }
+
+        std::int64_t get_num_deadline_misses(
+            std::size_t num_thread, bool reset) override
+        {
+            if (num_thread == static_cast<std::size_t>(-1))
+            {
+                std::int64_t result = 0;
+                for (auto& misses : deadline_misses_)
+                {
+                    result += util::get_and_reset_value(misses.data_, reset);
+                }
+                return result;
+            }
+
+            HPX_ASSERT(num_thread < deadline_misses_.size());
+            return util::get_and_reset_value(
+                deadline_misses_[num_thread].data_, reset);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // create a new thread and schedule it if the initial state is equal to
+        // pending
+        void create_thread(thread_init_data& data, thread_id_ref_type* id,
+            error_code& ec) override
+        {
+            // threads with a deadline bypass the staged queue, this makes sure
+            // they are ordered by their deadline right away
+            if (data.deadline != detail::no_deadline &&
+                data.initial_state == thread_schedule_state::pending)
+            {
+                data.run_now = true;
+            }
+            base_type::create_thread(data, id, ec);
+        }
+
+        void create_thread_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                if (data[i].deadline != detail::no_deadline)
+                    data[i].run_now = true;
+            }
+            base_type::create_thread_bulk(data, count, ec);
+        }
+
+        // Return the next thread to be executed, return false if none is
+        // available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_id_ref_type& thrd, bool enable_stealing)
+        {
+            HPX_ASSERT(num_thread < this->queues_.size());
+
+            // if this queue has run dry, steal the most urgent thread first
+            if (running && enable_stealing &&
+                this->queues_[num_thread]->get_queue_length(
+                    std::memory_order_relaxed) == 0 &&
+                steal_least_slack(num_thread, thrd))
+            {
+                return true;
+            }
+
+            return base_type::get_next_thread(
+                num_thread, running, thrd, enable_stealing);
+        }
+
+        // Destroy the passed thread as it has been terminated
+        void destroy_thread(threads::thread_data* thrd) override
+        {
+            detail::deadline_type const deadline = thrd->get_deadline();
+            if (deadline != detail::no_deadline &&
+                std::chrono::steady_clock::now() > deadline)
+            {
+                std::size_t num_thread =
+                    hpx::threads::detail::get_local_thread_num_tss();
+                if (num_thread >= deadline_misses_.size())
+                    num_thread = 0;
+
+                deadline_misses_[num_thread].data_.fetch_add(
+                    1, std::memory_order_relaxed);
+            }
+
+            base_type::destroy_thread(thrd);
+        }
+
+    private:
+        // Steal from the queue whose pending thread with the earliest deadline
+        // has the least slack left
+        bool steal_least_slack(
+            std::size_t num_thread, threads::thread_id_ref_type& thrd)
+        {
+            std::size_t const queues_size = this->queues_.size();
+
+            bool const numa_stealing = this->has_scheduler_mode(
+                policies::scheduler_mode::enable_stealing_numa);
+            mask_cref_type numa_domain = this->numa_domain_masks_[num_thread];
+
+            auto victim = static_cast<std::size_t>(-1);
+            detail::deadline_type earliest = detail::no_deadline;
+            for (std::size_t i = 1; i != queues_size; ++i)
+            {
+                std::size_t const idx = (i + num_thread) % queues_size;
+                if (!numa_stealing &&
+                    !test(numa_domain,
+                        this->affinity_data_.get_pu_num(idx)))    //-V600
+                {
+                    continue;
+                }
+
+                detail::deadline_type const deadline =
+                    this->queues_[idx]
+                        ->get_pending_queue()
+                        .get_earliest_deadline();
+                if (deadline < earliest)
+                {
+                    earliest = deadline;
+                    victim = idx;
+                }
+            }
+
+            if (victim == static_cast<std::size_t>(-1))
+                return false;
+
+            thread_queue_type* q = this->queues_[victim];
+            if (q->get_next_thread(thrd, true))
+            {
+                q->increment_num_stolen_from_pending();
+                this->queues_[num_thread]->increment_num_stolen_to_pending();
+                return true;
+            }
+            return false;
+        }
+
+        std::vector<util::cache_line_data<std::atomic<std::int64_t>>>
+            deadline_misses_;
+    };
+}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -653,6 +653,72 @@ namespace hpx::threads::policies {
             }
         }
 
+        // create a number of new threads at once, the threads without a
+        // schedule hint are distributed in contiguous chunks over all queues
+        void create_thread_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            std::size_t const first_queue = curr_queue_.fetch_add(num_queues_);
+
+            detail::create_thread_bulk(
+                data, count,
+                [&](thread_init_data& d,
+                    std::size_t i) -> thread_queue_type* {
+                    // NOTE: This scheduler ignores NUMA hints.
+                    std::size_t num_thread = d.schedulehint.mode ==
+                            thread_schedule_hint_mode::thread ?
+                        d.schedulehint.hint :
+                        static_cast<std::size_t>(-1);
+
+                    if (static_cast<std::size_t>(-1) == num_thread)
+                    {
+                        num_thread = first_queue + (i * num_queues_) / count;
+                    }
+                    num_thread = select_active_pu(num_thread % num_queues_);
+
+                    d.schedulehint.mode = thread_schedule_hint_mode::thread;
+                    d.schedulehint.hint = static_cast<std::int16_t>(num_thread);
+
+                    switch (d.priority)
+                    {
+                    case thread_priority::boost:
+                        d.priority = thread_priority::normal;
+                        [[fallthrough]];
+                    case thread_priority::high_recursive:
+                        [[fallthrough]];
+                    case thread_priority::high:
+                        return high_priority_queues_
+                            [num_thread % num_high_priority_queues_]
+                                .data_;
+
+                    case thread_priority::low:
+                        return &low_priority_queue_;
+
+                    case thread_priority::bound:
+                        return bound_queues_[num_thread].data_;
+
+                    case thread_priority::default_:
+                        [[fallthrough]];
+                    case thread_priority::normal:
+                        return queues_[num_thread].data_;
+
+                    case thread_priority::unknown:
+                        break;
+                    }
+
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "local_priority_queue_scheduler::create_thread_bulk",
+                        "unknown thread priority value "
+                        "(thread_priority::unknown)");
+                },
+                ec);
+
+            LTM_(debug).format(
+                "local_priority_queue_scheduler::create_thread_bulk: "
+                "pool({}), scheduler({}), count({})",
+                *this->get_parent_pool(), *this, count);
+        }
+
         bool attempt_stealing_pending(std::size_t num_thread,
             threads::thread_id_ref_type& thrd,
             [[maybe_unused]] thread_queue_type* this_high_priority_queue,
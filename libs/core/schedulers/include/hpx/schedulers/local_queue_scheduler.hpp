@@ -322,6 +322,37 @@ namespace hpx::threads::policies {
                 ;
         }
 
+        // create a number of new threads at once, the threads without a
+        // schedule hint are distributed in contiguous chunks over all queues
+        void create_thread_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            std::size_t const queue_size = queues_.size();
+            std::size_t const first_queue = curr_queue_.fetch_add(queue_size);
+
+            detail::create_thread_bulk(
+                data, count,
+                [&](thread_init_data const& d, std::size_t i) {
+                    std::size_t num_thread = d.schedulehint.mode ==
+                            thread_schedule_hint_mode::thread ?
+                        d.schedulehint.hint :
+                        static_cast<std::size_t>(-1);
+
+                    if (static_cast<std::size_t>(-1) == num_thread)
+                    {
+                        num_thread = first_queue + (i * queue_size) / count;
+                    }
+
+                    return queues_[select_active_pu(num_thread % queue_size)];
+                },
+                ec);
+
+            LTM_(debug).format(
+                "local_queue_scheduler::create_thread_bulk: pool({}), "
+                "scheduler({}), count({})",
+                *this->get_parent_pool(), *this, count);
+        }
+
         // Return the next thread to be executed, return false if none is
         // available
         bool get_next_thread(std::size_t num_thread, bool running,
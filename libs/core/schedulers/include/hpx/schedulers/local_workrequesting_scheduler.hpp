@@ -20,7 +20,9 @@
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
+#include <hpx/topology/topology.hpp>
 #include <hpx/type_support/unused.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 
 #include <algorithm>
 #include <atomic>
@@ -87,6 +89,11 @@
 // case tasks do not need to be copied. While steal-half is important to tackle
 // fine-grained parallelism, polling is necessary to achieve short message
 // handling delays when workers schedule long-running tasks.
+//
+// Steal-half hands over half of the victim's pending threads and half of its
+// staged tasks (the latter are moved directly into the thief's staged queue).
+// Victims are selected randomly, preferring the workers located on the NUMA
+// domain of the thief.
 
 namespace hpx::threads::policies {
 
@@ -300,6 +307,15 @@ namespace hpx::threads::policies {
             std::uint16_t num_recent_tasks_executed_ = 0;
             bool stealhalf_ = true;
 
+            // the other cores located on the NUMA domain of this core, these
+            // are preferred as victims
+            std::vector<std::uint16_t> numa_neighbors_;
+
+            // number of steal requests satisfied by this core and the number
+            // of tasks sent in response
+            std::atomic<std::int64_t> steal_requests_satisfied_ = 0;
+            std::atomic<std::int64_t> tasks_sent_ = 0;
+
 #if defined(HPX_HAVE_WORKREQUESTING_LAST_VICTIM)
             // core number the last stolen tasks originated from
             std::uint16_t last_victim_ = static_cast<std::uint16_t>(-1);
@@ -617,6 +633,44 @@ namespace hpx::threads::policies {
         }
 #endif
 
+        std::int64_t get_num_steal_requests_satisfied(
+            std::size_t num_thread, bool reset) override
+        {
+            if (num_thread == static_cast<std::size_t>(-1))
+            {
+                std::int64_t count = 0;
+                for (auto& d : data_)
+                {
+                    count += util::get_and_reset_value(
+                        d.data_.steal_requests_satisfied_, reset);
+                }
+                return count;
+            }
+
+            HPX_ASSERT(num_thread < num_queues_);
+            return util::get_and_reset_value(
+                data_[num_thread].data_.steal_requests_satisfied_, reset);
+        }
+
+        std::int64_t get_num_steal_requests_tasks_sent(
+            std::size_t num_thread, bool reset) override
+        {
+            if (num_thread == static_cast<std::size_t>(-1))
+            {
+                std::int64_t count = 0;
+                for (auto& d : data_)
+                {
+                    count +=
+                        util::get_and_reset_value(d.data_.tasks_sent_, reset);
+                }
+                return count;
+            }
+
+            HPX_ASSERT(num_thread < num_queues_);
+            return util::get_and_reset_value(
+                data_[num_thread].data_.tasks_sent_, reset);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         void abort_all_suspended_threads() override
         {
@@ -744,6 +798,65 @@ namespace hpx::threads::policies {
             }
         }
 
+        // create a number of new threads at once, the threads without a
+        // schedule hint are distributed in contiguous chunks over all queues
+        void create_thread_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            std::size_t const first_queue = curr_queue_.fetch_add(num_queues_);
+
+            detail::create_thread_bulk(
+                data, count,
+                [&](thread_init_data& d,
+                    std::size_t i) -> thread_queue_type* {
+                    std::size_t num_thread = d.schedulehint.mode ==
+                            thread_schedule_hint_mode::thread ?
+                        d.schedulehint.hint :
+                        static_cast<std::size_t>(-1);
+
+                    if (static_cast<std::size_t>(-1) == num_thread)
+                    {
+                        num_thread = first_queue + (i * num_queues_) / count;
+                    }
+                    num_thread = select_active_pu(num_thread % num_queues_);
+
+                    d.schedulehint.mode = thread_schedule_hint_mode::thread;
+                    d.schedulehint.hint = static_cast<std::int16_t>(num_thread);
+
+                    switch (d.priority)
+                    {
+                    case thread_priority::boost:
+                        d.priority = thread_priority::normal;
+                        [[fallthrough]];
+                    case thread_priority::high_recursive:
+                        [[fallthrough]];
+                    case thread_priority::high:
+                        return data_[num_thread % num_high_priority_queues_]
+                            .data_.high_priority_queue_;
+
+                    case thread_priority::low:
+                        return &low_priority_queue_;
+
+                    case thread_priority::bound:
+                        return data_[num_thread].data_.bound_queue_;
+
+                    case thread_priority::default_:
+                        [[fallthrough]];
+                    case thread_priority::normal:
+                        return data_[num_thread].data_.queue_;
+
+                    case thread_priority::unknown:
+                        break;
+                    }
+
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "local_workrequesting_scheduler::create_thread_bulk",
+                        "unknown thread priority value "
+                        "(thread_priority::unknown)");
+                },
+                ec);
+        }
+
         // Retrieve the next viable steal request from our channel
         bool try_receiving_steal_request(
             scheduler_data& d, steal_request& req) noexcept
@@ -872,40 +985,62 @@ namespace hpx::threads::policies {
                     2;
             }
 
+            task_data thrds(d.num_thread_);
             if (max_num_to_steal != 0)
             {
-                task_data thrds(d.num_thread_);
-                thrds.tasks_.reserve(max_num_to_steal);
+                thrds.tasks_.resize(max_num_to_steal);
+
+                std::size_t const num_stolen = d.queue_->get_next_threads(
+                    thrds.tasks_.begin(), max_num_to_steal, false, true);
+                thrds.tasks_.resize(num_stolen);
 
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
-                thread_id_ref_type thrd;
-                while (max_num_to_steal-- != 0 &&
-                    d.queue_->get_next_thread(thrd, false, true))
-                {
-                    d.queue_->increment_num_stolen_from_pending();
-                    thrds.tasks_.push_back(HPX_MOVE(thrd));
-                    thrd = thread_id_ref_type{};
-                }
-#else
-                d.queue_->get_next_threads(
-                    thrds.tasks_.begin(), thrds.tasks_.size(), false, true);
+                d.queue_->increment_num_stolen_from_pending(num_stolen);
 #endif
+            }
 
-                // we are ready to send at least one task
-                if (!thrds.tasks_.empty())
+            // steal-half also hands over half of our staged tasks, those are
+            // moved directly to the staged queue of the requesting core
+            std::int64_t num_staged = 0;
+            if (req.stealhalf_)
+            {
+                num_staged = d.queue_->get_staged_queue_length(
+                                 std::memory_order_relaxed) /
+                    2;
+                if (num_staged != 0)
                 {
-                    // send these tasks to the core that has sent the steal
-                    // request
-                    req.channel_->set(HPX_MOVE(thrds));
-
-                    // wake the thread up so that it can pick up the stolen
-                    // tasks
-                    do_some_work(req.num_thread_);
+                    thread_queue_type* thief_queue =
+                        data_[req.num_thread_].data_.queue_;
+                    num_staged =
+                        thief_queue->move_task_items_from(d.queue_, num_staged);
 
-                    return true;
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                    d.queue_->increment_num_stolen_from_staged(num_staged);
+                    thief_queue->increment_num_stolen_to_staged(num_staged);
+#endif
                 }
             }
 
+            // we are ready to send at least one task
+            if (!thrds.tasks_.empty() || num_staged != 0)
+            {
+                d.steal_requests_satisfied_.fetch_add(
+                    1, std::memory_order_relaxed);
+                d.tasks_sent_.fetch_add(
+                    static_cast<std::int64_t>(thrds.tasks_.size()) + num_staged,
+                    std::memory_order_relaxed);
+
+                // send these tasks to the core that has sent the steal request
+                // (the task list might be empty if only staged tasks were
+                // handed over)
+                req.channel_->set(HPX_MOVE(thrds));
+
+                // wake the thread up so that it can pick up the stolen tasks
+                do_some_work(req.num_thread_);
+
+                return true;
+            }
+
             // There's nothing we can do with this steal request except pass
             // it on to a different worker
             decline_or_forward_steal_request(d, req);
@@ -1454,11 +1589,32 @@ namespace hpx::threads::policies {
         }
 #endif
 
-        // return a random victim for the current stealing operation
+        // return a random victim for the current stealing operation, prefer
+        // cores located on the NUMA domain of the thief
         std::size_t random_victim(steal_request const& req) noexcept
         {
             std::size_t result;
 
+            auto const& neighbors =
+                data_[req.num_thread_].data_.numa_neighbors_;
+            if (!neighbors.empty() && neighbors.size() != num_queues_ - 1)
+            {
+                // start at a random position to spread the requests
+                std::uniform_int_distribution<std::size_t> uniform(
+                    0, neighbors.size() - 1);
+
+                std::size_t const start = uniform(gen_);
+                for (std::size_t i = 0; i != neighbors.size(); ++i)
+                {
+                    result = neighbors[(start + i) % neighbors.size()];
+                    if (!test(req.victims_, result))
+                    {
+                        HPX_ASSERT(result < num_queues_);
+                        return result;
+                    }
+                }
+            }
+
             {
                 // generate at most 3 random numbers before resorting to more
                 // expensive algorithm
@@ -1659,6 +1815,15 @@ namespace hpx::threads::policies {
                     ++d.num_recent_steals_;
                     return true;
                 }
+
+                // the victim might have handed over staged tasks only, those
+                // will be converted by the next call to wait_or_add_new
+                if (d.queue_->get_staged_queue_length(
+                        std::memory_order_relaxed) != 0)
+                {
+                    ++d.num_recent_steals_;
+                    return true;
+                }
             }
             return false;
         }
@@ -1789,6 +1954,21 @@ namespace hpx::threads::policies {
             resize(d.victims_, num_queues_);
             reset(d.victims_);
             set(d.victims_, num_thread);
+
+            // collect the cores sharing the NUMA domain with this core
+            auto const& topo = create_topology();
+            mask_cref_type node_mask = topo.get_numa_node_affinity_mask(
+                affinity_data_.get_pu_num(num_thread));
+
+            d.numa_neighbors_.clear();
+            for (std::size_t i = 0; i != num_queues_; ++i)
+            {
+                if (i != num_thread &&
+                    test(node_mask, affinity_data_.get_pu_num(i)))
+                {
+                    d.numa_neighbors_.push_back(static_cast<std::uint16_t>(i));
+                }
+            }
         }
 
         void on_stop_thread(std::size_t num_thread) override
@@ -11,9 +11,11 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/schedulers/deadlock_detection.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
@@ -134,5 +136,35 @@ namespace hpx::threads::policies {
             return result;
 #endif
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Hand the given threads to the queues selected by get_queue, all
+        // consecutive threads that go to the same queue are created by a
+        // single call to create_thread_bulk on that queue. Additional
+        // arguments are passed through to the queues.
+        template <typename GetQueue, typename... Ts>
+        void create_thread_bulk(thread_init_data* data, std::size_t count,
+            GetQueue&& get_queue, error_code& ec, Ts const&... ts)
+        {
+            if (count == 0)
+                return;
+
+            std::size_t first = 0;
+            auto* queue = get_queue(data[0], 0);
+            for (std::size_t i = 1; i <= count; ++i)
+            {
+                auto* next = i != count ? get_queue(data[i], i) : nullptr;
+                if (next != queue)
+                {
+                    queue->create_thread_bulk(
+                        data + first, i - first, ts..., ec);
+                    if (&ec != &throws && ec)
+                        return;
+
+                    first = i;
+                    queue = next;
+                }
+            }
+        }
     }    // namespace detail
 }    // namespace hpx::threads::policies
@@ -10,6 +10,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/debugging/print.hpp>
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/schedulers/queue_helpers.hpp>
 #include <hpx/threading_base/print.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -386,8 +387,8 @@ namespace hpx::threads::policies {
         }
 
         // ----------------------------------------------------------------
-        void create_thread(thread_init_data& data, thread_id_ref_type* tid,
-            std::size_t thread_num, error_code& ec)
+        // select the queue a new thread is created on using its priority
+        QueueType* select_queue(thread_init_data& data, std::size_t thread_num)
         {
             if (thread_num != thread_num_ &&
                 (data.initial_state == thread_schedule_state::pending ||
@@ -396,20 +397,19 @@ namespace hpx::threads::policies {
                 data.run_now = false;
             }
 
-            // create the thread using priority to select queue
             if (data.priority == thread_priority::normal)
             {
                 tq_deb.debug(debug::str<>("create_thread "),
                     queue_data_print(this), "thread_priority::normal",
                     "run_now ", data.run_now);
-                return np_queue_->create_thread(data, tid, ec);
+                return np_queue_;
             }
             else if (bp_queue_ && (data.priority == thread_priority::bound))
             {
                 tq_deb.debug(debug::str<>("create_thread "),
                     queue_data_print(this), "thread_priority::bound",
                     "run_now ", data.run_now);
-                return bp_queue_->create_thread(data, tid, ec);
+                return bp_queue_;
             }
             else if (hp_queue_ &&
                 (data.priority == thread_priority::high ||
@@ -424,20 +424,39 @@ namespace hpx::threads::policies {
                 tq_deb.debug(debug::str<>("create_thread "),
                     queue_data_print(this), "thread_priority::high", "run_now ",
                     data.run_now);
-                return hp_queue_->create_thread(data, tid, ec);
+                return hp_queue_;
             }
             else if (lp_queue_ && (data.priority == thread_priority::low))
             {
                 tq_deb.debug(debug::str<>("create_thread "),
                     queue_data_print(this), "thread_priority::low", "run_now ",
                     data.run_now);
-                return lp_queue_->create_thread(data, tid, ec);
+                return lp_queue_;
             }
 
             tq_deb.error(debug::str<>("create_thread "), "priority?");
             std::terminate();
         }
 
+        void create_thread(thread_init_data& data, thread_id_ref_type* tid,
+            std::size_t thread_num, error_code& ec)
+        {
+            select_queue(data, thread_num)->create_thread(data, tid, ec);
+        }
+
+        // create a number of new threads at once, all consecutive threads
+        // with the same priority are handed to their queue at once
+        void create_thread_bulk(thread_init_data* data, std::size_t count,
+            std::size_t thread_num, error_code& ec)
+        {
+            detail::create_thread_bulk(
+                data, count,
+                [&](thread_init_data& d, std::size_t) {
+                    return select_queue(d, thread_num);
+                },
+                ec);
+        }
+
         // ----------------------------------------------------------------
         // Not thread safe. This function must only be called by the thread that
         // owns the holder object. Creates a thread_data object using
@@ -12,11 +12,13 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/debugging/print.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/queue_holder_numa.hpp>
+#include <hpx/schedulers/queue_helpers.hpp>
 #include <hpx/schedulers/queue_holder_thread.hpp>
 #include <hpx/schedulers/thread_queue_mc.hpp>
 #include <hpx/threading_base/print.hpp>
@@ -25,6 +27,7 @@
 #include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/topology/topology.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 
 #include <array>
 #include <atomic>
@@ -103,6 +106,11 @@ namespace hpx::threads::policies {
     // the shared_priority_queue_scheduler is NUMA-aware and takes NUMA
     // scheduling hints into account when creating and scheduling work.
     //
+    // Idle worker threads steal work in widening rings: first from the queues
+    // of the cores sharing the same (last level) cache, then from the
+    // remaining queues on the same NUMA domain, and finally from the queues
+    // on other NUMA domains (the ones located on the same socket first).
+    //
     // Warning: PendingQueuing lifo causes lockup on termination
     template <typename Mutex = std::mutex,
         typename PendingQueuing = concurrentqueue_fifo,
@@ -170,6 +178,11 @@ namespace hpx::threads::policies {
           , debug_init_(false)
           , thread_init_counter_(0)
           , pool_index_(static_cast<std::size_t>(-1))
+          , min_tasks_to_steal_{
+                init.thread_queue_init_.min_tasks_to_steal_core_group_,
+                init.thread_queue_init_.min_tasks_to_steal_numa_domain_,
+                init.thread_queue_init_.min_tasks_to_steal_remote_}
+          , steal_rings_(init.num_worker_threads_)
         {
             scheduler_base::set_scheduler_mode(scheduler_mode::default_);
             HPX_ASSERT(num_workers_ != 0);
@@ -296,10 +309,12 @@ namespace hpx::threads::policies {
         }
 
         // ------------------------------------------------------------
-        // create a new thread and schedule it if the initial state is equal to
-        // pending
-        void create_thread(thread_init_data& data, thread_id_ref_type* thrd,
-            error_code& ec) override
+        // Select the queue holder a new thread is created on. If given,
+        // next_worker overrides the worker selected for threads without a
+        // schedule hint.
+        thread_holder_type* select_holder(thread_init_data& data,
+            std::size_t local_num,
+            std::size_t next_worker = static_cast<std::size_t>(-1))
         {
             // safety check that task was created by this thread/scheduler
             HPX_ASSERT(data.scheduler_base == this);
@@ -309,8 +324,6 @@ namespace hpx::threads::policies {
             HPX_ASSERT(data.schedulehint.runs_as_child_mode() ==
                 hpx::threads::thread_execution_hint::none);
 
-            std::size_t const local_num = local_thread_number();
-
             std::size_t thread_num = local_num;
             std::size_t domain_num;
             std::size_t q_index;
@@ -324,7 +337,12 @@ namespace hpx::threads::policies {
             {
                 spq_deb.set(msg, "HINT_NONE  ");
                 // Create thread on this worker thread if possible
-                if (local_num == static_cast<std::size_t>(-1))
+                if (next_worker != static_cast<std::size_t>(-1))
+                {
+                    // the worker was selected by the caller
+                    thread_num = next_worker;
+                }
+                else if (local_num == static_cast<std::size_t>(-1))
                 {
                     // clang-format off
                     using namespace hpx::threads::detail;
@@ -459,15 +477,108 @@ namespace hpx::threads::policies {
                     , debug::threadinfo<thread_init_data>(data));
                 // clang-format on
             }
-            numa_holder_[domain_num]
-                .thread_queue(static_cast<std::size_t>(q_index))
+            return numa_holder_[domain_num].thread_queue(
+                static_cast<std::size_t>(q_index));
+        }
+
+        // ------------------------------------------------------------
+        // create a new thread and schedule it if the initial state is equal to
+        // pending
+        void create_thread(thread_init_data& data, thread_id_ref_type* thrd,
+            error_code& ec) override
+        {
+            std::size_t const local_num = local_thread_number();
+            select_holder(data, local_num)
                 ->create_thread(data, thrd, local_num, ec);
         }
 
+        // ------------------------------------------------------------
+        // create a number of new threads at once, all consecutive threads
+        // which end up on the same queue holder are handed to it at once.
+        // Threads without a schedule hint which would otherwise be assigned
+        // in a round robin fashion are distributed in contiguous chunks over
+        // all workers.
+        void create_thread_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            if (count == 0)
+                return;
+
+            std::size_t const local_num = local_thread_number();
+            bool const distribute =
+                round_robin_ || local_num == static_cast<std::size_t>(-1);
+            std::size_t const first_worker = distribute ?
+                numa_holder_[0].thread_queue(0)->worker_next(num_workers_) :
+                0;
+
+            detail::create_thread_bulk(
+                data, count,
+                [&](thread_init_data& d, std::size_t i) {
+                    std::size_t next_worker = static_cast<std::size_t>(-1);
+                    if (distribute)
+                    {
+                        next_worker =
+                            (first_worker + (i * num_workers_) / count) %
+                            num_workers_;
+                    }
+                    return select_holder(d, local_num, next_worker);
+                },
+                ec, local_num);
+        }
+
+        // Try to steal from the victims of the given ring of this thread,
+        // skipping all queues which do not hold enough tasks
         template <typename T>
-        bool steal_by_function(std::size_t domain, std::size_t q_index,
-            bool steal_numa, bool steal_core, thread_holder_type* origin,
-            T& var, char const* prefix,
+        bool steal_from_ring(std::size_t this_thread, std::size_t ring,
+            thread_holder_type* origin, T& var,
+            hpx::function<bool(
+                std::size_t, std::size_t, thread_holder_type*, T&, bool, bool)>
+                const& operation)
+        {
+            steal_rings& rings = steal_rings_[this_thread];
+            std::int64_t const min_tasks = min_tasks_to_steal_[ring];
+
+            for (steal_victim const& v : rings.victims_[ring])
+            {
+                if (static_cast<std::int64_t>(
+                        numa_holder_[v.domain].queues_[v.q_index]
+                            ->get_queue_length()) < min_tasks)
+                {
+                    continue;
+                }
+
+                if (operation(v.domain, v.q_index, origin, var, true, false))
+                {
+                    rings.stolen_[ring].fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template <typename T>
+        bool steal_from_rings(std::size_t this_thread, bool steal_numa,
+            thread_holder_type* origin, T& var,
+            hpx::function<bool(
+                std::size_t, std::size_t, thread_holder_type*, T&, bool, bool)>
+                const& operation)
+        {
+            for (std::size_t ring = 0; ring != num_steal_rings; ++ring)
+            {
+                // if no numa stealing, skip other domains
+                if (ring == steal_ring_remote && !steal_numa)
+                    break;
+
+                if (steal_from_ring(this_thread, ring, origin, var, operation))
+                    return true;
+            }
+            return false;
+        }
+
+        template <typename T>
+        bool steal_by_function(std::size_t this_thread, bool steal_numa,
+            bool steal_core, thread_holder_type* origin, T& var,
+            char const* prefix,
             hpx::function<bool(
                 std::size_t, std::size_t, thread_holder_type*, T&, bool, bool)>
                 operation_HP,
@@ -475,14 +586,16 @@ namespace hpx::threads::policies {
                 std::size_t, std::size_t, thread_holder_type*, T&, bool, bool)>
                 operation)
         {
-            bool result;
+            std::size_t const domain = d_lookup_[this_thread];
+            std::size_t const q_index = q_lookup_[this_thread];
+
+            // try only the queues on this thread, in order BP,HP,NP,LP
+            bool result =
+                operation_HP(domain, q_index, origin, var, false, false);
 
             // All stealing disabled
             if (!steal_core)
             {
-                // try only the queues on this thread, in order BP,HP,NP,LP
-                result =
-                    operation_HP(domain, q_index, origin, var, false, false);
                 result = result ||
                     operation(domain, q_index, origin, var, false, false);
                 if (result)
@@ -496,48 +609,32 @@ namespace hpx::threads::policies {
             // High priority tasks first
             else if (steal_hp_first_)
             {
-                for (std::size_t d = 0; d < num_domains_; ++d)
+                result = result ||
+                    steal_from_rings(
+                        this_thread, steal_numa, origin, var, operation_HP);
+                if (result)
                 {
-                    std::size_t dom = fast_mod(domain + d, num_domains_);
-                    q_index = fast_mod(q_index, q_counts_[dom]);
-                    result =
-                        operation_HP(dom, q_index, origin, var, (d > 0), true);
-                    if (result)
-                    {
-                        spq_deb.debug(debug::str<>(prefix),
-                            "steal_high_priority_first BP/HP",
-                            (d == 0 ? "taken" : "stolen"), "D",
-                            debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
-                        return result;
-                    }
-                    // if no numa stealing, skip other domains
-                    if (!steal_numa)
-                        break;
+                    spq_deb.debug(debug::str<>(prefix),
+                        "steal_high_priority_first BP/HP", "D",
+                        debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
+                    return result;
                 }
-                for (std::size_t d = 0; d < num_domains_; ++d)
+
+                result =
+                    operation(domain, q_index, origin, var, false, false) ||
+                    steal_from_rings(
+                        this_thread, steal_numa, origin, var, operation);
+                if (result)
                 {
-                    std::size_t dom = fast_mod(domain + d, num_domains_);
-                    q_index = fast_mod(q_index, q_counts_[dom]);
-                    result =
-                        operation(dom, q_index, origin, var, (d > 0), true);
-                    if (result)
-                    {
-                        spq_deb.debug(debug::str<>(prefix),
-                            "steal_high_priority_first NP/LP",
-                            (d == 0 ? "taken" : "stolen"), "D",
-                            debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
-                        return result;
-                    }
-                    // if no numa stealing, skip other domains
-                    if (!steal_numa)
-                        break;
+                    spq_deb.debug(debug::str<>(prefix),
+                        "steal_high_priority_first NP/LP", "D",
+                        debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
+                    return result;
                 }
             }
             else /*steal_after_local*/
             {
                 // do this local core/queue
-                result =
-                    operation_HP(domain, q_index, origin, var, false, false);
                 result = result ||
                     operation(domain, q_index, origin, var, false, false);
                 if (result)
@@ -548,59 +645,26 @@ namespace hpx::threads::policies {
                     return result;
                 }
 
-                if (q_counts_[domain] > 1)
+                // steal from the rings of victims in order, BP/HP first
+                for (std::size_t ring = 0; ring != num_steal_rings; ++ring)
                 {
-                    // steal from other cores on this numa domain?
-                    // use q+1 to avoid testing the same local queue again
-                    q_index = fast_mod((q_index + 1), q_counts_[domain]);
-                    result =
-                        operation_HP(domain, q_index, origin, var, true, true);
-                    result = result ||
-                        operation(domain, q_index, origin, var, true, true);
+                    // if no numa stealing, skip other domains
+                    if (ring == steal_ring_remote && !steal_numa)
+                        break;
+
+                    result = steal_from_ring(this_thread, ring, origin, var,
+                                 operation_HP) ||
+                        steal_from_ring(
+                            this_thread, ring, origin, var, operation);
                     if (result)
                     {
                         spq_deb.debug(debug::str<>(prefix),
-                            "steal_after_local this numa", "stolen", "D",
-                            debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
+                            "steal_after_local stolen", "ring",
+                            debug::dec<1>(ring), "D", debug::dec<2>(domain),
+                            "Q", debug::dec<3>(q_index));
                         return result;
                     }
                 }
-
-                if (steal_numa)
-                {
-                    // try other numa domains BP/HP
-                    for (std::size_t d = 1; d < num_domains_; ++d)
-                    {
-                        std::size_t dom = fast_mod(domain + d, num_domains_);
-                        q_index = fast_mod(q_index, q_counts_[dom]);
-                        result =
-                            operation_HP(dom, q_index, origin, var, true, true);
-                        if (result)
-                        {
-                            spq_deb.debug(debug::str<>(prefix),
-                                "steal_after_local other numa BP/HP", "stolen",
-                                "D", debug::dec<2>(domain), "Q",
-                                debug::dec<3>(q_index));
-                            return result;
-                        }
-                    }
-                    // try other numa domains NP/LP
-                    for (std::size_t d = 1; d < num_domains_; ++d)
-                    {
-                        std::size_t dom = fast_mod(domain + d, num_domains_);
-                        q_index = fast_mod(q_index, q_counts_[dom]);
-                        result =
-                            operation(dom, q_index, origin, var, true, true);
-                        if (result)
-                        {
-                            spq_deb.debug(debug::str<>(prefix),
-                                "steal_after_local other numa NP/LP", "stolen",
-                                "D", debug::dec<2>(domain), "Q",
-                                debug::dec<3>(q_index));
-                            return result;
-                        }
-                    }
-                }
             }
             return false;
         }
@@ -636,16 +700,13 @@ namespace hpx::threads::policies {
                         q_index, th, stealing, allow_stealing);
                 };
 
-            std::size_t domain = d_lookup_[this_thread];
-            std::size_t q_index = q_lookup_[this_thread];
-
             // first try a high priority task, allow stealing if stealing of HP
             // tasks in on, this will be fine but send a null function for
             // normal tasks
 
             if (bool const result =
-                    steal_by_function<threads::thread_id_ref_type>(domain,
-                        q_index, numa_stealing_, core_stealing_, nullptr, thrd,
+                    steal_by_function<threads::thread_id_ref_type>(this_thread,
+                        numa_stealing_, core_stealing_, nullptr, thrd,
                         "SBF-get_next_thread", get_next_thread_function_HP,
                         get_next_thread_function))
             {
@@ -704,9 +765,10 @@ namespace hpx::threads::policies {
                 q_index, "numa_stealing ", numa_stealing_, "core_stealing ",
                 core_stealing_);
 
-            bool const added_tasks = steal_by_function<std::size_t>(domain,
-                q_index, numa_stealing_, core_stealing_, receiver, added,
-                "wait_or_add_new", add_new_function_HP, add_new_function);
+            bool const added_tasks =
+                steal_by_function<std::size_t>(this_thread, numa_stealing_,
+                    core_stealing_, receiver, added, "wait_or_add_new",
+                    add_new_function_HP, add_new_function);
 
             return !added_tasks;
         }
@@ -1213,6 +1275,10 @@ namespace hpx::threads::policies {
                 std::this_thread::yield();
             }
 
+            // all queues are known now, set up the rings of victims this
+            // thread will steal from
+            init_steal_rings(local_thread);
+
             lock.lock();
             if (!debug_init_)
             {
@@ -1231,6 +1297,74 @@ namespace hpx::threads::policies {
             }
         }
 
+        // Sort all queues this thread may steal from into rings of
+        // increasing distance
+        void init_steal_rings(std::size_t local_thread)
+        {
+            auto const& topo = create_topology();
+            auto get_pu_num = [this](std::size_t local_id) {
+                return affinity_data_.get_pu_num(
+                    local_to_global_thread_index(local_id));
+            };
+
+            std::size_t const domain = d_lookup_[local_thread];
+            std::size_t const q_index = q_lookup_[local_thread];
+            std::size_t const pu_num = get_pu_num(local_thread);
+            std::size_t const cache_group = topo.get_cache_group_number(pu_num);
+            std::size_t const socket = topo.get_socket_number(pu_num);
+
+            auto& victims = steal_rings_[local_thread].victims_;
+            for (auto& ring : victims)
+                ring.clear();
+
+            // the other queues on this NUMA domain, starting with our neighbor
+            for (std::size_t i = 1; i < q_counts_[domain]; ++i)
+            {
+                std::size_t const q = fast_mod(q_index + i, q_counts_[domain]);
+                std::size_t const pu =
+                    get_pu_num(numa_holder_[domain].queues_[q]->thread_num_);
+
+                if (topo.get_cache_group_number(pu) == cache_group)
+                {
+                    victims[steal_ring_core_group].push_back({domain, q});
+                }
+                else
+                {
+                    victims[steal_ring_numa_domain].push_back({domain, q});
+                }
+            }
+
+            // the queues on other NUMA domains, the ones located on the same
+            // socket first
+            auto& remote = victims[steal_ring_remote];
+            for (int same_socket = 1; same_socket >= 0; --same_socket)
+            {
+                for (std::size_t d = 1; d < num_domains_; ++d)
+                {
+                    std::size_t const dom = fast_mod(domain + d, num_domains_);
+                    std::size_t const pu =
+                        get_pu_num(numa_holder_[dom].queues_[0]->thread_num_);
+                    if ((topo.get_socket_number(pu) == socket) !=
+                        (same_socket != 0))
+                    {
+                        continue;
+                    }
+
+                    for (std::size_t i = 0; i < q_counts_[dom]; ++i)
+                    {
+                        remote.push_back(
+                            {dom, fast_mod(q_index + i, q_counts_[dom])});
+                    }
+                }
+            }
+
+            spq_deb.debug(debug::str<>("steal rings"), "local_thread",
+                local_thread, "core group",
+                victims[steal_ring_core_group].size(), "numa domain",
+                victims[steal_ring_numa_domain].size(), "remote",
+                remote.size());
+        }
+
         void on_stop_thread(std::size_t thread_num) override
         {
             if (thread_num > num_workers_)
@@ -1254,6 +1388,47 @@ namespace hpx::threads::policies {
             // @TODO Do we need to do any queue related cleanup here?
         }
 
+        // Return the number of successful steals from the given ring
+        std::int64_t get_num_stolen_from_ring(
+            std::size_t ring, std::size_t num_thread, bool reset)
+        {
+            if (num_thread == static_cast<std::size_t>(-1))
+            {
+                std::int64_t result = 0;
+                for (auto& rings : steal_rings_)
+                {
+                    result +=
+                        util::get_and_reset_value(rings.stolen_[ring], reset);
+                }
+                return result;
+            }
+
+            HPX_ASSERT(num_thread < steal_rings_.size());
+            return util::get_and_reset_value(
+                steal_rings_[num_thread].stolen_[ring], reset);
+        }
+
+        std::int64_t get_num_stolen_from_core_group(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_from_ring(
+                steal_ring_core_group, num_thread, reset);
+        }
+
+        std::int64_t get_num_stolen_from_numa_domain(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_from_ring(
+                steal_ring_numa_domain, num_thread, reset);
+        }
+
+        std::int64_t get_num_stolen_from_remote(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_from_ring(
+                steal_ring_remote, num_thread, reset);
+        }
+
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t get_creation_time(bool /* reset */) override
         {
@@ -1365,6 +1540,25 @@ namespace hpx::threads::policies {
     protected:
         typedef queue_holder_numa<thread_queue_type> numa_queues;
 
+        // the rings of victims used for hierarchical stealing
+        static constexpr std::size_t steal_ring_core_group = 0;
+        static constexpr std::size_t steal_ring_numa_domain = 1;
+        static constexpr std::size_t steal_ring_remote = 2;
+        static constexpr std::size_t num_steal_rings = 3;
+
+        struct steal_victim
+        {
+            std::size_t domain;
+            std::size_t q_index;
+        };
+
+        struct steal_rings
+        {
+            std::array<std::vector<steal_victim>, num_steal_rings> victims_;
+            std::array<std::atomic<std::int64_t>, num_steal_rings> stolen_ =
+                {};
+        };
+
         // for each numa domain, the number of queues available
         std::array<std::size_t, HPX_HAVE_MAX_NUMA_DOMAIN_COUNT> q_counts_ = {};
         // index of first queue on each numa domain
@@ -1425,6 +1619,13 @@ namespace hpx::threads::policies {
         std::atomic<std::size_t> thread_init_counter_;
         // used in thread pool checks
         std::size_t pool_index_;
+
+        // minimal number of tasks a victim has to hold, for each ring
+        std::array<std::int64_t, num_steal_rings> min_tasks_to_steal_;
+
+        // for each worker thread, the rings of victims and steal counts
+        std::vector<util::cache_aligned_data_derived<steal_rings>>
+            steal_rings_;
     };
 }    // namespace hpx::threads::policies
 
@@ -17,6 +17,7 @@
 #include <hpx/schedulers/queue_helpers.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_data_stackful.hpp>
 #include <hpx/threading_base/thread_data_stackless.hpp>
@@ -47,6 +48,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -132,8 +134,11 @@ namespace hpx::threads::policies {
             typename TerminatedQueuing::template apply<thread_data*>::type;
 
     protected:
+        // Returns true if the returned thread object is still registered in
+        // the map of all threads (it was recycled by the owning worker without
+        // acquiring the lock).
         template <typename Lock>
-        void create_thread_object(threads::thread_id_ref_type& thrd,
+        bool create_thread_object(threads::thread_id_ref_type& thrd,
             threads::thread_init_data& data, Lock& lk)
         {
             HPX_ASSERT_OWNS_LOCK(lk);
@@ -176,6 +181,27 @@ namespace hpx::threads::policies {
 
             // ASAN gets confused by reusing threads/stacks
 #if !defined(HPX_HAVE_ADDRESS_SANITIZER)
+            // Check for a thread object recycled by the owning worker.
+            if (terminated_local_count_.load(std::memory_order_relaxed) != 0 &&
+                is_owner())
+            {
+                for (auto it = terminated_local_.rbegin();
+                     it != terminated_local_.rend(); ++it)
+                {
+                    if (get_thread_id_data(*it)->get_stack_size() == stacksize)
+                    {
+                        // Take ownership of the thread object and rebind it.
+                        thrd = *it;
+                        *it = terminated_local_.back();
+                        terminated_local_.pop_back();
+                        --terminated_local_count_;
+
+                        get_thread_id_data(thrd)->rebind(data);
+                        return true;
+                    }
+                }
+            }
+
             // Check for an unused thread object.
             if (heap && !heap->empty())    //-V522
             {
@@ -203,6 +229,23 @@ namespace hpx::threads::policies {
                 }
                 thrd = thread_id_ref_type(p, thread_id_addref::no);
             }
+            return false;
+        }
+
+        // add the passed thread to the queue of pending threads, the caller
+        // is responsible for incrementing work_items_count_
+        void push_work_item(
+            threads::thread_id_ref_type thrd, bool other_end = false)
+        {
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+            work_items_.push(new thread_description{HPX_MOVE(thrd),
+                                 hpx::chrono::high_resolution_clock::now()},
+                other_end);
+#else
+            // detach the thread from the id_ref without decrementing
+            // the reference count
+            work_items_.push(thrd.detach(), other_end);
+#endif
         }
 
         static util::internal_allocator<task_description>
@@ -240,35 +283,38 @@ namespace hpx::threads::policies {
                     data.initial_state == thread_schedule_state::pending;
 
                 threads::thread_id_ref_type thrd;
-                create_thread_object(thrd, data, lk);
+                bool const in_map = create_thread_object(thrd, data, lk);
 
                 std::destroy_at(task);
                 task_description_alloc_.deallocate(task, 1);
 
-                // add the new entry to the map of all threads
-                std::pair<thread_map_type::iterator, bool> const p =
-                    thread_map_.emplace(thrd.noref());
+                if (!in_map)
+                {
+                    // add the new entry to the map of all threads
+                    std::pair<thread_map_type::iterator, bool> const p =
+                        thread_map_.emplace(thrd.noref());
 
-                // 26110: Caller failing to hold lock 'lk'
+                    // 26110: Caller failing to hold lock 'lk'
 #if defined(HPX_MSVC)
 #pragma warning(push)
 #pragma warning(disable : 26110)
 #endif
 
-                if (HPX_UNLIKELY(!p.second))
-                {
-                    --addfrom->new_tasks_count_.data_;
-                    lk.unlock();
-                    HPX_THROW_EXCEPTION(hpx::error::out_of_memory,
-                        "thread_queue::add_new",
-                        "Couldn't add new thread to the thread map");
-                }
+                    if (HPX_UNLIKELY(!p.second))
+                    {
+                        --addfrom->new_tasks_count_.data_;
+                        lk.unlock();
+                        HPX_THROW_EXCEPTION(hpx::error::out_of_memory,
+                            "thread_queue::add_new",
+                            "Couldn't add new thread to the thread map");
+                    }
 
 #if defined(HPX_MSVC)
 #pragma warning(pop)
 #endif
 
-                ++thread_map_count_;
+                    ++thread_map_count_;
+                }
 
                 // Decrement only after thread_map_count_ has been incremented
                 --addfrom->new_tasks_count_.data_;
@@ -315,8 +361,11 @@ namespace hpx::threads::policies {
             // map holds more than max_thread_count
             if (HPX_LIKELY(parameters_.max_thread_count_))
             {
+                // threads recycled by the owning worker are still part of the
+                // map of all threads
                 std::int64_t const count =
-                    static_cast<std::int64_t>(thread_map_.size());
+                    static_cast<std::int64_t>(thread_map_.size()) -
+                    terminated_local_count_.load(std::memory_order_relaxed);
                 if (parameters_.max_thread_count_ >=
                     count + parameters_.min_add_new_count_)
                 {    //-V104
@@ -353,33 +402,95 @@ namespace hpx::threads::policies {
             std::ptrdiff_t const stacksize =
                 get_thread_id_data(thrd)->get_stack_size();
 
+            thread_heap_type* heap = nullptr;
             if (stacksize == parameters_.small_stacksize_)
             {
-                thread_heap_small_.push_back(thrd);
+                heap = &thread_heap_small_;
             }
             else if (stacksize == parameters_.medium_stacksize_)
             {
-                thread_heap_medium_.push_back(thrd);
+                heap = &thread_heap_medium_;
             }
             else if (stacksize == parameters_.large_stacksize_)
             {
-                thread_heap_large_.push_back(thrd);
+                heap = &thread_heap_large_;
             }
             else if (stacksize == parameters_.huge_stacksize_)
             {
-                thread_heap_huge_.push_back(thrd);
+                heap = &thread_heap_huge_;
             }
             else if (stacksize == parameters_.nostack_stacksize_)
             {
-                thread_heap_nostack_.push_back(thrd);
+                heap = &thread_heap_nostack_;
             }
             else
             {
                 HPX_ASSERT_MSG(
                     false, util::format("Invalid stack size {1}", stacksize));
+                return;
+            }
+
+            // Don't let the heaps grow beyond the maximal number of threads
+            // this queue is allowed to manage. Excess thread objects are
+            // released, which hands their stacks back to the stack pool from
+            // where they can be picked up by other workers.
+            if (stacksize != parameters_.nostack_stacksize_ &&
+                parameters_.max_thread_count_ != 0 &&
+                static_cast<std::int64_t>(heap->size()) >=
+                    parameters_.max_thread_count_)
+            {
+                deallocate(get_thread_id_data(thrd));
+                return;
+            }
+
+            heap->push_back(thrd);
+        }
+
+        bool is_owner() const noexcept
+        {
+            return owner_.load(std::memory_order_relaxed) ==
+                std::this_thread::get_id();
+        }
+
+        // Recycle a terminated thread without acquiring the lock. The thread
+        // object stays in the map of all threads until it is either reused
+        // by the owning worker or the local free list is flushed (which
+        // happens during the next cleanup of the terminated threads at the
+        // latest). This must be called on the owning worker only.
+        void recycle_thread_local(thread_data* thrd)
+        {
+            HPX_ASSERT(is_owner());
+
+            terminated_local_.emplace_back(thrd);
+            if (++terminated_local_count_ > parameters_.max_terminated_threads_)
+            {
+                std::unique_lock<mutex_type> lk(mtx_, std::try_to_lock);
+                if (lk.owns_lock())
+                {
+                    flush_terminated_local_locked();
+                }
             }
         }
 
+        // Release all threads held by the local free list of the owning
+        // worker, this must be called on the owning worker only.
+        void flush_terminated_local_locked()
+        {
+            HPX_ASSERT(is_owner());
+
+            for (thread_id_type const& tid : terminated_local_)
+            {
+                --terminated_local_count_;
+                if (thread_map_.erase(tid) != 0)
+                {
+                    recycle_thread(tid);
+                    --thread_map_count_;
+                    HPX_ASSERT(thread_map_count_ >= 0);
+                }
+            }
+            terminated_local_.clear();
+        }
+
     public:
         // This function makes sure all threads which are marked for deletion
         // (state is terminated) are properly destroyed.
@@ -392,6 +503,13 @@ namespace hpx::threads::policies {
             util::tick_counter tc(cleanup_terminated_time_);
 #endif
 
+            if (delete_all &&
+                terminated_local_count_.load(std::memory_order_relaxed) != 0 &&
+                is_owner())
+            {
+                flush_terminated_local_locked();
+            }
+
             if (terminated_items_count_.load(std::memory_order_acquire) == 0)
                 return true;
 
@@ -458,6 +576,44 @@ namespace hpx::threads::policies {
     public:
         bool cleanup_terminated(bool delete_all = false)    //-V1071
         {
+            if ((lockfree_reclamation_.load(std::memory_order_relaxed) ||
+                    terminated_local_count_.load(std::memory_order_relaxed) !=
+                        0) &&
+                is_owner())
+            {
+                // collect the threads handed back by other workers, no lock
+                // is required
+                thread_data* todelete;
+                while (terminated_items_.pop(todelete))
+                {
+                    --terminated_items_count_;
+                    terminated_local_.emplace_back(todelete);
+                    ++terminated_local_count_;
+                }
+
+                if (terminated_local_count_.load(std::memory_order_relaxed) ==
+                    0)
+                {
+                    return true;
+                }
+
+                // remove the recycled threads from the map of all threads,
+                // wait for the lock only if all of them have to be deleted
+                std::unique_lock<mutex_type> lk(mtx_, std::defer_lock);
+                if (delete_all)
+                {
+                    lk.lock();
+                }
+                else if (!lk.try_lock())
+                {
+                    return false;    // avoid long wait on lock
+                }
+
+                flush_terminated_local_locked();
+                return terminated_items_count_.load(
+                           std::memory_order_acquire) == 0;
+            }
+
             if (terminated_items_count_.load(std::memory_order_acquire) == 0)
                 return true;
 
@@ -496,6 +652,8 @@ namespace hpx::threads::policies {
 #endif
           , terminated_items_(128)
           , terminated_items_count_(0)
+          , terminated_local_count_(0)
+          , lockfree_reclamation_(false)
           , new_tasks_(128)
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
           , new_tasks_wait_(0)
@@ -539,6 +697,9 @@ namespace hpx::threads::policies {
 
             for (auto const& t : thread_heap_nostack_)
                 deallocate(get_thread_id_data(t));
+
+            for (auto const& t : terminated_local_)
+                deallocate(get_thread_id_data(t));
         }
 
         thread_queue(thread_queue const&) = delete;
@@ -574,6 +735,13 @@ namespace hpx::threads::policies {
             return work_items_count_.data_.load(order);
         }
 
+        // Provide access to the queue of pending threads, this allows for
+        // schedulers to query properties specific to the used queue backend
+        work_items_type const& get_pending_queue() const noexcept
+        {
+            return work_items_;
+        }
+
         // This returns the current length of the staged queue
         std::int64_t get_staged_queue_length(
             std::memory_order order = std::memory_order_acquire) const noexcept
@@ -715,21 +883,22 @@ namespace hpx::threads::policies {
                 bool const schedule_now =
                     data.initial_state == thread_schedule_state::pending;
 
-                create_thread_object(thrd, data, lk);
-
-                // add a new entry in the map for this thread
-                std::pair<thread_map_type::iterator, bool> const p =
-                    thread_map_.emplace(thrd.noref());
-
-                if (HPX_UNLIKELY(!p.second))
+                if (!create_thread_object(thrd, data, lk))
                 {
-                    lk.unlock();
-                    HPX_THROWS_IF(ec, hpx::error::out_of_memory,
-                        "thread_queue::create_thread",
-                        "Couldn't add new thread to the map of threads");
-                    return;
+                    // add a new entry in the map for this thread
+                    std::pair<thread_map_type::iterator, bool> const p =
+                        thread_map_.emplace(thrd.noref());
+
+                    if (HPX_UNLIKELY(!p.second))
+                    {
+                        lk.unlock();
+                        HPX_THROWS_IF(ec, hpx::error::out_of_memory,
+                            "thread_queue::create_thread",
+                            "Couldn't add new thread to the map of threads");
+                        return;
+                    }
+                    ++thread_map_count_;
                 }
-                ++thread_map_count_;
 
                 // this thread has to be in the map now
                 HPX_ASSERT(thread_map_.find(thrd.noref()) != thread_map_.end());
@@ -787,6 +956,120 @@ namespace hpx::threads::policies {
                 ec = make_success_code();
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // create a number of new threads at once, all of them are scheduled
+        // right away (or registered as staged tasks if run_now is not set)
+        void create_thread_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec)
+        {
+            std::size_t num_run_now = 0;
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                thread_init_data& d = data[i];
+                if (d.stacksize == threads::thread_stacksize::current)
+                {
+                    d.stacksize = get_self_stacksize_enum();
+                }
+
+                HPX_ASSERT(d.stacksize != threads::thread_stacksize::current);
+
+                // the ids of the new threads are not returned to the caller,
+                // thus all of them have to be scheduled
+                if (d.initial_state != thread_schedule_state::pending)
+                {
+                    HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                        "thread_queue::create_thread_bulk",
+                        "threads created in bulk must have 'pending' as their "
+                        "initial state");
+                    return;
+                }
+
+                if (d.run_now)
+                    ++num_run_now;
+            }
+
+            if (num_run_now != 0)
+            {
+                std::vector<threads::thread_id_ref_type> threads;
+                threads.reserve(num_run_now);
+
+                // create all thread objects while holding the lock only once
+                {
+                    std::unique_lock<mutex_type> lk(mtx_);
+                    for (std::size_t i = 0; i != count; ++i)
+                    {
+                        if (!data[i].run_now)
+                            continue;
+
+                        threads::thread_id_ref_type thrd;
+                        if (!create_thread_object(thrd, data[i], lk))
+                        {
+                            std::pair<thread_map_type::iterator, bool> const p =
+                                thread_map_.emplace(thrd.noref());
+
+                            if (HPX_UNLIKELY(!p.second))
+                            {
+                                lk.unlock();
+                                HPX_THROWS_IF(ec, hpx::error::out_of_memory,
+                                    "thread_queue::create_thread_bulk",
+                                    "Couldn't add new thread to the map of "
+                                    "threads");
+                                return;
+                            }
+                            ++thread_map_count_;
+                        }
+                        threads.push_back(HPX_MOVE(thrd));
+                    }
+                }
+
+                // publish all new threads at once
+                work_items_count_.data_ +=
+                    static_cast<std::int64_t>(num_run_now);
+                for (auto& thrd : threads)
+                {
+                    push_work_item(HPX_MOVE(thrd));
+                }
+            }
+
+            if (num_run_now != count)
+            {
+                // create all task descriptions before publishing any of them
+                std::size_t const num_staged = count - num_run_now;
+
+                std::vector<task_description*> tasks;
+                tasks.reserve(num_staged);
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                std::uint64_t const now =
+                    hpx::chrono::high_resolution_clock::now();
+#endif
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    if (data[i].run_now)
+                        continue;
+
+                    task_description* td = task_description_alloc_.allocate(1);
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                    new (td) task_description{HPX_MOVE(data[i]), now};
+#else
+                    new (td) task_description{HPX_MOVE(data[i])};    //-V106
+#endif
+                    tasks.push_back(td);
+                }
+
+                // register all task descriptions for later thread creation
+                new_tasks_count_.data_ +=
+                    static_cast<std::int64_t>(num_staged);
+                for (task_description* td : tasks)
+                {
+                    new_tasks_.push(td);
+                }
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
         void move_work_items_from(thread_queue* src, std::int64_t count)
         {
             thread_description_ptr trd;
@@ -812,10 +1095,13 @@ namespace hpx::threads::policies {
             }
         }
 
-        void move_task_items_from(thread_queue* src, std::int64_t count)
+        // Move up to count staged tasks from the given queue, returns the
+        // number of moved tasks
+        std::int64_t move_task_items_from(thread_queue* src, std::int64_t count)
         {
+            std::int64_t moved = 0;
             task_description* task = nullptr;
-            while (src->new_tasks_.pop(task))
+            while (moved != count && src->new_tasks_.pop(task))
             {
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
                 if (get_maintain_queue_wait_times_enabled())
@@ -828,7 +1114,7 @@ namespace hpx::threads::policies {
                 }
 #endif
 
-                bool const finish = (count == ++new_tasks_count_.data_);
+                ++new_tasks_count_.data_;
 
                 // Decrement only after the local new_tasks_count_ has
                 // been incremented
@@ -836,14 +1122,14 @@ namespace hpx::threads::policies {
 
                 if (new_tasks_.push(task))
                 {
-                    if (finish)
-                        break;
+                    ++moved;
                 }
                 else
                 {
                     --new_tasks_count_.data_;
                 }
             }
+            return moved;
         }
 
         // Return the next thread to be executed, return false if none is
@@ -977,16 +1263,7 @@ namespace hpx::threads::policies {
             threads::thread_id_ref_type thrd, bool other_end = false)
         {
             ++work_items_count_.data_;
-
-#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
-            work_items_.push(new thread_description{HPX_MOVE(thrd),
-                                 hpx::chrono::high_resolution_clock::now()},
-                other_end);
-#else
-            // detach the thread from the id_ref without decrementing
-            // the reference count
-            work_items_.push(thrd.detach(), other_end);
-#endif
+            push_work_item(HPX_MOVE(thrd), other_end);
         }
 
         // Destroy the passed thread as it has been terminated
@@ -994,6 +1271,34 @@ namespace hpx::threads::policies {
         {
             HPX_ASSERT(&thrd->get_queue<thread_queue>() == this);
 
+            bool const lockfree =
+                thrd->get_scheduler_base()->has_scheduler_mode(
+                    scheduler_mode::lockfree_thread_reclamation);
+            if (lockfree !=
+                lockfree_reclamation_.load(std::memory_order_relaxed))
+            {
+                lockfree_reclamation_.store(
+                    lockfree, std::memory_order_relaxed);
+            }
+
+            if (lockfree)
+            {
+                if (is_owner())
+                {
+                    // the owning worker recycles the thread without locking
+                    recycle_thread_local(thrd);
+                }
+                else
+                {
+                    // all other threads hand back the thread through the
+                    // (lock-free) queue of terminated threads, the owning
+                    // worker will collect those in batches
+                    terminated_items_.push(thrd);
+                    ++terminated_items_count_;
+                }
+                return;
+            }
+
             terminated_items_.push(thrd);
 
             if (++terminated_items_count_ > parameters_.max_terminated_threads_)
@@ -1008,7 +1313,7 @@ namespace hpx::threads::policies {
             thread_schedule_state state = thread_schedule_state::unknown) const
         {
             if (thread_schedule_state::terminated == state)
-                return terminated_items_count_;
+                return terminated_items_count_ + terminated_local_count_;
 
             if (thread_schedule_state::staged == state)
                 return new_tasks_count_.data_;
@@ -1016,7 +1321,7 @@ namespace hpx::threads::policies {
             if (thread_schedule_state::unknown == state)
             {
                 return thread_map_count_ + new_tasks_count_.data_ -
-                    terminated_items_count_;
+                    terminated_items_count_ - terminated_local_count_;
             }
 
             // acquire lock only if absolutely necessary
@@ -1060,7 +1365,7 @@ namespace hpx::threads::policies {
             std::uint64_t count = thread_map_count_;
             if (state == thread_schedule_state::terminated)
             {
-                count = terminated_items_count_;
+                count = terminated_items_count_ + terminated_local_count_;
             }
             else if (state == thread_schedule_state::staged)
             {
@@ -1231,6 +1536,8 @@ namespace hpx::threads::policies {
         ///////////////////////////////////////////////////////////////////////
         void on_start_thread(std::size_t /* num_thread */)
         {
+            owner_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
             thread_heap_small_.reserve(parameters_.init_threads_count_);
             thread_heap_medium_.reserve(parameters_.init_threads_count_);
             thread_heap_large_.reserve(parameters_.init_threads_count_);
@@ -1263,7 +1570,17 @@ namespace hpx::threads::policies {
                 thread_heap_small_.emplace_back(p);
             }
         }
-        static constexpr void on_stop_thread(std::size_t) noexcept {}
+        void on_stop_thread(std::size_t /* num_thread */)
+        {
+            if (is_owner())
+            {
+                // hand back all threads recycled locally by this worker
+                std::lock_guard<mutex_type> lk(mtx_);
+                flush_terminated_local_locked();
+                owner_.store(std::thread::id(), std::memory_order_relaxed);
+            }
+        }
+
         static constexpr void on_error(
             std::size_t, std::exception_ptr const&) noexcept
         {
@@ -1292,6 +1609,18 @@ namespace hpx::threads::policies {
         // count of terminated items
         std::atomic<std::int64_t> terminated_items_count_;
 
+        // the worker this queue belongs to, only this worker accesses the
+        // local list of terminated threads
+        std::atomic<std::thread::id> owner_;
+        // list of terminated threads recycled by the owning worker without
+        // acquiring the lock (lockfree_thread_reclamation mode only)
+        thread_heap_type terminated_local_;
+        // count of locally recycled terminated threads
+        std::atomic<std::int64_t> terminated_local_count_;
+        // the scheduler this queue belongs to has enabled the
+        // lockfree_thread_reclamation mode
+        std::atomic<bool> lockfree_reclamation_;
+
         task_items_type new_tasks_;    // list of new tasks to run
 
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
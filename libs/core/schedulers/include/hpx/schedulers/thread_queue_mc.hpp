@@ -251,6 +251,66 @@ namespace hpx::threads::policies {
                 ec = make_success_code();
         }
 
+        // create a number of new threads at once, the counters are updated
+        // once for all threads
+        void create_thread_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec)
+        {
+            std::size_t num_run_now = 0;
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                thread_init_data& d = data[i];
+                if (d.stacksize == threads::thread_stacksize::current)
+                {
+                    d.stacksize = get_self_stacksize_enum();
+                }
+
+                HPX_ASSERT(d.stacksize != threads::thread_stacksize::current);
+
+                // the ids of the new threads are not returned to the caller,
+                // thus all of them have to be scheduled
+                if (d.initial_state != thread_schedule_state::pending)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "thread_queue_mc::create_thread_bulk",
+                        "threads created in bulk must have 'pending' as their "
+                        "initial state");
+                }
+
+                if (d.run_now)
+                    ++num_run_now;
+            }
+
+            if (num_run_now != 0)
+            {
+                work_items_count_.data_ +=
+                    static_cast<std::int32_t>(num_run_now);
+            }
+            if (num_run_now != count)
+            {
+                new_tasks_count_.data_ +=
+                    static_cast<std::int32_t>(count - num_run_now);
+            }
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                if (data[i].run_now)
+                {
+                    threads::thread_id_ref_type tid;
+                    holder_->create_thread_object(tid, data[i]);
+                    holder_->add_to_thread_map(tid.noref());
+                    work_items_.push(HPX_MOVE(tid), false);
+                }
+                else
+                {
+                    new_task_items_.push(task_description(HPX_MOVE(data[i])));
+                }
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
         // ----------------------------------------------------------------
         /// Return the next thread to be executed, return false if none is
         /// available
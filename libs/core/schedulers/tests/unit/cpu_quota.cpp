@@ -0,0 +1,98 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that a CPU quota assigned to a thread pool throttles its worker
+// threads, that all work still completes, and that removing the quota lifts
+// the throttling again.
+
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+std::atomic<std::size_t> count(0);
+
+void busy_work(std::chrono::microseconds duration)
+{
+    hpx::chrono::high_resolution_timer const t;
+    while (t.elapsed() * 1e6 < static_cast<double>(duration.count()))
+    {
+    }
+    ++count;
+}
+
+void run_tasks(std::size_t num_tasks)
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(
+            hpx::async(&busy_work, std::chrono::microseconds(500)));
+    }
+
+    hpx::wait_all(tasks);
+}
+
+int hpx_main()
+{
+    auto* pool = hpx::this_thread::get_pool();
+    std::size_t const num_tasks = 400;
+
+    // no quota is in effect by default
+    HPX_TEST_EQ(pool->get_cpu_quota(), 1.0);
+    HPX_TEST_EQ(pool->get_cpu_quota_percentage(), std::int64_t(100));
+
+    pool->get_cpu_quota_throttled_count(-1, true);
+    pool->get_cpu_quota_throttled_time(-1, true);
+
+    pool->set_cpu_quota(0.25);
+    HPX_TEST_EQ(pool->get_cpu_quota(), 0.25);
+    HPX_TEST_EQ(pool->get_cpu_quota_percentage(), std::int64_t(25));
+
+    count = 0;
+    run_tasks(num_tasks);
+    HPX_TEST_EQ(count.load(), num_tasks);
+
+    HPX_TEST_LT(std::int64_t(0), pool->get_cpu_quota_throttled_count(-1, true));
+    HPX_TEST_LT(std::int64_t(0), pool->get_cpu_quota_throttled_time(-1, true));
+
+    // removing the quota lets all work run unthrottled again
+    pool->set_cpu_quota(1.0);
+    HPX_TEST_EQ(pool->get_cpu_quota(), 1.0);
+
+    count = 0;
+    run_tasks(num_tasks);
+    HPX_TEST_EQ(count.load(), num_tasks);
+
+    // invalid quotas are rejected
+    bool caught_exception = false;
+    try
+    {
+        pool->set_cpu_quota(0.0);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
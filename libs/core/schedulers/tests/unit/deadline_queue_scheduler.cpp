@@ -0,0 +1,124 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the deadline_queue_scheduler runs threads in the order of their
+// deadlines and that threads finishing late are counted as deadline misses.
+
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using hpx::threads::make_thread_function_nullary;
+using hpx::threads::register_work;
+using hpx::threads::thread_init_data;
+
+void register_task(std::chrono::steady_clock::time_point deadline,
+    std::vector<std::size_t>& order, std::size_t id, hpx::latch& l)
+{
+    thread_init_data data(make_thread_function_nullary([&order, id, &l]() {
+        order.push_back(id);
+        l.count_down(1);
+    }),
+        "deadline_task");
+    data.deadline = deadline;
+    register_work(data);
+}
+
+void test_earliest_deadline_first()
+{
+    std::size_t const num_tasks = 100;
+
+    std::vector<std::size_t> ids(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+        ids[i] = i;
+
+    std::mt19937 gen(42);
+    std::shuffle(ids.begin(), ids.end(), gen);
+
+    // all deadlines are far enough in the future to not be missed, the
+    // deadline of each task is determined by its id
+    auto const base = std::chrono::steady_clock::now() + std::chrono::hours(1);
+
+    std::vector<std::size_t> order;
+    order.reserve(num_tasks);
+
+    hpx::latch l(num_tasks + 1);
+    for (std::size_t id : ids)
+    {
+        register_task(base + std::chrono::milliseconds(id), order, id, l);
+    }
+
+    // this thread has no deadline, it will be resumed only after all tasks
+    // have run
+    l.arrive_and_wait();
+
+    HPX_TEST_EQ(order.size(), num_tasks);
+    HPX_TEST(std::is_sorted(order.begin(), order.end()));
+}
+
+void test_deadline_misses()
+{
+    auto* scheduler = hpx::this_thread::get_pool()->get_scheduler();
+    std::int64_t const misses =
+        scheduler->get_num_deadline_misses(std::size_t(-1), true);
+    HPX_TEST_EQ(misses, std::int64_t(0));
+
+    std::vector<std::size_t> order;
+    hpx::latch l(3);
+
+    auto const now = std::chrono::steady_clock::now();
+    register_task(now - std::chrono::milliseconds(1), order, 0, l);
+    register_task(now + std::chrono::hours(1), order, 1, l);
+    l.arrive_and_wait();
+
+    HPX_TEST_EQ(order.size(), std::size_t(2));
+
+    // the terminated threads might not have been released yet
+    for (int i = 0; i != 100 &&
+         scheduler->get_num_deadline_misses(std::size_t(-1), false) == 0;
+         ++i)
+    {
+        hpx::this_thread::yield();
+    }
+
+    HPX_TEST_EQ(scheduler->get_num_deadline_misses(std::size_t(-1), false),
+        std::int64_t(1));
+}
+
+int hpx_main()
+{
+    test_earliest_deadline_first();
+    test_deadline_misses();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+
+    // a single worker thread makes the execution order deterministic
+    init_args.cfg = {"hpx.os_threads=1"};
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool(
+            "default", hpx::resource::scheduling_policy::deadline);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,321 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that schedulers running with the enable_handoff_wakeup mode hand
+// threads woken up through futures, condition variables, and channels directly
+// to the waking worker, that all ping-pong chains complete, that a handed over
+// thread runs next, and that it can't get stuck behind a running waker.
+
+#include <hpx/condition_variable.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/lcos_local.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/mutex.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+constexpr std::size_t num_hops = 1000;
+
+void ping_pong_futures()
+{
+    std::vector<hpx::promise<std::size_t>> pings(num_hops);
+    std::vector<hpx::promise<std::size_t>> pongs(num_hops);
+
+    hpx::future<void> f = hpx::async([&]() {
+        for (std::size_t i = 0; i != num_hops; ++i)
+        {
+            pongs[i].set_value(pings[i].get_future().get() + 1);
+        }
+    });
+
+    std::size_t value = 0;
+    for (std::size_t i = 0; i != num_hops; ++i)
+    {
+        pings[i].set_value(value);
+        value = pongs[i].get_future().get();
+    }
+    f.get();
+
+    HPX_TEST_EQ(value, num_hops);
+}
+
+void ping_pong_condition_variable()
+{
+    hpx::mutex mtx;
+    hpx::condition_variable cv;
+    std::size_t turn = 0;
+
+    hpx::future<void> f = hpx::async([&]() {
+        for (std::size_t i = 0; i != num_hops; ++i)
+        {
+            std::unique_lock<hpx::mutex> l(mtx);
+            cv.wait(l, [&]() { return turn % 2 == 1; });
+            ++turn;
+            cv.notify_one();
+        }
+    });
+
+    for (std::size_t i = 0; i != num_hops; ++i)
+    {
+        std::unique_lock<hpx::mutex> l(mtx);
+        ++turn;
+        cv.notify_one();
+        cv.wait(l, [&]() { return turn % 2 == 0; });
+    }
+    f.get();
+
+    HPX_TEST_EQ(turn, 2 * num_hops);
+}
+
+void ping_pong_channels()
+{
+    hpx::lcos::local::channel<std::size_t> ping;
+    hpx::lcos::local::channel<std::size_t> pong;
+
+    hpx::future<void> f = hpx::async([&]() {
+        for (std::size_t i = 0; i != num_hops; ++i)
+        {
+            pong.set(ping.get(hpx::launch::sync) + 1);
+        }
+    });
+
+    std::size_t value = 0;
+    for (std::size_t i = 0; i != num_hops; ++i)
+    {
+        ping.set(value);
+        value = pong.get(hpx::launch::sync);
+    }
+    f.get();
+
+    HPX_TEST_EQ(value, num_hops);
+}
+
+// the worker running the waking threads in the tests below
+constexpr std::size_t waking_worker = 1;
+constexpr std::size_t num_fillers = 10;
+
+hpx::execution::parallel_executor bound_executor()
+{
+    return hpx::execution::parallel_executor(
+        hpx::threads::thread_priority::bound,
+        hpx::threads::thread_stacksize::default_,
+        hpx::threads::thread_schedule_hint(
+            static_cast<std::int16_t>(waking_worker)));
+}
+
+// Launch a thread waiting for the given future and wait for it to be
+// suspended. The thread records the sequence number and the worker it was
+// resumed on.
+hpx::future<void> launch_waiting_thread(hpx::shared_future<void> f,
+    std::atomic<std::size_t>& sequence, std::size_t& woken_sequence,
+    std::size_t& woken_worker)
+{
+    hpx::threads::thread_id_type id;
+    std::atomic<bool> started(false);
+
+    hpx::future<void> result = hpx::async([&, f = HPX_MOVE(f)]() {
+        id = hpx::threads::get_self_id();
+        started = true;
+
+        f.get();
+
+        woken_sequence = sequence++;
+        woken_worker = hpx::get_worker_thread_num();
+    });
+
+    while (!started)
+    {
+        hpx::this_thread::yield();
+    }
+    while (hpx::threads::get_thread_state(id).state() !=
+        hpx::threads::thread_schedule_state::suspended)
+    {
+        hpx::this_thread::yield();
+    }
+    return result;
+}
+
+bool wait_for(std::atomic<bool> const& flag, bool yield)
+{
+    auto const start = std::chrono::steady_clock::now();
+    while (!flag)
+    {
+        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(10))
+        {
+            return false;
+        }
+        if (yield)
+        {
+            hpx::this_thread::yield();
+        }
+    }
+    return true;
+}
+
+// A thread woken up by a thread that terminates right afterwards runs next on
+// the same worker, before any other work queued on that worker.
+void handoff_runs_next()
+{
+    using hpx::threads::policies::scheduler_mode;
+
+    auto* pool = hpx::this_thread::get_pool();
+    auto* scheduler = pool->get_scheduler();
+
+    // make sure no other worker takes the woken thread
+    scheduler->remove_scheduler_mode(scheduler_mode::enable_stealing);
+    pool->get_handoff_count(-1, true);
+
+    std::atomic<std::size_t> sequence(0);
+    std::size_t woken_sequence = 0;
+    std::size_t woken_worker = 0;
+    std::vector<std::size_t> filler_sequence(num_fillers, 0);
+
+    hpx::promise<void> p;
+    hpx::future<void> woken = launch_waiting_thread(
+        p.get_future(), sequence, woken_sequence, woken_worker);
+
+    auto exec = bound_executor();
+    hpx::latch fillers_done(num_fillers + 1);
+    hpx::async(exec, [&]() {
+        for (std::size_t i = 0; i != num_fillers; ++i)
+        {
+            hpx::post(exec, [&, i]() {
+                filler_sequence[i] = sequence++;
+                fillers_done.count_down(1);
+            });
+        }
+        p.set_value();
+    }).get();
+
+    woken.get();
+    fillers_done.arrive_and_wait();
+
+    HPX_TEST_LT(std::int64_t(0), pool->get_handoff_count(-1, true));
+    HPX_TEST_EQ(woken_worker, waking_worker);
+    HPX_TEST_EQ(woken_sequence, std::size_t(0));
+    for (std::size_t i = 0; i != num_fillers; ++i)
+    {
+        HPX_TEST_LT(woken_sequence, filler_sequence[i]);
+    }
+
+    scheduler->add_scheduler_mode(scheduler_mode::enable_stealing);
+}
+
+// A thread woken up by a thread that continues to run is not stranded: it
+// is queued if the waking thread yields, and it is taken over by an idle
+// worker if the waking thread keeps running without yielding.
+void handoff_not_stranded(bool yield)
+{
+    using hpx::threads::policies::scheduler_mode;
+
+    auto* pool = hpx::this_thread::get_pool();
+    auto* scheduler = pool->get_scheduler();
+
+    // only idle workers taking over handed off threads can rescue a thread
+    // woken by a thread that does not yield
+    if (yield)
+    {
+        scheduler->remove_scheduler_mode(scheduler_mode::enable_stealing);
+    }
+    pool->get_handoff_count(-1, true);
+
+    std::atomic<std::size_t> sequence(0);
+    std::size_t woken_sequence = 0;
+    std::size_t woken_worker = 0;
+
+    hpx::promise<void> p;
+    hpx::future<void> woken = launch_waiting_thread(
+        p.get_future(), sequence, woken_sequence, woken_worker);
+
+    std::atomic<bool> done(false);
+    hpx::future<bool> waker = hpx::async(bound_executor(), [&]() {
+        p.set_value();
+        return wait_for(done, yield);
+    });
+
+    woken.get();
+    done = true;
+
+    HPX_TEST(waker.get());
+    HPX_TEST_LT(std::int64_t(0), pool->get_handoff_count(-1, true));
+
+    scheduler->add_scheduler_mode(scheduler_mode::enable_stealing);
+}
+
+int hpx_main()
+{
+    using hpx::threads::policies::scheduler_mode;
+
+    auto* pool = hpx::this_thread::get_pool();
+    auto* scheduler = pool->get_scheduler();
+    HPX_TEST(
+        scheduler->has_scheduler_mode(scheduler_mode::enable_handoff_wakeup));
+
+    pool->get_handoff_count(-1, true);
+
+    ping_pong_futures();
+    ping_pong_condition_variable();
+    ping_pong_channels();
+
+    HPX_TEST_LT(std::int64_t(0), pool->get_handoff_count(-1, true));
+
+    handoff_runs_next();
+    handoff_not_stranded(true);
+    handoff_not_stranded(false);
+
+    // switching the mode off at runtime makes all wake-ups go through the
+    // scheduler queues again
+    scheduler->remove_scheduler_mode(scheduler_mode::enable_handoff_wakeup);
+    pool->get_handoff_count(-1, true);
+
+    ping_pong_futures();
+    ping_pong_condition_variable();
+    ping_pong_channels();
+
+    HPX_TEST_EQ(pool->get_handoff_count(-1, true), std::int64_t(0));
+
+    return hpx::local::finalize();
+}
+
+void test_scheduler(
+    int argc, char* argv[], hpx::resource::scheduling_policy policy)
+{
+    using hpx::threads::policies::scheduler_mode;
+
+    hpx::local::init_params init_args;
+    init_args.rp_callback = [policy](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default", policy,
+            scheduler_mode::default_ | scheduler_mode::enable_handoff_wakeup);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    test_scheduler(
+        argc, argv, hpx::resource::scheduling_policy::local_priority_fifo);
+    test_scheduler(argc, argv, hpx::resource::scheduling_policy::local);
+    test_scheduler(
+        argc, argv, hpx::resource::scheduling_policy::shared_priority);
+    test_scheduler(argc, argv,
+        hpx::resource::scheduling_policy::local_workrequesting_fifo);
+
+    return hpx::util::report_errors();
+}
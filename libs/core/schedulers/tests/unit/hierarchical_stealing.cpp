@@ -0,0 +1,109 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the shared_priority_queue_scheduler balances work by stealing
+// from its rings of victims and that the steals are accounted for in the
+// per-ring counters.
+
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/topology/topology.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+std::atomic<std::size_t> count(0);
+
+void test_cache_groups()
+{
+    auto const& topo = hpx::threads::create_topology();
+    for (std::size_t pu = 0; pu != topo.get_number_of_pus(); ++pu)
+    {
+        auto const& group = topo.get_cache_group_affinity_mask(pu);
+        auto const& numa = topo.get_numa_node_affinity_mask(pu);
+
+        // a cache group never spans more than a single NUMA domain
+        HPX_TEST(hpx::threads::test(group, pu));
+        HPX_TEST(hpx::threads::equal(group & numa, group));
+        HPX_TEST_LT(
+            topo.get_cache_group_number(pu), topo.get_number_of_cache_groups());
+    }
+}
+
+std::int64_t get_num_stolen(std::size_t num_thread, bool reset)
+{
+    auto* scheduler = hpx::this_thread::get_pool()->get_scheduler();
+    return scheduler->get_num_stolen_from_core_group(num_thread, reset) +
+        scheduler->get_num_stolen_from_numa_domain(num_thread, reset) +
+        scheduler->get_num_stolen_from_remote(num_thread, reset);
+}
+
+void test_stealing()
+{
+    get_num_stolen(std::size_t(-1), true);
+
+    // all tasks are created by this thread, the other worker threads have to
+    // steal them
+    std::size_t const num_tasks = 1000;
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([]() {
+            auto const start = hpx::chrono::high_resolution_clock::now();
+            while (hpx::chrono::high_resolution_clock::now() - start < 100000)
+            {
+            }
+            ++count;
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(count.load(), num_tasks);
+
+    std::int64_t const total = get_num_stolen(std::size_t(-1), false);
+    HPX_TEST_LT(std::int64_t(0), total);
+
+    std::int64_t sum = 0;
+    for (std::size_t i = 0; i != hpx::get_num_worker_threads(); ++i)
+    {
+        sum += get_num_stolen(i, false);
+    }
+    HPX_TEST_EQ(sum, total);
+
+    get_num_stolen(std::size_t(-1), true);
+    HPX_TEST_EQ(get_num_stolen(std::size_t(-1), false), std::int64_t(0));
+}
+
+int hpx_main()
+{
+    test_cache_groups();
+    test_stealing();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool(
+            "default", hpx::resource::scheduling_policy::shared_priority);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
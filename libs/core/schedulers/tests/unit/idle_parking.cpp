@@ -0,0 +1,113 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that schedulers running with the enable_idle_parking mode reliably
+// wake up parked workers whenever new work arrives, both for bursts of work
+// and for sporadic arrivals.
+
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+std::atomic<std::size_t> count(0);
+
+void spawn_tasks(std::size_t num_tasks)
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([]() { ++count; }));
+    }
+
+    hpx::wait_all(tasks);
+}
+
+int hpx_main()
+{
+    using hpx::threads::policies::scheduler_mode;
+
+    auto* scheduler = hpx::this_thread::get_pool()->get_scheduler();
+    HPX_TEST(
+        scheduler->has_scheduler_mode(scheduler_mode::enable_idle_parking));
+
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+    std::size_t const num_tasks = 1000;
+
+    // bursts of work separated by idle periods long enough for all workers
+    // to be parked
+    for (int round = 0; round != 5; ++round)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        count = 0;
+
+        std::vector<hpx::future<void>> spawners;
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            spawners.push_back(hpx::async(&spawn_tasks, num_tasks));
+        }
+        hpx::wait_all(spawners);
+
+        HPX_TEST_EQ(count.load(), num_threads * num_tasks);
+    }
+
+    // sporadic arrivals of single tasks
+    count = 0;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        hpx::this_thread::sleep_for(std::chrono::microseconds(i * 10));
+        hpx::async([]() { ++count; }).get();
+    }
+    HPX_TEST_EQ(count.load(), std::size_t(100));
+
+    // switching the mode off at runtime has to wake up all parked workers
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(50));
+    scheduler->remove_scheduler_mode(scheduler_mode::enable_idle_parking);
+
+    count = 0;
+    spawn_tasks(num_tasks);
+    HPX_TEST_EQ(count.load(), num_tasks);
+
+    return hpx::local::finalize();
+}
+
+void test_scheduler(
+    int argc, char* argv[], hpx::resource::scheduling_policy policy)
+{
+    using hpx::threads::policies::scheduler_mode;
+
+    hpx::local::init_params init_args;
+    init_args.rp_callback = [policy](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default", policy,
+            scheduler_mode::default_ | scheduler_mode::enable_idle_parking);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    test_scheduler(
+        argc, argv, hpx::resource::scheduling_policy::local_priority_fifo);
+    test_scheduler(argc, argv, hpx::resource::scheduling_policy::local);
+    test_scheduler(
+        argc, argv, hpx::resource::scheduling_policy::shared_priority);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,154 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that schedulers running with the lockfree_thread_reclamation mode
+// properly recycle terminated threads, both if a thread terminates on the
+// worker owning it and if it terminates on a different worker.
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+std::atomic<std::size_t> count(0);
+
+void spawn_tasks(std::size_t num_tasks)
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([]() { ++count; }));
+    }
+
+    hpx::wait_all(tasks);
+}
+
+// count the terminated threads which are still registered with the queues
+std::int64_t count_terminated_thread_objects()
+{
+    std::int64_t num_objects = 0;
+    hpx::this_thread::get_pool()->get_scheduler()->enumerate_threads(
+        [&](hpx::threads::thread_id_type) {
+            ++num_objects;
+            return true;
+        },
+        hpx::threads::thread_schedule_state::terminated);
+    return num_objects;
+}
+
+// Make every worker delete all of its terminated threads (only the worker
+// owning a queue may release the threads it has recycled without locking).
+void test_delete_all(std::size_t num_threads)
+{
+    auto* sched = hpx::this_thread::get_pool()->get_scheduler();
+
+    std::int64_t const terminated_before = sched->get_thread_count(
+        hpx::threads::thread_schedule_state::terminated);
+    std::int64_t const objects_before = count_terminated_thread_objects();
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        auto exec = hpx::execution::parallel_executor(
+            hpx::threads::thread_priority::bound,
+            hpx::threads::thread_stacksize::default_,
+            hpx::threads::thread_schedule_hint(
+                hpx::threads::thread_schedule_hint_mode::thread,
+                static_cast<std::int16_t>(i)));
+
+        hpx::async(exec, [sched, i]() {
+            HPX_TEST_EQ(hpx::get_worker_thread_num(), i);
+            sched->cleanup_terminated(i, true);
+        }).get();
+    }
+
+    // only the threads used to run the cleanup tasks themselves may have
+    // terminated since
+    std::int64_t const terminated_after = sched->get_thread_count(
+        hpx::threads::thread_schedule_state::terminated);
+    std::int64_t const objects_after = count_terminated_thread_objects();
+
+    auto const max_remaining = static_cast<std::int64_t>(num_threads);
+    HPX_TEST_LTE(terminated_after, max_remaining);
+    HPX_TEST_LTE(objects_after, max_remaining);
+
+    // the terminated threads recycled while running the tasks above must
+    // have been released
+    if (terminated_before + objects_before > 2 * max_remaining)
+    {
+        HPX_TEST_LT(terminated_after + objects_after,
+            terminated_before + objects_before);
+    }
+}
+
+int hpx_main()
+{
+    using hpx::threads::policies::scheduler_mode;
+
+    HPX_TEST(hpx::this_thread::get_pool()->get_scheduler()->has_scheduler_mode(
+        scheduler_mode::lockfree_thread_reclamation));
+
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+    std::size_t const num_tasks = 10000;
+
+    for (int round = 0; round != 3; ++round)
+    {
+        count = 0;
+
+        // spawn tasks from all workers, tasks are stolen and terminated on
+        // arbitrary workers
+        std::vector<hpx::future<void>> spawners;
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            spawners.push_back(hpx::async(&spawn_tasks, num_tasks));
+        }
+        hpx::wait_all(spawners);
+
+        HPX_TEST_EQ(count.load(), num_threads * num_tasks);
+    }
+
+    test_delete_all(num_threads);
+
+    return hpx::local::finalize();
+}
+
+void test_scheduler(
+    int argc, char* argv[], hpx::resource::scheduling_policy policy)
+{
+    using hpx::threads::policies::scheduler_mode;
+
+    hpx::local::init_params init_args;
+    init_args.rp_callback = [policy](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default", policy,
+            scheduler_mode::default_ |
+                scheduler_mode::lockfree_thread_reclamation);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    test_scheduler(
+        argc, argv, hpx::resource::scheduling_policy::local_priority_fifo);
+    test_scheduler(argc, argv, hpx::resource::scheduling_policy::local);
+    test_scheduler(argc, argv,
+        hpx::resource::scheduling_policy::local_workrequesting_fifo);
+
+    return hpx::util::report_errors();
+}
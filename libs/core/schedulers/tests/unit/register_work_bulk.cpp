@@ -0,0 +1,122 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that threads created using register_work_bulk are all run, for
+// threads with and without a schedule hint and with mixed priorities.
+
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::threads::make_thread_function_nullary;
+using hpx::threads::thread_init_data;
+using hpx::threads::thread_priority;
+using hpx::threads::thread_schedule_hint;
+using hpx::threads::thread_schedule_state;
+using hpx::threads::thread_stacksize;
+
+std::atomic<std::size_t> count(0);
+
+thread_init_data make_task(hpx::latch& l,
+    thread_priority priority = thread_priority::default_,
+    thread_schedule_hint hint = thread_schedule_hint(),
+    thread_schedule_state state = thread_schedule_state::pending)
+{
+    return thread_init_data(make_thread_function_nullary([&l]() {
+        ++count;
+        l.count_down(1);
+    }),
+        "register_work_bulk", priority, hint, thread_stacksize::default_,
+        state);
+}
+
+void test_bulk(std::size_t num_tasks)
+{
+    count = 0;
+
+    hpx::latch l(static_cast<std::ptrdiff_t>(num_tasks + 1));
+
+    std::vector<thread_init_data> data;
+    data.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        data.push_back(make_task(l));
+    }
+
+    hpx::threads::register_work_bulk(data.data(), data.size());
+    l.arrive_and_wait();
+
+    HPX_TEST_EQ(count.load(), num_tasks);
+}
+
+void test_bulk_mixed()
+{
+    count = 0;
+
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+    std::size_t const num_tasks = 100 * num_threads;
+
+    hpx::latch l(static_cast<std::ptrdiff_t>(num_tasks + 1));
+
+    std::vector<thread_init_data> data;
+    data.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        // runs of threads with the same hint interleaved with threads
+        // without a hint and threads with a different priority
+        thread_schedule_hint hint;
+        if ((i / 10) % 2 == 0)
+        {
+            hint = thread_schedule_hint(
+                static_cast<std::int16_t>((i / 20) % num_threads));
+        }
+
+        data.push_back(make_task(l,
+            i % 7 == 0 ? thread_priority::high : thread_priority::normal,
+            hint));
+    }
+
+    hpx::threads::register_work_bulk(data.data(), data.size());
+    l.arrive_and_wait();
+
+    HPX_TEST_EQ(count.load(), num_tasks);
+}
+
+void test_bulk_invalid_state()
+{
+    hpx::latch l(1);
+
+    std::vector<thread_init_data> data;
+    data.push_back(make_task(l, thread_priority::default_,
+        thread_schedule_hint(), thread_schedule_state::suspended));
+
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    hpx::threads::register_work_bulk(data.data(), data.size(), ec);
+    HPX_TEST(ec);
+}
+
+int hpx_main()
+{
+    test_bulk(0);
+    test_bulk(1);
+    test_bulk(10000);
+    test_bulk_mixed();
+    test_bulk_invalid_state();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,98 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the local_workrequesting_scheduler balances work placed on a
+// single worker thread by answering steal requests and that the tasks sent in
+// response are accounted for in the corresponding counters.
+
+#include <hpx/chrono.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+using hpx::threads::make_thread_function_nullary;
+using hpx::threads::register_work;
+using hpx::threads::thread_init_data;
+using hpx::threads::thread_schedule_hint;
+
+std::atomic<std::size_t> count(0);
+
+void test_steal_requests(bool staged)
+{
+    auto* scheduler = hpx::this_thread::get_pool()->get_scheduler();
+    scheduler->get_num_steal_requests_satisfied(std::size_t(-1), true);
+    scheduler->get_num_steal_requests_tasks_sent(std::size_t(-1), true);
+
+    count = 0;
+
+    // all tasks are placed on the first worker thread, the other worker
+    // threads have to request them
+    std::size_t const num_tasks = 1000;
+    hpx::latch l(num_tasks + 1);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        thread_init_data data(make_thread_function_nullary([&l]() {
+            auto const start = hpx::chrono::high_resolution_clock::now();
+            while (hpx::chrono::high_resolution_clock::now() - start < 100000)
+            {
+            }
+            ++count;
+            l.count_down(1);
+        }),
+            "steal_half_task", hpx::threads::thread_priority::normal,
+            thread_schedule_hint(0));
+        data.run_now = !staged;
+        register_work(data);
+    }
+    l.arrive_and_wait();
+
+    HPX_TEST_EQ(count.load(), num_tasks);
+
+    std::int64_t const satisfied =
+        scheduler->get_num_steal_requests_satisfied(std::size_t(-1), false);
+    std::int64_t const sent =
+        scheduler->get_num_steal_requests_tasks_sent(std::size_t(-1), false);
+
+    HPX_TEST_LT(std::int64_t(0), satisfied);
+    HPX_TEST_LTE(satisfied, sent);
+    HPX_TEST_LTE(sent, std::int64_t(num_tasks));
+
+    std::int64_t sum = 0;
+    for (std::size_t i = 0; i != hpx::get_num_worker_threads(); ++i)
+    {
+        sum += scheduler->get_num_steal_requests_tasks_sent(i, false);
+    }
+    HPX_TEST_EQ(sum, sent);
+}
+
+int hpx_main()
+{
+    test_steal_requests(false);
+    test_steal_requests(true);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default",
+            hpx::resource::scheduling_policy::local_workrequesting_fifo);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
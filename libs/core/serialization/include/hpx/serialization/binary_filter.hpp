@@ -27,11 +27,29 @@ namespace hpx::serialization {
         virtual bool flush(
             void* dst, std::size_t dst_count, std::size_t& written) = 0;
 
+        // Filters may compress large chunks of data (which would otherwise
+        // be sent as separate zero-copy chunks) as well. Returning true
+        // takes over the chunk, the referenced data has to stay valid until
+        // flush has been called.
+        virtual bool save_chunk(
+            void const* /* src */, std::size_t /* src_count */)
+        {
+            return false;
+        }
+
         // decompression API
         virtual std::size_t init_data(
             void const* buffer, std::size_t size, std::size_t buffer_size) = 0;
         virtual void load(void* dst, std::size_t dst_count) = 0;
 
+        // Load a chunk of data which was handed to save_chunk. Returns false
+        // if the filter has not taken over the chunk, the data was sent as a
+        // separate zero-copy chunk in this case.
+        virtual bool load_chunk(void* /* dst */, std::size_t /* dst_count */)
+        {
+            return false;
+        }
+
         template <typename T>
         constexpr void serialize(T& /*ar*/, unsigned) noexcept
         {
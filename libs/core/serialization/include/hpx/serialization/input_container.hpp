@@ -170,15 +170,36 @@ namespace hpx::serialization {
             HPX_ASSERT(static_cast<std::int64_t>(count) >= 0);
 
             if (chunks_ == nullptr ||
-                count < zero_copy_serialization_threshold_ ||
-                filter_ != nullptr)
+                count < zero_copy_serialization_threshold_)
             {
                 // fall back to serialization_chunk-less archive
                 this->input_container::load_binary(address, count);
             }
-            else
+            else if (filter_ == nullptr || !filter_->load_chunk(address, count))
             {
+                // the data was sent as a separate zero-copy chunk, the
+                // filter (if any) has not taken over the chunk
                 HPX_ASSERT(current_chunk_ != static_cast<std::size_t>(-1));
+
+                // the data of compressed archives is not described by index
+                // chunks, skip those
+                if (filter_ != nullptr)
+                {
+                    while (current_chunk_ != get_num_chunks() &&
+                        get_chunk_type(current_chunk_) !=
+                            chunk_type::chunk_type_pointer)
+                    {
+                        ++current_chunk_;
+                    }
+
+                    if (current_chunk_ == get_num_chunks())
+                    {
+                        HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                            "input_container::load_binary_chunk",
+                            "archive data bstream data chunk is missing");
+                    }
+                }
+
                 HPX_ASSERT(get_chunk_type(current_chunk_) ==
                     chunk_type::chunk_type_pointer);
 
@@ -177,6 +177,14 @@ namespace hpx::serialization {
             return base_type::current_pos();
         }
 
+        // Continue counting the written bytes at the given position. This is
+        // used for archives whose data is appended to another archive later
+        // on, it keeps the positions of tracked pointers distinct.
+        constexpr void set_current_pos(std::size_t pos) noexcept
+        {
+            size_ = pos;
+        }
+
         void reset()
         {
             buffer_->reset();
@@ -366,6 +366,12 @@ namespace hpx::serialization {
                 this->current_ += count;
                 return count;
             }
+            else if (filter_ != nullptr && filter_->save_chunk(address, count))
+            {
+                // the filter has taken over the chunk
+                this->current_ += count;
+                return count;
+            }
             else
             {
                 return this->base_type::save_binary_chunk(address, count);
@@ -84,6 +84,9 @@ namespace hpx::threads::detail {
         thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) override;
 
+        void create_work_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override;
+
         thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
             thread_priority priority, error_code& ec) override;
@@ -232,6 +235,48 @@ namespace hpx::threads::detail {
             return sched_->Scheduler::get_queue_length(num_thread);
         }
 
+        std::int64_t get_num_deadline_misses(
+            std::size_t num_thread, bool reset) override
+        {
+            return sched_->Scheduler::get_num_deadline_misses(
+                num_thread, reset);
+        }
+
+        std::int64_t get_num_stolen_from_core_group(
+            std::size_t num_thread, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_from_core_group(
+                num_thread, reset);
+        }
+
+        std::int64_t get_num_stolen_from_numa_domain(
+            std::size_t num_thread, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_from_numa_domain(
+                num_thread, reset);
+        }
+
+        std::int64_t get_num_stolen_from_remote(
+            std::size_t num_thread, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_from_remote(
+                num_thread, reset);
+        }
+
+        std::int64_t get_num_steal_requests_satisfied(
+            std::size_t num_thread, bool reset) override
+        {
+            return sched_->Scheduler::get_num_steal_requests_satisfied(
+                num_thread, reset);
+        }
+
+        std::int64_t get_num_steal_requests_tasks_sent(
+            std::size_t num_thread, bool reset) override
+        {
+            return sched_->Scheduler::get_num_steal_requests_tasks_sent(
+                num_thread, reset);
+        }
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         std::int64_t get_average_thread_wait_time(
             std::size_t num_thread, bool /* reset */) override
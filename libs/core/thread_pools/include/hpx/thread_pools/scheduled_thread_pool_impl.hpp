@@ -10,6 +10,7 @@
 #include <hpx/affinity/affinity_data.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concurrency/barrier.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/detail/invoke.hpp>
@@ -72,6 +73,11 @@ namespace hpx::threads::detail {
             pool_.sched_->Scheduler::on_stop_thread(local_thread_num_);
             pool_.notifier_.on_stop_thread(local_thread_num_,
                 global_thread_num_, pool_.get_pool_id().name().c_str(), "");
+
+            // hand the stacks cached by this worker back to the global tier
+            // of the stack pool
+            threads::detail::release_spare_stackless_runner();
+            coroutines::detail::stack_pool::release_local_cache();
         }
 
         scheduled_thread_pool<Scheduler>& pool_;
@@ -240,7 +246,7 @@ namespace hpx::threads::detail {
             sched_->Scheduler::set_all_states_at_least(hpx::state::stopping);
 
             // make sure we're not waiting
-            sched_->Scheduler::do_some_work(static_cast<std::size_t>(-1));
+            sched_->Scheduler::notify_all_workers();
 
             if (blocking)
             {
@@ -253,8 +259,7 @@ namespace hpx::threads::detail {
                     // make sure no OS thread is waiting
                     LTM_(info).format("stop: {} notify_all", id_.name());
 
-                    sched_->Scheduler::do_some_work(
-                        static_cast<std::size_t>(-1));
+                    sched_->Scheduler::notify_all_workers();
 
                     LTM_(info).format("stop: {} join:{}", id_.name(), i);
 
@@ -664,6 +669,38 @@ namespace hpx::threads::detail {
         return id;
     }
 
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::create_work_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        // verify state
+        if (thread_count_ == 0 &&
+            !sched_->Scheduler::is_state(hpx::state::running))
+        {
+            // thread-manager is not currently running
+            HPX_THROWS_IF(ec, hpx::error::invalid_status,
+                "thread_pool<Scheduler>::create_work_bulk",
+                "invalid state: thread pool is not running");
+            return;
+        }
+
+        if (!sched_->Scheduler::supports_direct_execution())
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                data[i].schedulehint.runs_as_child_mode(
+                    hpx::threads::thread_execution_hint::none);
+            }
+        }
+
+        detail::create_work_bulk(sched_.get(), data, count, ec);    //-V601
+        if (&ec != &throws && ec)
+            return;
+
+        // update statistics
+        tasks_scheduled_ += static_cast<std::int64_t>(count);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Scheduler>
     thread_state scheduled_thread_pool<Scheduler>::set_state(
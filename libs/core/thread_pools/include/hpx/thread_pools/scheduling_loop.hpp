@@ -19,6 +19,7 @@
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 
 #if defined(HPX_HAVE_ITTNOTIFY) && HPX_HAVE_ITTNOTIFY != 0 &&                  \
     !defined(HPX_HAVE_APEX)
@@ -28,6 +29,7 @@
 #include <hpx/threading_base/external_timer.hpp>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -136,8 +138,13 @@ namespace hpx::threads::detail {
             context_storage =
                 hpx::execution_base::this_thread::detail::get_agent_storage();
 
+        // the adaptive idle parking policy tunes the number of idle loops
+        // before invoking the idle callback for each worker separately
+        scheduler.init_idle_parking(num_thread, params.max_idle_loop_count_);
+
         auto added = static_cast<std::size_t>(-1);
         thread_id_ref_type next_thrd;
+        bool may_handoff = false;
         while (true)
         {
             thread_id_ref_type thrd = HPX_MOVE(next_thrd);
@@ -147,12 +154,43 @@ namespace hpx::threads::detail {
             bool running = this_state.load(std::memory_order_relaxed) <
                 hpx::state::pre_sleep;
 
+            bool const cpu_quota = scheduler.has_cpu_quota();
+
+            // run the thread woken up by the previous HPX thread next if that
+            // thread has suspended or terminated, otherwise make it visible
+            // to all workers by queuing it (see enable_handoff_wakeup)
+            if (HPX_UNLIKELY(scheduler.has_handoff_thread(num_thread)))
+            {
+                if (!thrd && may_handoff && running && !cpu_quota)
+                {
+                    thrd = scheduler.take_handoff_thread(num_thread);
+                }
+                else
+                {
+                    scheduler.flush_handoff_thread(num_thread);
+                }
+            }
+            may_handoff = false;
+
+            // block this worker while the CPU budget of the pool is exhausted
+            if (cpu_quota && running)
+            {
+                scheduler.cpu_quota_throttle(num_thread);
+            }
+
             // extract the stealing mode once per loop iteration (except during
             // shutdown)
             bool enable_stealing = !may_exit &&
                 scheduler.has_scheduler_mode(
                     policies::scheduler_mode::enable_stealing);
 
+            bool const idle_parking = scheduler.has_scheduler_mode(
+                policies::scheduler_mode::enable_idle_parking);
+            std::int64_t const max_idle_loop_count = idle_parking ?
+                (std::min)(scheduler.get_idle_spin_count(num_thread),
+                    params.max_idle_loop_count_) :
+                params.max_idle_loop_count_;
+
             // stealing staged threads is enabled if:
             // - fast idle mode is on: same as normal stealing
             // - fast idle mode off: only after normal stealing has failed for
@@ -162,8 +200,8 @@ namespace hpx::threads::detail {
                 !scheduler.has_scheduler_mode(
                     policies::scheduler_mode::fast_idle_mode))
             {
-                enable_stealing_staged = !may_exit &&
-                    idle_loop_count > params.max_idle_loop_count_ / 2;
+                enable_stealing_staged =
+                    !may_exit && idle_loop_count > max_idle_loop_count / 2;
             }
 
             if (HPX_LIKELY(thrd ||
@@ -173,6 +211,12 @@ namespace hpx::threads::detail {
                 HPX_ASSERT(get_thread_id_data(thrd)->get_scheduler_base() ==
                     &scheduler);
 
+                if (idle_parking)
+                {
+                    scheduler.idle_parking_found_work(
+                        num_thread, idle_loop_count);
+                }
+
                 idle_loop_count = 0;
                 ++busy_loop_count;
 
@@ -208,6 +252,12 @@ namespace hpx::threads::detail {
                                     idle_rate.take_snapshot();
                                 });
 #endif
+                            // the time spent executing the thread is charged
+                            // against the CPU budget of the pool
+                            std::uint64_t const quota_start = cpu_quota ?
+                                hpx::chrono::high_resolution_clock::now() :
+                                0;
+
                             // thread returns new required state store the
                             // returned state in the thread
                             {
@@ -269,6 +319,15 @@ namespace hpx::threads::detail {
 #endif
                             }
 
+                            if (cpu_quota)
+                            {
+                                scheduler.cpu_quota_consume(
+                                    static_cast<std::int64_t>(
+                                        hpx::chrono::high_resolution_clock::
+                                            now() -
+                                        quota_start));
+                            }
+
                             detail::write_state_log(scheduler, num_thread, thrd,
                                 thread_schedule_state::active,
                                 thrd_stat.get_previous());
@@ -301,6 +360,13 @@ namespace hpx::threads::detail {
 
                         state_val = state.state();
 
+                        // a thread woken up by this thread may run next only
+                        // if this thread does not continue to run
+                        may_handoff =
+                            state_val == thread_schedule_state::suspended ||
+                            state_val == thread_schedule_state::terminated ||
+                            state_val == thread_schedule_state::deleted;
+
                         // any exception thrown from the thread will reset its
                         // state at this point
 
@@ -414,7 +480,15 @@ namespace hpx::threads::detail {
             {
                 ++idle_loop_count;
 
+                // run threads handed to workers which are busy running the
+                // waking thread
                 next_thrd = thread_id_ref_type();
+                if (enable_stealing &&
+                    scheduler.steal_handoff_thread(num_thread, next_thrd))
+                {
+                    continue;
+                }
+
                 if (scheduler.wait_or_add_new(num_thread, running,
                         idle_loop_count, enable_stealing_staged, added,
                         &next_thrd))
@@ -424,7 +498,8 @@ namespace hpx::threads::detail {
                         scheduler.SchedulingPolicy::cleanup_terminated(
                             num_thread, true) &&
                         scheduler.SchedulingPolicy::get_queue_length(
-                            num_thread) == 0;
+                            num_thread) == 0 &&
+                        scheduler.get_handoff_queue_length() == 0;
 
                     if (this_state.load(std::memory_order_relaxed) ==
                         hpx::state::pre_sleep)
@@ -543,9 +618,9 @@ namespace hpx::threads::detail {
                         background_running, idle_loop_count);
                 }
             }
-            else if (idle_loop_count > params.max_idle_loop_count_ || may_exit)
+            else if (idle_loop_count > max_idle_loop_count || may_exit)
             {
-                if (idle_loop_count > params.max_idle_loop_count_)
+                if (idle_loop_count > max_idle_loop_count)
                     idle_loop_count = 0;
 
                 // call back into invoking context
@@ -10,9 +10,17 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
 
+#include <cstddef>
+
 namespace hpx::threads::detail {
 
     HPX_CORE_EXPORT thread_id_ref_type create_work(
         policies::scheduler_base* scheduler, threads::thread_init_data& data,
         error_code& ec = throws);
+
+    // Create a number of new work items using a single call into the
+    // scheduler. All work items must have 'pending' as their initial state.
+    HPX_CORE_EXPORT void create_work_bulk(policies::scheduler_base* scheduler,
+        threads::thread_init_data* data, std::size_t count,
+        error_code& ec = throws);
 }    // namespace hpx::threads::detail
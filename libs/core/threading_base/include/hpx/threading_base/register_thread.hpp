@@ -14,6 +14,7 @@
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
 
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -157,6 +158,40 @@ namespace hpx::threads {
     ///                   of hpx#exception.
     HPX_CORE_EXPORT thread_id_ref_type register_work(
         threads::thread_init_data& data, error_code& ec = throws);
+
+    /// \brief Create a number of new work items using the given data with a
+    ///        single call into the scheduler.
+    ///
+    /// \param data       [in] The data to use for creating the threads.
+    /// \param count      [in] The number of elements pointed to by \a data.
+    /// \param pool       [in] The thread pool to use for launching the work.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws the
+    ///                   function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    ///
+    /// \note             All work items must have 'pending' as their initial
+    ///                   state, the ids of the new threads are not returned.
+    ///                   The work items are distributed over the queues of
+    ///                   the scheduler unless they carry a schedule hint.
+    HPX_CORE_EXPORT void register_work_bulk(threads::thread_init_data* data,
+        std::size_t count, threads::thread_pool_base* pool,
+        error_code& ec = hpx::throws);
+
+    /// \brief Create a number of new work items using the given data on the
+    ///        same thread pool as the calling thread, or on the default
+    ///        thread pool if not on an HPX thread.
+    ///
+    /// \param data       [in] The data to use for creating the threads.
+    /// \param count      [in] The number of elements pointed to by \a data.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    HPX_CORE_EXPORT void register_work_bulk(threads::thread_init_data* data,
+        std::size_t count, error_code& ec = throws);
 }    // namespace hpx::threads
 
 /// \endcond
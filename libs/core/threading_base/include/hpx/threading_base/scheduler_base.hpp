@@ -24,11 +24,13 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <iosfwd>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -106,6 +108,130 @@ namespace hpx::threads::policies {
         /// possibly idling OS threads
         void do_some_work(std::size_t);
 
+        /// Reactivate all possibly idling OS threads. This is used whenever
+        /// all of them have to observe a change of the scheduler state (e.g.
+        /// while the pool is being stopped).
+        void notify_all_workers();
+
+        /// Initialize the adaptive idle parking policy for the given worker,
+        /// max_idle_loop_count is the upper limit for the number of idle loop
+        /// iterations the worker will spin before backing off.
+        void init_idle_parking(
+            std::size_t num_thread, std::int64_t max_idle_loop_count) noexcept;
+
+        /// Return the number of idle loop iterations the given worker should
+        /// spin before invoking idle_callback (see enable_idle_parking).
+        std::int64_t get_idle_spin_count(
+            [[maybe_unused]] std::size_t num_thread) const noexcept
+        {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            return idle_parking_data_[num_thread].data_.spin_count_;
+#else
+            return (std::numeric_limits<std::int64_t>::max)();
+#endif
+        }
+
+        /// This function gets called by the scheduling loop whenever a worker
+        /// has found new work after having been idle for idle_loop_count
+        /// iterations. It is used to adapt the spin length of the worker.
+        void idle_parking_found_work([[maybe_unused]] std::size_t num_thread,
+            [[maybe_unused]] std::int64_t idle_loop_count) noexcept
+        {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            idle_parking_data const& data =
+                idle_parking_data_[num_thread].data_;
+            if (idle_loop_count != 0 || data.wait_count_ != 0 ||
+                data.has_parked_)
+            {
+                update_idle_spin_count(num_thread, idle_loop_count);
+            }
+#endif
+        }
+
+        /// Limit the share of time the worker threads of this scheduler spend
+        /// executing HPX threads to the given quota (a value in (0, 1]) of the
+        /// time of their processing units. A quota of 1 removes the limit. The
+        /// budget is managed as a token bucket that is continuously refilled
+        /// and holds at most the budget of one period, which bounds the length
+        /// of bursts.
+        void set_cpu_quota(double quota,
+            std::chrono::microseconds period = std::chrono::milliseconds(10));
+        double get_cpu_quota() const noexcept
+        {
+            return cpu_quota_.data_.quota_.load(std::memory_order_relaxed);
+        }
+
+        /// Return whether a CPU quota is being enforced for this scheduler
+        bool has_cpu_quota() const noexcept
+        {
+            return cpu_quota_.data_.rate_.load(std::memory_order_relaxed) !=
+                0.0;
+        }
+
+        /// This function gets called by the scheduling loop before looking
+        /// for new work if a CPU quota is enforced. It blocks the given worker
+        /// for as long as the budget is exhausted.
+        void cpu_quota_throttle(std::size_t num_thread);
+
+        /// This function gets called by the scheduling loop after having run
+        /// an HPX thread for exec_time nanoseconds.
+        void cpu_quota_consume(std::int64_t exec_time) noexcept
+        {
+            cpu_quota_.data_.tokens_.fetch_sub(
+                exec_time, std::memory_order_relaxed);
+        }
+
+        // Return the time (in nanoseconds) the given worker was blocked and
+        // the number of times it was blocked because of an exhausted budget
+        std::int64_t get_cpu_quota_throttled_time(
+            std::size_t num_thread, bool reset) noexcept;
+        std::int64_t get_cpu_quota_throttled_count(
+            std::size_t num_thread, bool reset) noexcept;
+
+        /// Try to hand the given thread, which has just been made pending, to
+        /// the worker executing the calling HPX thread instead of queuing it
+        /// (see enable_handoff_wakeup). Returns false if the thread has to be
+        /// scheduled as usual.
+        bool try_handoff_thread(thread_id_type const& thrd,
+            thread_schedule_hint schedulehint) noexcept;
+
+        /// Return whether a thread was handed to the given worker
+        bool has_handoff_thread(std::size_t num_thread) const noexcept
+        {
+            HPX_ASSERT(num_thread < handoff_data_.size());
+            return handoff_data_[num_thread].data_.thread_.load(
+                       std::memory_order_relaxed) != nullptr;
+        }
+
+        /// Remove the thread that was handed to the given worker, if any.
+        /// This function gets called by the scheduling loop to run the thread
+        /// right after the waking thread has suspended or terminated.
+        thread_id_ref_type take_handoff_thread(std::size_t num_thread) noexcept;
+
+        /// Move the thread that was handed to the given worker, if any, to
+        /// the scheduler queues. This function gets called by the scheduling
+        /// loop if the waking thread continues to run (yields), or if the
+        /// worker is about to stop running threads.
+        void flush_handoff_thread(std::size_t num_thread);
+
+        /// Try to take a thread that was handed to any worker other than the
+        /// given one, this is used by idle workers to make sure handed over
+        /// threads are not stranded while the waking thread keeps running.
+        bool steal_handoff_thread(
+            std::size_t num_thread, thread_id_ref_type& thrd) noexcept;
+
+        /// Return the number of threads currently waiting in the handoff
+        /// slots of all workers
+        std::int64_t get_handoff_queue_length() const noexcept
+        {
+            return handoff_queue_length_.load(std::memory_order_relaxed);
+        }
+
+        // Return the number of threads which were handed directly to the
+        // given worker
+        std::int64_t get_handoff_count(
+            std::size_t num_thread, bool reset) noexcept;
+
         virtual void suspend(std::size_t num_thread);
         virtual void resume(std::size_t num_thread);
 
@@ -196,6 +322,48 @@ namespace hpx::threads::policies {
         // Queries whether a given core is idle
         virtual bool is_core_idle(std::size_t num_thread) const = 0;
 
+        // Return the number of threads that have finished executing after
+        // their deadline (supported by deadline aware schedulers only)
+        virtual std::int64_t get_num_deadline_misses(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        // Return the number of threads stolen by the given worker thread from
+        // queues sharing its cache, located on its NUMA domain, or located on
+        // other NUMA domains (supported by hierarchically stealing schedulers
+        // only)
+        virtual std::int64_t get_num_stolen_from_core_group(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_from_numa_domain(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_from_remote(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        // Return the number of steal requests satisfied by the given worker
+        // thread and the number of tasks it has sent in response (supported
+        // by work-requesting schedulers only)
+        virtual std::int64_t get_num_steal_requests_satisfied(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_steal_requests_tasks_sent(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
         // count active background threads
         std::int64_t get_background_thread_count() const noexcept;
         void increment_background_thread_count() noexcept;
@@ -216,6 +384,12 @@ namespace hpx::threads::policies {
         virtual void create_thread(
             thread_init_data& data, thread_id_ref_type* id, error_code& ec) = 0;
 
+        // Create and schedule a number of new threads at once. The default
+        // implementation creates the threads one by one, schedulers may
+        // override this to create all threads with a single queue operation.
+        virtual void create_thread_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec);
+
         virtual void schedule_thread(threads::thread_id_ref_type thrd,
             threads::thread_schedule_hint schedulehint,
             bool allow_fallback = false,
@@ -291,8 +465,82 @@ namespace hpx::threads::policies {
             double max_idle_backoff_time_;
         };
         std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
+
+        // support for adaptive spin-then-yield-then-park on idle queues
+        struct idle_parking_data
+        {
+            // futex word, incremented whenever the worker is woken up
+            std::atomic<std::uint32_t> wake_epoch_;
+
+            // the worker has announced to be parked
+            std::atomic<bool> parked_;
+
+            // number of back-off rounds during the current idle period
+            std::uint32_t wait_count_;
+
+            // the worker was parked during the current idle period
+            bool has_parked_;
+
+            // current number of idle loop iterations before backing off,
+            // and its limits
+            std::int64_t spin_count_;
+            std::int64_t min_spin_count_;
+            std::int64_t max_spin_count_;
+
+            // smoothed number of idle loop iterations between work arrivals
+            std::int64_t arrival_gap_;
+        };
+        std::vector<util::cache_line_data<idle_parking_data>>
+            idle_parking_data_;
+        util::cache_line_data<std::atomic<std::size_t>> parked_count_;
+
+        // the worker to start looking for a parked worker to wake up from,
+        // for work which was not scheduled on a specific worker
+        util::cache_line_data<std::atomic<std::size_t>> unpark_cursor_;
+
+        void update_idle_spin_count(
+            std::size_t num_thread, std::int64_t idle_loop_count) noexcept;
+        void park(std::size_t num_thread);
+        bool unpark(std::size_t num_thread) noexcept;
 #endif
 
+        // support for CPU quotas, the budget (in nanoseconds) is shared by
+        // all workers
+        struct cpu_quota_data
+        {
+            std::atomic<double> quota_ = 1.0;
+
+            // budget added per nanosecond (zero if no quota is enforced)
+            std::atomic<double> rate_ = 0.0;
+
+            std::atomic<std::int64_t> tokens_ = 0;
+            std::atomic<std::int64_t> capacity_ = 0;
+            std::atomic<std::uint64_t> last_refill_ = 0;
+        };
+        util::cache_line_data<cpu_quota_data> cpu_quota_;
+
+        struct cpu_quota_counters
+        {
+            std::atomic<std::int64_t> throttled_time_ = 0;
+            std::atomic<std::int64_t> throttled_count_ = 0;
+        };
+        std::vector<util::cache_line_data<cpu_quota_counters>>
+            cpu_quota_counters_;
+
+        void cpu_quota_refill(std::uint64_t now) noexcept;
+
+        // support for handing woken threads directly to the waking worker,
+        // a thread is put into the slot by the owning worker only, while it
+        // can be taken by any worker (the slot holds a reference to the
+        // thread)
+        struct handoff_data
+        {
+            std::atomic<thread_id_ref_type::thread_repr*> thread_ = nullptr;
+            std::atomic<std::int64_t> count_ = 0;
+        };
+        std::vector<util::cache_line_data<handoff_data>> handoff_data_;
+        std::atomic<std::int64_t> handoff_queue_length_ = 0;
+
         // support for suspension of pus
         std::vector<pu_mutex_type> suspend_mtxs_;
         std::vector<std::condition_variable> suspend_conds_;
@@ -80,6 +80,31 @@ namespace hpx::threads::policies {
         /// 'normal' work scheduling is performed.
         do_background_work_only = 0x1000,
 
+        /// This option tells schedulers that support it to recycle terminated
+        /// threads without acquiring the queue mutex. Each worker collects the
+        /// threads it terminated in a local free list, threads terminated by
+        /// other workers are handed back in batches through the lock-free
+        /// queue of terminated threads.
+        lockfree_thread_reclamation = 0x2000,
+
+        /// This option replaces the exponential idle-back off with an adaptive
+        /// policy: idle worker threads spin, then yield, and finally park on a
+        /// per-worker futex. Adding new work wakes exactly one parked worker.
+        /// The spin length is continuously tuned based on the observed
+        /// arrival rate of new work.
+        enable_idle_parking = 0x4000,
+
+        /// This option makes HPX threads which are woken up by the thread
+        /// running on the same worker (e.g. while setting a future, unlocking a
+        /// mutex, notifying a condition variable, or writing to a channel) run
+        /// directly on that worker as soon as the waking thread suspends or
+        /// terminates, bypassing the scheduler queues. At most one woken
+        /// thread is handed over this way, any others are queued as usual.
+        /// The handed over thread is queued as well if the waking thread
+        /// yields instead, and idle workers may take it over while the waking
+        /// thread is still running.
+        enable_handoff_wakeup = 0x8000,
+
         // clang-format off
         /// This option represents the default mode.
         default_ =
@@ -106,7 +131,10 @@ namespace hpx::threads::policies {
             steal_high_priority_first |
             steal_after_local |
             enable_idle_backoff |
-            do_background_work_only
+            do_background_work_only |
+            lockfree_thread_reclamation |
+            enable_idle_parking |
+            enable_handoff_wakeup
         // clang-format on
     };
 
@@ -28,6 +28,7 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <forward_list>
@@ -443,6 +444,18 @@ namespace hpx::threads {
             priority_ = priority;
         }
 
+        // the absolute deadline of this thread, time_point::max() if none
+        constexpr std::chrono::steady_clock::time_point get_deadline()
+            const noexcept
+        {
+            return deadline_;
+        }
+        void set_deadline(
+            std::chrono::steady_clock::time_point deadline) noexcept
+        {
+            deadline_ = deadline;
+        }
+
         // handle thread interruption
         bool interruption_requested() const noexcept
         {
@@ -634,6 +647,7 @@ namespace hpx::threads {
 #endif
         ///////////////////////////////////////////////////////////////////////
         thread_priority priority_;
+        std::chrono::steady_clock::time_point deadline_;
 
         bool requested_interrupt_;
         bool enabled_interrupt_;
@@ -11,9 +11,13 @@
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/coroutine.hpp>
 #include <hpx/coroutines/stackless_coroutine.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/execution_base/agent_base.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/execution_agent.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/type_support/construct_at.hpp>
@@ -27,6 +31,66 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::threads {
 
+    namespace detail {
+
+        // this global variable controls whether the leaf tasks spawned by the
+        // parallel executors are run on stackless threads (set from
+        // hpx.stacks.stackless_leaf_tasks)
+        HPX_CORE_EXPORT extern bool use_stackless_leaf_tasks;
+
+        // Return the stack size to use for a leaf task that would otherwise
+        // run on a thread with the given stack size
+        inline thread_stacksize get_leaf_task_stacksize(
+            thread_stacksize stacksize = thread_stacksize::small_) noexcept
+        {
+            return use_stackless_leaf_tasks &&
+                    stacksize == thread_stacksize::small_ ?
+                thread_stacksize::nostack :
+                stacksize;
+        }
+
+        // Return the execution agent used while running the given stackless
+        // thread directly on the stack of the calling OS thread. Such a
+        // thread can't be suspended, this agent rejects any suspension with
+        // an exception.
+        HPX_CORE_EXPORT hpx::execution_base::agent_base& get_stackless_agent(
+            thread_data* thrd) noexcept;
+
+        // The stackful coroutine a stackless thread runs on if
+        // hpx.stacks.stackless_leaf_tasks is set. The runner is bound to the
+        // thread only while it executes, a thread that is suspended keeps its
+        // runner (and thus the stack) until it has run to completion.
+        struct stackless_runner
+        {
+            stackless_runner(coroutine_type::functor_type&& f,
+                thread_id_type id, std::ptrdiff_t stacksize)
+              : coroutine_(HPX_MOVE(f), HPX_MOVE(id), stacksize)
+              , agent_(coroutine_.impl())
+              , stacksize_(stacksize)
+            {
+            }
+
+            coroutine_type coroutine_;
+            execution_agent agent_;
+            std::ptrdiff_t stacksize_;
+        };
+
+        // Return a runner executing the given function on behalf of the
+        // given thread. Each worker thread keeps a spare runner which is
+        // reused by all stackless threads that complete without suspending,
+        // new runners take their stack from the stack pool.
+        HPX_CORE_EXPORT stackless_runner* acquire_stackless_runner(
+            coroutine_type::functor_type&& f, thread_id_type id,
+            std::ptrdiff_t stacksize);
+
+        // Hand back a runner whose function has completed
+        HPX_CORE_EXPORT void release_stackless_runner(
+            stackless_runner* runner) noexcept;
+
+        // Release the spare runner of the calling worker thread
+        HPX_CORE_EXPORT void release_spare_stackless_runner() noexcept;
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     /// A \a thread is the representation of a HPX thread. It's a first class
     /// object in HPX. In our implementation this is a user level thread running
@@ -60,6 +124,15 @@ namespace hpx::threads {
             HPX_ASSERT(get_state().state() == thread_schedule_state::active);
             HPX_ASSERT(this == coroutine_.get_thread_id().get());
 
+            // the leaf tasks of the parallel executors may suspend, those
+            // are run on a stack borrowed from the worker thread
+            if (runner_ != nullptr || detail::use_stackless_leaf_tasks)
+            {
+                return call_on_runner();
+            }
+
+            hpx::execution_base::this_thread::reset_agent ctx(
+                detail::get_stackless_agent(this));
             return coroutine_(this->thread_data::set_state_ex(
                 thread_restart_state::signaled));
         }
@@ -74,49 +147,88 @@ namespace hpx::threads {
 #if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
         std::size_t get_thread_phase() const noexcept override
         {
+            if (runner_ != nullptr)
+            {
+                return runner_->coroutine_.get_thread_phase();
+            }
             return coroutine_.get_thread_phase();
         }
 #endif
 
         std::size_t get_thread_data() const override
         {
+            if (runner_ != nullptr)
+            {
+                return runner_->coroutine_.get_thread_data();
+            }
             return coroutine_.get_thread_data();
         }
 
         std::size_t set_thread_data(std::size_t data) override
         {
+            if (runner_ != nullptr)
+            {
+                return runner_->coroutine_.set_thread_data(data);
+            }
             return coroutine_.set_thread_data(data);
         }
 
 #if defined(HPX_HAVE_LIBCDS)
         std::size_t get_libcds_data() const override
         {
+            if (runner_ != nullptr)
+            {
+                return runner_->coroutine_.get_libcds_data();
+            }
             return coroutine_.get_libcds_data();
         }
 
         std::size_t set_libcds_data(std::size_t data) override
         {
+            if (runner_ != nullptr)
+            {
+                return runner_->coroutine_.set_libcds_data(data);
+            }
             return coroutine_.set_libcds_data(data);
         }
 
         std::size_t get_libcds_hazard_pointer_data() const override
         {
+            if (runner_ != nullptr)
+            {
+                return runner_->coroutine_.get_libcds_hazard_pointer_data();
+            }
             return coroutine_.get_libcds_hazard_pointer_data();
         }
 
         std::size_t set_libcds_hazard_pointer_data(std::size_t data) override
         {
+            if (runner_ != nullptr)
+            {
+                return runner_->coroutine_.set_libcds_hazard_pointer_data(
+                    data);
+            }
             return coroutine_.set_libcds_hazard_pointer_data(data);
         }
 
         std::size_t get_libcds_dynamic_hazard_pointer_data() const override
         {
+            if (runner_ != nullptr)
+            {
+                return runner_->coroutine_
+                    .get_libcds_dynamic_hazard_pointer_data();
+            }
             return coroutine_.get_libcds_dynamic_hazard_pointer_data();
         }
 
         std::size_t set_libcds_dynamic_hazard_pointer_data(
             std::size_t data) override
         {
+            if (runner_ != nullptr)
+            {
+                return runner_->coroutine_
+                    .set_libcds_dynamic_hazard_pointer_data(data);
+            }
             return coroutine_.set_libcds_dynamic_hazard_pointer_data(data);
         }
 #endif
@@ -125,6 +237,8 @@ namespace hpx::threads {
 
         void rebind(thread_init_data& init_data) override
         {
+            HPX_ASSERT(runner_ == nullptr);
+
             this->thread_data::rebind_base(init_data);
 
             coroutine_.rebind(HPX_MOVE(init_data.func), thread_id_type(this));
@@ -158,7 +272,12 @@ namespace hpx::threads {
         }
 
     private:
+        // Run the thread on a stackful runner, the thread keeps the runner
+        // if it suspends
+        stackless_coroutine_type::result_type call_on_runner();
+
         stackless_coroutine_type coroutine_;
+        detail::stackless_runner* runner_ = nullptr;
     };
 
     ////////////////////////////////////////////////////////////////////////////
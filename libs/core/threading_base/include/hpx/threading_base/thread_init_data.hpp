@@ -15,6 +15,7 @@
 #include <hpx/threading_base/external_timer.hpp>
 #endif
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <utility>
@@ -47,6 +48,7 @@ namespace hpx::threads {
           , initial_state(thread_schedule_state::pending)
           , run_now(false)
           , scheduler_base(nullptr)
+          , deadline((std::chrono::steady_clock::time_point::max)())
         {
             if (initial_state == thread_schedule_state::staged)
             {
@@ -66,6 +68,7 @@ namespace hpx::threads {
             initial_state = rhs.initial_state;
             run_now = rhs.run_now;
             scheduler_base = rhs.scheduler_base;
+            deadline = rhs.deadline;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
             description = HPX_MOVE(rhs.description);
 #endif
@@ -105,6 +108,7 @@ namespace hpx::threads {
           , initial_state(rhs.initial_state)
           , run_now(rhs.run_now)
           , scheduler_base(rhs.scheduler_base)
+          , deadline(rhs.deadline)
         {
         }
 
@@ -139,6 +143,7 @@ namespace hpx::threads {
           , initial_state(initial_state_)
           , run_now(run_now_)
           , scheduler_base(scheduler_base_)
+          , deadline((std::chrono::steady_clock::time_point::max)())
         {
             if (initial_state == thread_schedule_state::staged)
             {
@@ -171,5 +176,9 @@ namespace hpx::threads {
         bool run_now;
 
         policies::scheduler_base* scheduler_base;
+
+        // optional absolute point in time by which the new thread should have
+        // finished executing, used by deadline aware schedulers only
+        std::chrono::steady_clock::time_point deadline;
     };
 }    // namespace hpx::threads
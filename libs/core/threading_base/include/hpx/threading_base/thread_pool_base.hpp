@@ -21,6 +21,7 @@
 #include <hpx/topology/cpu_mask.hpp>
 #include <hpx/topology/topology.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -186,6 +187,25 @@ namespace hpx::threads {
         ///         on the pool itself.
         virtual void suspend_direct(error_code& ec = throws) = 0;
 
+        /// Limits the share of time the OS threads of this pool spend
+        /// executing HPX threads. The budget is managed as a token bucket that
+        /// is continuously refilled, workers are blocked while it is
+        /// exhausted. The quota can be changed at any time.
+        ///
+        /// \param quota  [in] The share (a value in (0, 1]) of the time of the
+        ///               processing units of the pool that may be used. A
+        ///               quota of 1 removes the limit.
+        /// \param period [in] The time interval the budget is accumulated
+        ///               for at most, this bounds the length of bursts.
+        ///
+        /// \throws hpx::exception if the quota or the period is not positive
+        ///         or if the pool does not support CPU quotas.
+        void set_cpu_quota(double quota,
+            std::chrono::microseconds period = std::chrono::milliseconds(10));
+
+        /// Returns the CPU quota of this pool (1 if no limit is enforced).
+        double get_cpu_quota() const;
+
     public:
         /// \cond NOINTERNAL
         virtual std::size_t get_os_thread_count() const = 0;
@@ -198,6 +218,8 @@ namespace hpx::threads {
             thread_init_data& data, thread_id_ref_type& id, error_code& ec) = 0;
         virtual thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) = 0;
+        virtual void create_work_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec);
 
         virtual thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
@@ -352,6 +374,39 @@ namespace hpx::threads {
             return 0;
         }
 
+        virtual std::int64_t get_num_deadline_misses(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        virtual std::int64_t get_num_stolen_from_core_group(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_from_numa_domain(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_from_remote(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        virtual std::int64_t get_num_steal_requests_satisfied(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_steal_requests_tasks_sent(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
 #if defined(HPX_HAVE_THREAD_QUEUE_WAITTIME)
         virtual std::int64_t get_average_thread_wait_time(
             std::size_t /*thread_num*/, bool /*reset*/)
@@ -432,6 +487,13 @@ namespace hpx::threads {
 
         virtual std::int64_t get_scheduler_utilization() const = 0;
 
+        std::int64_t get_cpu_quota_percentage() const;
+        std::int64_t get_cpu_quota_throttled_time(
+            std::size_t num_thread, bool reset);
+        std::int64_t get_cpu_quota_throttled_count(
+            std::size_t num_thread, bool reset);
+        std::int64_t get_handoff_count(std::size_t num_thread, bool reset);
+
         virtual std::int64_t get_idle_loop_count(
             std::size_t num, bool reset) = 0;
         virtual std::int64_t get_busy_loop_count(
@@ -76,5 +76,12 @@ namespace hpx::threads::policies {
         std::ptrdiff_t const large_stacksize_;
         std::ptrdiff_t const huge_stacksize_;
         std::ptrdiff_t const nostack_stacksize_;
+
+        // minimal number of tasks a queue has to hold to be stolen from by a
+        // worker sharing the same cache, sharing the same NUMA domain, or
+        // running on a different NUMA domain (used by hierarchical stealing)
+        std::int64_t min_tasks_to_steal_core_group_ = 1;
+        std::int64_t min_tasks_to_steal_numa_domain_ = 1;
+        std::int64_t min_tasks_to_steal_remote_ = 1;
     };
 }    // namespace hpx::threads::policies
@@ -14,94 +14,113 @@
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
+#include <cstddef>
+#include <cstdint>
+
 namespace hpx::threads::detail {
 
-    thread_id_ref_type create_work(policies::scheduler_base* scheduler,
-        threads::thread_init_data& data, error_code& ec)
-    {
-        // verify parameters
-        switch (data.initial_state)
-        {
-        // NOLINTNEXTLINE(bugprone-branch-clone)
-        case thread_schedule_state::pending:
-            [[fallthrough]];
-        case thread_schedule_state::pending_do_not_schedule:
-            [[fallthrough]];
-        case thread_schedule_state::pending_boost:
-            [[fallthrough]];
-        case thread_schedule_state::suspended:
-            break;
-
-        default:
+    namespace {
+
+        // verify the parameters of a new work item and fill in the missing
+        // information, returns false if the work item can't be created
+        bool prepare_work(policies::scheduler_base* scheduler,
+            threads::thread_init_data& data, thread_self const* self,
+            char const* func, error_code& ec)
         {
-            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
-                "thread::detail::create_work", "invalid initial state: {}",
-                data.initial_state);
-            return invalid_thread_id;
-        }
-        }
+            // verify parameters
+            switch (data.initial_state)
+            {
+            // NOLINTNEXTLINE(bugprone-branch-clone)
+            case thread_schedule_state::pending:
+                [[fallthrough]];
+            case thread_schedule_state::pending_do_not_schedule:
+                [[fallthrough]];
+            case thread_schedule_state::pending_boost:
+                [[fallthrough]];
+            case thread_schedule_state::suspended:
+                break;
+
+            default:
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter, func,
+                    "invalid initial state: {}", data.initial_state);
+                return false;
+            }
+            }
 
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
-        if (!data.description)
-        {
-            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
-                "thread::detail::create_work", "description is nullptr");
-            return invalid_thread_id;
-        }
+            if (!data.description)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter, func,
+                    "description is nullptr");
+                return false;
+            }
 #endif
 
-        LTM_(info)
-            .format("create_work: pool({}), scheduler({}), initial_state({}), "
-                    "thread_priority({})",
-                *scheduler->get_parent_pool(), *scheduler,
-                get_thread_state_name(data.initial_state),
-                get_thread_priority_name(data.priority))
+            LTM_(info)
+                .format("{}: pool({}), scheduler({}), initial_state({}), "
+                        "thread_priority({})",
+                    func, *scheduler->get_parent_pool(), *scheduler,
+                    get_thread_state_name(data.initial_state),
+                    get_thread_priority_name(data.priority))
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
-            .format(", description({})", data.description)
+                .format(", description({})", data.description)
 #endif
-            ;
-
-        thread_self const* self = get_self_ptr();
+                ;
 
 #ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
-        if (nullptr == data.parent_id)
-        {
-            if (self)
+            if (nullptr == data.parent_id)
             {
-                data.parent_id = get_thread_id_data(self->get_thread_id());
-                data.parent_phase = self->get_thread_phase();
+                if (self)
+                {
+                    data.parent_id = get_thread_id_data(self->get_thread_id());
+                    data.parent_phase = self->get_thread_phase();
+                }
             }
-        }
-        if (0 == data.parent_locality_id)
-            data.parent_locality_id = detail::get_locality_id(hpx::throws);
+            if (0 == data.parent_locality_id)
+                data.parent_locality_id = detail::get_locality_id(hpx::throws);
 #endif
 
-        if (nullptr == data.scheduler_base)
-            data.scheduler_base = scheduler;
+            if (nullptr == data.scheduler_base)
+                data.scheduler_base = scheduler;
 
-        // Pass critical priority from parent to child.
-        if (self)
-        {
-            if (data.priority == thread_priority::default_ &&
-                thread_priority::high_recursive ==
-                    get_thread_id_data(self->get_thread_id())->get_priority())
+            // Pass critical priority from parent to child.
+            if (self)
+            {
+                if (data.priority == thread_priority::default_ &&
+                    thread_priority::high_recursive ==
+                        get_thread_id_data(self->get_thread_id())
+                            ->get_priority())
+                {
+                    data.priority = thread_priority::high_recursive;
+                }
+            }
+
+            // create the new thread
+            if (data.priority == thread_priority::default_)
             {
-                data.priority = thread_priority::high_recursive;
+                data.priority = thread_priority::normal;
             }
+
+            HPX_ASSERT(!data.run_now);
+            data.run_now = (thread_priority::high == data.priority ||
+                thread_priority::high_recursive == data.priority ||
+                thread_priority::bound == data.priority ||
+                thread_priority::boost == data.priority);
+
+            return true;
         }
+    }    // namespace
 
-        // create the new thread
-        if (data.priority == thread_priority::default_)
+    thread_id_ref_type create_work(policies::scheduler_base* scheduler,
+        threads::thread_init_data& data, error_code& ec)
+    {
+        if (!prepare_work(scheduler, data, get_self_ptr(),
+                "thread::detail::create_work", ec))
         {
-            data.priority = thread_priority::normal;
+            return invalid_thread_id;
         }
 
-        HPX_ASSERT(!data.run_now);
-        data.run_now = (thread_priority::high == data.priority ||
-            thread_priority::high_recursive == data.priority ||
-            thread_priority::bound == data.priority ||
-            thread_priority::boost == data.priority);
-
         thread_id_ref_type id = invalid_thread_id;
         scheduler->create_thread(data, data.run_now ? &id : nullptr, ec);
 
@@ -111,4 +130,52 @@ namespace hpx::threads::detail {
 
         return id;
     }
+
+    void create_work_bulk(policies::scheduler_base* scheduler,
+        threads::thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        if (count == 0)
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+            return;
+        }
+
+        // all new threads are announced to the worker they are targeted at
+        // if they share a schedule hint, otherwise all workers are woken up
+        std::int16_t hint = data[0].schedulehint.hint;
+
+        thread_self const* self = get_self_ptr();
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            if (data[i].schedulehint.hint != hint)
+                hint = -1;
+
+            if (!prepare_work(scheduler, data[i], self,
+                    "thread::detail::create_work_bulk", ec))
+            {
+                return;
+            }
+
+            // the ids of the new threads are not returned, thus all of them
+            // have to be scheduled right away
+            if (data[i].initial_state != thread_schedule_state::pending)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "thread::detail::create_work_bulk",
+                    "invalid initial state: {}, threads created in bulk "
+                    "must be pending",
+                    data[i].initial_state);
+                return;
+            }
+        }
+
+        scheduler->create_thread_bulk(data, count, ec);
+        if (&ec != &throws && ec)
+            return;
+
+        // NOTE: Don't care if the hint is a NUMA hint, just want to wake up a
+        // thread.
+        scheduler->do_some_work(hint);
+    }
 }    // namespace hpx::threads::detail
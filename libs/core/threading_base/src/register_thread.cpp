@@ -15,6 +15,8 @@
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 
+#include <cstddef>
+
 namespace hpx::threads {
 
     ///////////////////////////////////////////////////////////////////////////
@@ -100,4 +102,24 @@ namespace hpx::threads {
         data.run_now = false;
         return pool->create_work(data, ec);
     }
+
+    void register_work_bulk(threads::thread_init_data* data, std::size_t count,
+        threads::thread_pool_base* pool, error_code& ec)
+    {
+        HPX_ASSERT(pool);
+
+        for (std::size_t i = 0; i != count; ++i)
+            data[i].run_now = false;
+
+        pool->create_work_bulk(data, count, ec);
+    }
+
+    void register_work_bulk(
+        threads::thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        auto* pool = detail::get_self_or_default_pool();
+        HPX_ASSERT(pool);
+
+        register_work_bulk(data, count, pool, ec);
+    }
 }    // namespace hpx::threads
@@ -11,11 +11,25 @@
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
 #include <hpx/coroutines/detail/tss.hpp>
 #endif
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF) &&                           \
+    (defined(__linux) || defined(linux) || defined(__linux__)) &&              \
+    __has_include(<linux/futex.h>)
+#define HPX_HAVE_IDLE_PARKING_FUTEX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <ctime>
+#endif
+
 #include <algorithm>
 #include <atomic>
 #include <chrono>
@@ -29,6 +43,7 @@
 #include <ostream>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -39,7 +54,9 @@ namespace hpx::threads::policies {
         char const* description,
         thread_queue_init_parameters const& thread_queue_init,
         scheduler_mode mode)
-      : suspend_mtxs_(num_threads)
+      : cpu_quota_counters_(num_threads)
+      , handoff_data_(num_threads)
+      , suspend_mtxs_(num_threads)
       , suspend_conds_(num_threads)
       , pu_mtxs_(num_threads)
       , states_(num_threads)
@@ -65,17 +82,231 @@ namespace hpx::threads::policies {
             data.data_.wait_count_ = 0;
             data.data_.max_idle_backoff_time_ = max_time;
         }
+
+        idle_parking_data_ =
+            std::vector<util::cache_line_data<idle_parking_data>>(num_threads);
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            init_idle_parking(i, HPX_IDLE_LOOP_COUNT_MAX);
+        }
 #endif
 
         for (std::size_t i = 0; i != num_threads; ++i)
             states_[i].data_.store(hpx::state::initialized);
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    namespace {
+
+        // number of back-off rounds spent spinning (with exponentially
+        // increasing length) and yielding before an idle worker is parked
+        constexpr std::uint32_t idle_parking_spin_rounds = 6;
+        constexpr std::uint32_t idle_parking_yield_rounds = 4;
+
+        // a worker that was woken up earlier than this after having been
+        // parked should have continued spinning instead
+        constexpr std::chrono::microseconds idle_parking_short_park(100);
+
+#if defined(HPX_HAVE_IDLE_PARKING_FUTEX)
+        static_assert(sizeof(std::atomic<std::uint32_t>) ==
+                sizeof(std::uint32_t) &&
+            std::atomic<std::uint32_t>::is_always_lock_free);
+
+        void futex_wait(std::atomic<std::uint32_t>& word,
+            std::uint32_t expected, std::chrono::milliseconds timeout) noexcept
+        {
+            auto const secs =
+                std::chrono::duration_cast<std::chrono::seconds>(timeout);
+            timespec ts{};
+            ts.tv_sec = static_cast<decltype(ts.tv_sec)>(secs.count());
+            ts.tv_nsec = static_cast<decltype(ts.tv_nsec)>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    timeout - secs)
+                    .count());
+
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+                FUTEX_WAIT_PRIVATE, expected, &ts, nullptr, 0);
+        }
+
+        void futex_wake_one(std::atomic<std::uint32_t>& word) noexcept
+        {
+            ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+                FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+        }
+#endif
+    }    // namespace
+
+    void scheduler_base::init_idle_parking(
+        std::size_t num_thread, std::int64_t max_idle_loop_count) noexcept
+    {
+        idle_parking_data& data = idle_parking_data_[num_thread].data_;
+
+        data.max_spin_count_ = (std::max)(max_idle_loop_count, std::int64_t(1));
+        data.min_spin_count_ =
+            (std::max)(data.max_spin_count_ / 1024, std::int64_t(1));
+        data.spin_count_ =
+            (std::max)(data.max_spin_count_ / 16, data.min_spin_count_);
+        data.arrival_gap_ = data.spin_count_ / 2;
+        data.wait_count_ = 0;
+        data.has_parked_ = false;
+    }
+
+    // The spin length is tuned by a simple feedback controller based on the
+    // observed gaps between the arrivals of new work. If work arrives while
+    // the worker is still spinning or yielding, the spin length follows twice
+    // the (smoothed) gap, which makes sure that frequent arrivals are picked
+    // up without having to go through a park/wake-up cycle. If the worker had
+    // to be parked the spin length is halved (or doubled, if the worker was
+    // woken up almost immediately after having been parked).
+    void scheduler_base::update_idle_spin_count(
+        std::size_t num_thread, std::int64_t idle_loop_count) noexcept
+    {
+        idle_parking_data& data = idle_parking_data_[num_thread].data_;
+
+        // the gap is unknown if the worker was parked in between
+        if (!data.has_parked_)
+        {
+            std::int64_t const gap = idle_loop_count +
+                static_cast<std::int64_t>(data.wait_count_) * data.spin_count_;
+
+            data.arrival_gap_ = (7 * data.arrival_gap_ + gap) / 8;
+            data.spin_count_ = (std::clamp)(2 * data.arrival_gap_,
+                data.min_spin_count_, data.max_spin_count_);
+        }
+
+        data.wait_count_ = 0;
+        data.has_parked_ = false;
+    }
+
+    void scheduler_base::park(std::size_t num_thread)
+    {
+        idle_parking_data& data = idle_parking_data_[num_thread].data_;
+
+        // announce that this worker is about to be parked, the sequentially
+        // consistent increment pairs with the fence in do_some_work()
+        std::uint32_t const epoch =
+            data.wake_epoch_.load(std::memory_order_acquire);
+        data.parked_.store(true, std::memory_order_relaxed);
+        parked_count_.data_.fetch_add(1, std::memory_order_seq_cst);
+
+        // don't go to sleep if new work was added in the meantime or if the
+        // scheduler is being shut down
+        bool const may_park = get_queue_length() == 0 &&
+            states_[num_thread].data_.load(std::memory_order_relaxed) <
+                hpx::state::pre_sleep;
+
+        auto const start = std::chrono::steady_clock::now();
+        if (may_park)
+        {
+            std::chrono::milliseconds const timeout(std::lround(
+                wait_counts_[num_thread].data_.max_idle_backoff_time_));
+#if defined(HPX_HAVE_IDLE_PARKING_FUTEX)
+            futex_wait(data.wake_epoch_, epoch, timeout);
+#else
+            std::unique_lock<pu_mutex_type> l(mtx_);
+            if (data.wake_epoch_.load(std::memory_order_relaxed) == epoch)
+            {
+                cond_.wait_for(l, timeout);    //-V1089
+            }
+#endif
+        }
+
+        // withdraw the announcement, unless unpark() has already done so
+        bool expected = true;
+        bool const timed_out =
+            data.parked_.compare_exchange_strong(expected, false);
+        if (timed_out)
+        {
+            parked_count_.data_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        if (may_park)
+        {
+            if (timed_out)
+            {
+                // nobody has woken us up, no need to spin for long
+                data.spin_count_ = data.min_spin_count_;
+            }
+            else if (std::chrono::steady_clock::now() - start <
+                idle_parking_short_park)
+            {
+                // new work has arrived shortly after this worker was parked
+                data.spin_count_ =
+                    (std::min)(2 * data.spin_count_, data.max_spin_count_);
+            }
+            else
+            {
+                data.spin_count_ =
+                    (std::max)(data.spin_count_ / 2, data.min_spin_count_);
+            }
+            data.arrival_gap_ = data.spin_count_ / 2;
+            data.has_parked_ = true;
+        }
+
+        // start over with spinning
+        data.wait_count_ = 0;
+    }
+
+    bool scheduler_base::unpark(std::size_t num_thread) noexcept
+    {
+        idle_parking_data& data = idle_parking_data_[num_thread].data_;
+
+        bool expected = true;
+        if (!data.parked_.load(std::memory_order_relaxed) ||
+            !data.parked_.compare_exchange_strong(expected, false))
+        {
+            return false;
+        }
+
+        parked_count_.data_.fetch_sub(1, std::memory_order_relaxed);
+        data.wake_epoch_.fetch_add(1, std::memory_order_release);
+
+#if defined(HPX_HAVE_IDLE_PARKING_FUTEX)
+        futex_wake_one(data.wake_epoch_);
+#else
+        {
+            std::lock_guard<pu_mutex_type> l(mtx_);
+        }
+        cond_.notify_all();
+#endif
+        return true;
+    }
+#else
+    void scheduler_base::init_idle_parking(std::size_t, std::int64_t) noexcept
+    {
+    }
+#endif
+
     void scheduler_base::idle_callback([[maybe_unused]] std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        if (mode_.data_.load(std::memory_order_relaxed) &
-            policies::scheduler_mode::enable_idle_backoff)
+        auto const mode = mode_.data_.load(std::memory_order_relaxed);
+        if (mode & policies::scheduler_mode::enable_idle_parking)
+        {
+            // Spin with exponentially increasing length first, then yield to
+            // other OS threads, and finally park this worker until it gets
+            // woken up on new work.
+            idle_parking_data& data = idle_parking_data_[num_thread].data_;
+
+            std::uint32_t const round = data.wait_count_++;
+            if (round < idle_parking_spin_rounds)
+            {
+                for (std::uint32_t i = 0; i != (16u << round); ++i)
+                {
+                    HPX_SMT_PAUSE;
+                }
+            }
+            else if (round <
+                idle_parking_spin_rounds + idle_parking_yield_rounds)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                park(num_thread);
+            }
+        }
+        else if (mode & policies::scheduler_mode::enable_idle_backoff)
         {
             // Put this thread to sleep for some time, additionally it gets
             // woken up on new work.
@@ -108,17 +339,329 @@ namespace hpx::threads::policies {
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
     /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    void scheduler_base::do_some_work([[maybe_unused]] std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        if (mode_.data_.load(std::memory_order_relaxed) &
-            policies::scheduler_mode::enable_idle_backoff)
+        auto const mode = mode_.data_.load(std::memory_order_relaxed);
+        if (mode & policies::scheduler_mode::enable_idle_parking)
+        {
+            // make sure the new work is visible to any worker that is about to
+            // be parked (pairs with the increment in park())
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (parked_count_.data_.load(std::memory_order_relaxed) != 0)
+            {
+                // wake up exactly one parked worker, preferably the one the
+                // new work was scheduled on. Work without a target worker
+                // wakes up the parked workers round-robin.
+                std::size_t const num_threads = idle_parking_data_.size();
+                std::size_t const start = num_thread < num_threads ?
+                    num_thread :
+                    unpark_cursor_.data_.fetch_add(
+                        1, std::memory_order_relaxed) %
+                        num_threads;
+                for (std::size_t i = 0; i != num_threads; ++i)
+                {
+                    if (unpark((start + i) % num_threads))
+                        break;
+                }
+            }
+            return;
+        }
+
+        if (mode & policies::scheduler_mode::enable_idle_backoff)
         {
             cond_.notify_all();
         }
 #endif
     }
 
+    void scheduler_base::notify_all_workers()
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // The workers are woken up independently of the current mode, as
+        // this is called after the mode was changed as well.
+
+        // pairs with the increment in park()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (parked_count_.data_.load(std::memory_order_relaxed) != 0)
+        {
+            std::size_t const num_threads = idle_parking_data_.size();
+            for (std::size_t i = 0; i != num_threads; ++i)
+            {
+                unpark(i);
+            }
+        }
+
+        cond_.notify_all();
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void scheduler_base::set_cpu_quota(
+        double quota, std::chrono::microseconds period)
+    {
+        if (!(quota > 0.0) || period.count() <= 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "scheduler_base::set_cpu_quota",
+                "the CPU quota and its period must be positive (quota: {}, "
+                "period: {}us)",
+                quota, period.count());
+        }
+
+        cpu_quota_data& q = cpu_quota_.data_;
+        if (quota >= 1.0)
+        {
+            q.rate_.store(0.0, std::memory_order_relaxed);
+            q.quota_.store(1.0, std::memory_order_relaxed);
+            return;
+        }
+
+        // the budget is shared by all worker threads of this scheduler
+        double const rate = quota * static_cast<double>(states_.size());
+        auto const capacity = static_cast<std::int64_t>(rate *
+            static_cast<double>(
+                std::chrono::nanoseconds(period).count()));
+
+        // start with a full bucket
+        q.capacity_.store(capacity, std::memory_order_relaxed);
+        q.tokens_.store(capacity, std::memory_order_relaxed);
+        q.last_refill_.store(hpx::chrono::high_resolution_clock::now(),
+            std::memory_order_relaxed);
+        q.quota_.store(quota, std::memory_order_relaxed);
+        q.rate_.store(rate, std::memory_order_release);
+    }
+
+    void scheduler_base::cpu_quota_refill(std::uint64_t now) noexcept
+    {
+        cpu_quota_data& q = cpu_quota_.data_;
+
+        // only one worker adds the budget accumulated since the last refill
+        std::uint64_t last = q.last_refill_.load(std::memory_order_relaxed);
+        if (now <= last ||
+            !q.last_refill_.compare_exchange_strong(
+                last, now, std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        auto const added = static_cast<std::int64_t>(
+            static_cast<double>(now - last) *
+            q.rate_.load(std::memory_order_relaxed));
+        std::int64_t const capacity =
+            q.capacity_.load(std::memory_order_relaxed);
+
+        std::int64_t tokens = q.tokens_.load(std::memory_order_relaxed);
+        while (!q.tokens_.compare_exchange_weak(tokens,
+            (std::min)(tokens + added, capacity), std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void scheduler_base::cpu_quota_throttle(std::size_t num_thread)
+    {
+        cpu_quota_data& q = cpu_quota_.data_;
+
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        cpu_quota_refill(start);
+
+        std::int64_t tokens = q.tokens_.load(std::memory_order_relaxed);
+        if (tokens > 0)
+        {
+            return;
+        }
+
+        // the budget is exhausted, wait for it to be refilled
+        cpu_quota_counters& counters = cpu_quota_counters_[num_thread].data_;
+        counters.throttled_count_.fetch_add(1, std::memory_order_relaxed);
+
+        std::uint64_t now = start;
+        while (tokens <= 0)
+        {
+            // stop waiting if the quota was removed or if the worker is
+            // requested to stop
+            double const rate = q.rate_.load(std::memory_order_acquire);
+            if (rate == 0.0 ||
+                states_[num_thread].data_.load(std::memory_order_relaxed) >=
+                    hpx::state::pre_sleep)
+            {
+                break;
+            }
+
+            // sleep for the time it takes to refill the missing budget, but
+            // not longer than a millisecond to react to quota changes
+            auto const wait = static_cast<std::int64_t>(
+                static_cast<double>(1 - tokens) / rate);
+            std::this_thread::sleep_for(std::chrono::nanoseconds(
+                (std::min)(wait, static_cast<std::int64_t>(1000000))));
+
+            now = hpx::chrono::high_resolution_clock::now();
+            cpu_quota_refill(now);
+            tokens = q.tokens_.load(std::memory_order_relaxed);
+        }
+
+        counters.throttled_time_.fetch_add(
+            static_cast<std::int64_t>(now - start), std::memory_order_relaxed);
+    }
+
+    std::int64_t scheduler_base::get_cpu_quota_throttled_time(
+        std::size_t num_thread, bool reset) noexcept
+    {
+        if (num_thread == static_cast<std::size_t>(-1))
+        {
+            std::int64_t result = 0;
+            for (auto& counters : cpu_quota_counters_)
+            {
+                result += util::get_and_reset_value(
+                    counters.data_.throttled_time_, reset);
+            }
+            return result;
+        }
+
+        HPX_ASSERT(num_thread < cpu_quota_counters_.size());
+        return util::get_and_reset_value(
+            cpu_quota_counters_[num_thread].data_.throttled_time_, reset);
+    }
+
+    std::int64_t scheduler_base::get_cpu_quota_throttled_count(
+        std::size_t num_thread, bool reset) noexcept
+    {
+        if (num_thread == static_cast<std::size_t>(-1))
+        {
+            std::int64_t result = 0;
+            for (auto& counters : cpu_quota_counters_)
+            {
+                result += util::get_and_reset_value(
+                    counters.data_.throttled_count_, reset);
+            }
+            return result;
+        }
+
+        HPX_ASSERT(num_thread < cpu_quota_counters_.size());
+        return util::get_and_reset_value(
+            cpu_quota_counters_[num_thread].data_.throttled_count_, reset);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool scheduler_base::try_handoff_thread(
+        thread_id_type const& thrd, thread_schedule_hint schedulehint) noexcept
+    {
+        if (!has_scheduler_mode(scheduler_mode::enable_handoff_wakeup))
+        {
+            return false;
+        }
+
+        // only threads woken by an HPX thread running on this scheduler are
+        // handed over, bound threads have to run where they belong
+        thread_data const* self = get_self_id_data();
+        if (self == nullptr || self->get_scheduler_base() != this ||
+            get_thread_id_data(thrd)->get_priority() == thread_priority::bound)
+        {
+            return false;
+        }
+
+        std::size_t const num_thread =
+            threads::detail::get_local_thread_num_tss();
+        if (num_thread >= handoff_data_.size() ||
+            (schedulehint.mode == thread_schedule_hint_mode::thread &&
+                schedulehint.hint != -1 &&
+                static_cast<std::size_t>(schedulehint.hint) != num_thread) ||
+            states_[num_thread].data_.load(std::memory_order_relaxed) >=
+                hpx::state::pre_sleep)
+        {
+            return false;
+        }
+
+        handoff_data& data = handoff_data_[num_thread].data_;
+        if (data.thread_.load(std::memory_order_relaxed) != nullptr)
+        {
+            return false;    // another thread was handed over already
+        }
+
+        // only the owning worker puts threads into its slot, thus no other
+        // thread can have been handed over in the meantime
+        ++handoff_queue_length_;
+        data.thread_.store(
+            thread_id_ref_type(thrd).detach(), std::memory_order_release);
+        data.count_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    thread_id_ref_type scheduler_base::take_handoff_thread(
+        std::size_t num_thread) noexcept
+    {
+        HPX_ASSERT(num_thread < handoff_data_.size());
+        thread_id_ref_type::thread_repr* thrd =
+            handoff_data_[num_thread].data_.thread_.exchange(
+                nullptr, std::memory_order_acq_rel);
+        if (thrd == nullptr)
+        {
+            return thread_id_ref_type();
+        }
+
+        --handoff_queue_length_;
+        return thread_id_ref_type(thrd, thread_id_addref::no);
+    }
+
+    void scheduler_base::flush_handoff_thread(std::size_t num_thread)
+    {
+        thread_id_ref_type thrd = take_handoff_thread(num_thread);
+        if (!thrd)
+        {
+            return;
+        }
+
+        auto const priority = get_thread_id_data(thrd)->get_priority();
+        schedule_thread(HPX_MOVE(thrd),
+            thread_schedule_hint(static_cast<std::int16_t>(num_thread)), false,
+            priority);
+        do_some_work(num_thread);
+    }
+
+    bool scheduler_base::steal_handoff_thread(
+        std::size_t num_thread, thread_id_ref_type& thrd) noexcept
+    {
+        if (HPX_LIKELY(
+                handoff_queue_length_.load(std::memory_order_relaxed) == 0))
+        {
+            return false;
+        }
+
+        std::size_t const num_threads = handoff_data_.size();
+        for (std::size_t i = 1; i < num_threads; ++i)
+        {
+            std::size_t const victim = (num_thread + i) % num_threads;
+            if (has_handoff_thread(victim))
+            {
+                thrd = take_handoff_thread(victim);
+                if (thrd)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    std::int64_t scheduler_base::get_handoff_count(
+        std::size_t num_thread, bool reset) noexcept
+    {
+        if (num_thread == static_cast<std::size_t>(-1))
+        {
+            std::int64_t result = 0;
+            for (auto& data : handoff_data_)
+            {
+                result += util::get_and_reset_value(data.data_.count_, reset);
+            }
+            return result;
+        }
+
+        HPX_ASSERT(num_thread < handoff_data_.size());
+        return util::get_and_reset_value(
+            handoff_data_[num_thread].data_.count_, reset);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
     void scheduler_base::suspend(std::size_t num_thread)
     {
         HPX_ASSERT(num_thread < suspend_conds_.size());
@@ -155,6 +698,17 @@ namespace hpx::threads::policies {
         }
     }
 
+    void scheduler_base::create_thread_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            create_thread(data[i], nullptr, ec);
+            if (&ec != &throws && ec)
+                return;
+        }
+    }
+
     std::size_t scheduler_base::select_active_pu(
         std::size_t num_thread, bool allow_fallback)
     {
@@ -324,7 +878,7 @@ namespace hpx::threads::policies {
     {
         // distribute the same value across all cores
         mode_.data_.store(mode, std::memory_order_release);
-        do_some_work(static_cast<std::size_t>(-1));
+        notify_all_workers();
     }
 
     void scheduler_base::add_scheduler_mode(scheduler_mode mode) noexcept
@@ -257,12 +257,18 @@ namespace hpx::threads::detail {
 
             auto const* thrd_data = get_thread_id_data(thrd);
             auto* scheduler = thrd_data->get_scheduler_base();
-            scheduler->schedule_thread(
-                thrd, schedulehint, false, thrd_data->get_priority());
 
-            // NOTE: Don't care if the hint is a NUMA hint, just want to wake up
-            // a thread.
-            scheduler->do_some_work(schedulehint.hint);
+            // let the current worker run the thread right after the calling
+            // thread has suspended or terminated, if possible
+            if (!scheduler->try_handoff_thread(thrd, schedulehint))
+            {
+                scheduler->schedule_thread(
+                    thrd, schedulehint, false, thrd_data->get_priority());
+
+                // NOTE: Don't care if the hint is a NUMA hint, just want to
+                // wake up a thread.
+                scheduler->do_some_work(schedulehint.hint);
+            }
         }
 
         if (&ec != &throws)
@@ -6,17 +6,228 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/execution_base/agent_base.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
 #include <hpx/modules/logging.hpp>
+#include <hpx/threading_base/execution_agent.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+
 ////////////////////////////////////////////////////////////////////////////////
 namespace hpx::threads {
 
+    namespace detail {
+
+        bool use_stackless_leaf_tasks = false;
+
+        namespace {
+
+            [[noreturn]] void throw_stackless_suspension(
+                char const* function, std::string const& description)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status, function,
+                    "{} attempted to suspend, stackless threads run on the "
+                    "stack of their worker thread and can't be suspended "
+                    "(run the task on a stackful thread or enable "
+                    "hpx.stacks.stackless_leaf_tasks)",
+                    description);
+            }
+
+            // Unless hpx.stacks.stackless_leaf_tasks is set, stackless
+            // threads run directly on the stack of the worker OS thread, thus
+            // they can't be suspended. Any attempt to suspend (or to sleep) is
+            // rejected with an exception, as blocking the worker OS thread
+            // instead could deadlock the thread pool.
+            struct stackless_agent : hpx::execution_base::agent_base
+            {
+                std::string description() const override
+                {
+                    return hpx::util::format("stackless({})",
+                        thrd_ ? thrd_->get_thread_id() : invalid_thread_id);
+                }
+
+                execution_context const& context() const noexcept override
+                {
+                    return context_;
+                }
+
+                void yield(char const* /* desc */) override
+                {
+                    std::this_thread::yield();
+                }
+
+                void yield_k(std::size_t k, char const* desc) override
+                {
+                    if (k < 16)
+                    {
+                        HPX_SMT_PAUSE;
+                    }
+                    else
+                    {
+                        yield(desc);
+                    }
+                }
+
+                void suspend(char const* /* desc */) override
+                {
+                    throw_stackless_suspension(
+                        "stackless_agent::suspend", description());
+                }
+
+                void resume(hpx::threads::thread_priority /* priority */,
+                    char const* /* desc */) override
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_function_call,
+                        "stackless_agent::resume",
+                        "unexpected call to stackless_agent::resume, {} is "
+                        "never suspended",
+                        description());
+                }
+
+                void abort(char const* /* desc */) override
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_function_call,
+                        "stackless_agent::abort",
+                        "unexpected call to stackless_agent::abort, {} is "
+                        "never suspended",
+                        description());
+                }
+
+                void sleep_for(
+                    hpx::chrono::steady_duration const& /* sleep_duration */,
+                    char const* /* desc */) override
+                {
+                    throw_stackless_suspension(
+                        "stackless_agent::sleep_for", description());
+                }
+
+                void sleep_until(
+                    hpx::chrono::steady_time_point const& /* sleep_time */,
+                    char const* /* desc */) override
+                {
+                    throw_stackless_suspension(
+                        "stackless_agent::sleep_until", description());
+                }
+
+                thread_data* thrd_ = nullptr;
+
+            private:
+                execution_context context_;
+            };
+        }    // namespace
+
+        hpx::execution_base::agent_base& get_stackless_agent(
+            thread_data* thrd) noexcept
+        {
+            static thread_local stackless_agent agent;
+            agent.thrd_ = thrd;
+            return agent;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        namespace {
+
+            std::unique_ptr<stackless_runner>& spare_stackless_runner() noexcept
+            {
+                static thread_local std::unique_ptr<stackless_runner> runner;
+                return runner;
+            }
+        }    // namespace
+
+        stackless_runner* acquire_stackless_runner(
+            coroutine_type::functor_type&& f, thread_id_type id,
+            std::ptrdiff_t stacksize)
+        {
+            std::unique_ptr<stackless_runner> runner =
+                HPX_MOVE(spare_stackless_runner());
+            if (runner && runner->stacksize_ == stacksize)
+            {
+                runner->coroutine_.rebind(HPX_MOVE(f), HPX_MOVE(id));
+                return runner.release();
+            }
+
+            return new stackless_runner(HPX_MOVE(f), HPX_MOVE(id), stacksize);
+        }
+
+        void release_stackless_runner(stackless_runner* runner) noexcept
+        {
+            HPX_ASSERT(runner != nullptr);
+
+            // keep a runner whose function has completed for the next
+            // stackless thread run by this worker
+            std::unique_ptr<stackless_runner>& spare = spare_stackless_runner();
+            if (!spare && runner->coroutine_.impl()->exited())
+            {
+                spare.reset(runner);
+                return;
+            }
+            delete runner;
+        }
+
+        void release_spare_stackless_runner() noexcept
+        {
+            spare_stackless_runner().reset();
+        }
+    }    // namespace detail
+
     util::internal_allocator<thread_data_stackless>
         thread_data_stackless::thread_alloc_;
 
+    // The function of the thread is run on the stack of a runner. If the
+    // function suspends, the runner is handed to the thread and the thread is
+    // treated as any other suspended thread from now on, otherwise the runner
+    // is reused for the next stackless thread.
+    stackless_coroutine_type::result_type thread_data_stackless::call_on_runner()
+    {
+        if (runner_ == nullptr)
+        {
+            runner_ = detail::acquire_stackless_runner(
+                [this](thread_restart_state arg) {
+                    return coroutine_.invoke_on_current_self(arg);
+                },
+                thread_id_type(this),
+                get_scheduler_base()->get_stack_size(thread_stacksize::small_));
+        }
+
+        coroutine_type::result_type result(
+            thread_schedule_state::unknown, invalid_thread_id);
+        try
+        {
+            hpx::execution_base::this_thread::reset_agent ctx(runner_->agent_);
+            result = runner_->coroutine_(this->thread_data::set_state_ex(
+                thread_restart_state::signaled));
+        }
+        catch (...)
+        {
+            detail::release_stackless_runner(runner_);
+            runner_ = nullptr;
+            throw;
+        }
+
+        if (result.first == thread_schedule_state::terminated)
+        {
+            detail::release_stackless_runner(runner_);
+            runner_ = nullptr;
+        }
+        return result;
+    }
+
 #if !defined(HPX_HAVE_LOGGING)
-    thread_data_stackless::~thread_data_stackless() = default;
+    thread_data_stackless::~thread_data_stackless()
+    {
+        if (runner_ != nullptr)
+        {
+            detail::release_stackless_runner(runner_);
+        }
+    }
 #else
     thread_data_stackless::~thread_data_stackless()
     {
@@ -24,6 +235,11 @@ namespace hpx::threads {
             "~thread_data_stackless({}), description({}), phase({})", this,
             this->get_description(),
             this->thread_data_stackless::get_thread_phase());
+
+        if (runner_ != nullptr)
+        {
+            detail::release_stackless_runner(runner_);
+        }
     }
 #endif
 }    // namespace hpx::threads
@@ -8,10 +8,13 @@
 #include <hpx/hardware/timestamp.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/topology/topology.hpp>
 
+#include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -29,6 +32,18 @@ namespace hpx::threads {
     {
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    void thread_pool_base::create_work_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            create_work(data[i], ec);
+            if (&ec != &throws && ec)
+                return;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     mask_type thread_pool_base::get_used_processing_units(
         std::size_t num_cores, bool full_cores) const
@@ -129,6 +144,58 @@ namespace hpx::threads {
             thread_priority::default_, num_thread, reset);
     }
 
+    void thread_pool_base::set_cpu_quota(
+        double quota, std::chrono::microseconds period)
+    {
+        policies::scheduler_base* scheduler = get_scheduler();
+        if (scheduler == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "thread_pool_base::set_cpu_quota",
+                "the thread pool '{}' does not support CPU quotas",
+                get_pool_name());
+        }
+        scheduler->set_cpu_quota(quota, period);
+    }
+
+    double thread_pool_base::get_cpu_quota() const
+    {
+        policies::scheduler_base const* scheduler = get_scheduler();
+        return scheduler != nullptr ? scheduler->get_cpu_quota() : 1.0;
+    }
+
+    std::int64_t thread_pool_base::get_cpu_quota_percentage() const
+    {
+        return std::llround(get_cpu_quota() * 100);
+    }
+
+    std::int64_t thread_pool_base::get_cpu_quota_throttled_time(
+        std::size_t num_thread, bool reset)
+    {
+        policies::scheduler_base* scheduler = get_scheduler();
+        return scheduler != nullptr ?
+            scheduler->get_cpu_quota_throttled_time(num_thread, reset) :
+            0;
+    }
+
+    std::int64_t thread_pool_base::get_cpu_quota_throttled_count(
+        std::size_t num_thread, bool reset)
+    {
+        policies::scheduler_base* scheduler = get_scheduler();
+        return scheduler != nullptr ?
+            scheduler->get_cpu_quota_throttled_count(num_thread, reset) :
+            0;
+    }
+
+    std::int64_t thread_pool_base::get_handoff_count(
+        std::size_t num_thread, bool reset)
+    {
+        policies::scheduler_base* scheduler = get_scheduler();
+        return scheduler != nullptr ?
+            scheduler->get_handoff_count(num_thread, reset) :
+            0;
+    }
+
     std::size_t thread_pool_base::get_active_os_thread_count() const
     {
         std::size_t active_os_thread_count = 0;
@@ -224,6 +224,15 @@ namespace hpx::threads {
     public:
         // performance counters
         std::int64_t get_queue_length(bool reset) const;
+        std::int64_t get_num_deadline_misses(bool reset) const;
+        std::int64_t get_num_stolen_from_core_group(bool reset) const;
+        std::int64_t get_num_stolen_from_numa_domain(bool reset) const;
+        std::int64_t get_num_stolen_from_remote(bool reset) const;
+        std::int64_t get_num_steal_requests_satisfied(bool reset) const;
+        std::int64_t get_num_steal_requests_tasks_sent(bool reset) const;
+        std::int64_t get_cpu_quota_throttled_time(bool reset) const;
+        std::int64_t get_cpu_quota_throttled_count(bool reset) const;
+        std::int64_t get_handoff_count(bool reset) const;
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         std::int64_t get_average_thread_wait_time(bool reset) const;
         std::int64_t get_average_task_wait_time(bool reset) const;
@@ -316,6 +325,8 @@ namespace hpx::threads {
         void create_scheduler_local_workrequesting_mc(
             thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
+        void create_scheduler_deadline(thread_pool_init_parameters const&,
+            policies::thread_queue_init_parameters const&, std::size_t);
 
         mutable mutex_type mtx_;    // mutex protecting the members
 
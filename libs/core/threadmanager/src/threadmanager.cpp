@@ -142,12 +142,24 @@ namespace hpx::threads {
         std::ptrdiff_t const huge_stacksize =
             rtcfg_.get_stack_size(thread_stacksize::huge);
 
-        return policies::thread_queue_init_parameters(max_thread_count,
+        policies::thread_queue_init_parameters params(max_thread_count,
             min_tasks_to_steal_pending, min_tasks_to_steal_staged,
             min_add_new_count, max_add_new_count, min_delete_count,
             max_delete_count, max_terminated_threads, init_threads_count,
             max_idle_backoff_time, small_stacksize, medium_stacksize,
             large_stacksize, huge_stacksize);
+
+        params.min_tasks_to_steal_core_group_ =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.min_tasks_to_steal_core_group", 1);
+        params.min_tasks_to_steal_numa_domain_ =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.min_tasks_to_steal_numa_domain", 1);
+        params.min_tasks_to_steal_remote_ =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.min_tasks_to_steal_remote", 1);
+
+        return params;
     }
 
     void threadmanager::create_scheduler_user_defined(
@@ -620,6 +632,35 @@ namespace hpx::threads {
 #endif
     }
 
+    void threadmanager::create_scheduler_deadline(
+        thread_pool_init_parameters const& thread_pool_init,
+        policies::thread_queue_init_parameters const& thread_queue_init,
+        std::size_t numa_sensitive)
+    {
+        // instantiate the scheduler
+        using local_sched_type =
+            hpx::threads::policies::deadline_queue_scheduler<>;
+
+        local_sched_type::init_parameter_type init(
+            thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
+            thread_queue_init, "core-deadline_queue_scheduler");
+
+        auto sched = std::make_unique<local_sched_type>(init);
+
+        // set the default scheduler flags
+        sched->set_scheduler_mode(thread_pool_init.mode_);
+
+        // conditionally set/unset this flag
+        sched->update_scheduler_mode(
+            policies::scheduler_mode::enable_stealing_numa, !numa_sensitive);
+
+        // instantiate the pool
+        std::unique_ptr<thread_pool_base> pool = std::make_unique<
+            hpx::threads::detail::scheduled_thread_pool<local_sched_type>>(
+            HPX_MOVE(sched), thread_pool_init);
+        pools_.push_back(HPX_MOVE(pool));
+    }
+
     void threadmanager::create_pools()
     {
         auto& rp = hpx::resource::get_partitioner();
@@ -790,6 +831,11 @@ namespace hpx::threads {
                     thread_pool_init, thread_queue_init, numa_sensitive);
                 break;
 
+            case resource::scheduling_policy::deadline:
+                create_scheduler_deadline(
+                    thread_pool_init, thread_queue_init, numa_sensitive);
+                break;
+
             case resource::scheduling_policy::unspecified:
                 throw std::invalid_argument(
                     "cannot instantiate a thread-manager if the thread-pool" +
@@ -1170,6 +1216,88 @@ namespace hpx::threads {
         return result;
     }
 
+    std::int64_t threadmanager::get_num_deadline_misses(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_deadline_misses(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_from_core_group(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_num_stolen_from_core_group(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_from_numa_domain(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_num_stolen_from_numa_domain(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_from_remote(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_from_remote(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_steal_requests_satisfied(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_num_steal_requests_satisfied(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_steal_requests_tasks_sent(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_steal_requests_tasks_sent(
+                all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_cpu_quota_throttled_time(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_cpu_quota_throttled_time(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_cpu_quota_throttled_count(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_cpu_quota_throttled_count(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_handoff_count(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_handoff_count(all_threads, reset);
+        return result;
+    }
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
     std::int64_t threadmanager::get_average_thread_wait_time(bool reset) const
     {
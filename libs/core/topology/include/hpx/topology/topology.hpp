@@ -135,6 +135,21 @@ namespace hpx::threads {
             return numa_node_numbers_[num_thread % num_of_pus_];
         }
 
+        /// \brief Return the number of the cache group of the processing unit
+        ///        the given thread is running on. A cache group is the set of
+        ///        processing units sharing the outermost cache level (e.g.
+        ///        the L3 cache of a core complex) inside a NUMA domain.
+        ///
+        /// \param num_thread [in]
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        std::size_t get_cache_group_number(std::size_t num_thread,
+            [[maybe_unused]] error_code& ec = throws) const noexcept
+        {
+            return cache_group_numbers_[num_thread % num_of_pus_];
+        }
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the application.
         ///
@@ -179,6 +194,18 @@ namespace hpx::threads {
         mask_cref_type get_numa_node_affinity_mask(
             std::size_t num_thread, error_code& ec = throws) const;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit available to the given thread inside
+        ///        the cache group (see \a get_cache_group_number) it is
+        ///        running on.
+        ///
+        /// \param num_thread [in]
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        mask_cref_type get_cache_group_affinity_mask(
+            std::size_t num_thread, error_code& ec = throws) const;
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the given thread inside
         ///        the core it is running on.
@@ -245,6 +272,9 @@ namespace hpx::threads {
         /// \brief Return the number of available cores
         std::size_t get_number_of_cores() const;
 
+        /// \brief Return the number of available cache groups
+        std::size_t get_number_of_cache_groups() const noexcept;
+
         /// \brief Return the number of available hardware processing units
         std::size_t get_number_of_pus() const noexcept;
 
@@ -368,6 +398,8 @@ namespace hpx::threads {
                 get_numa_node_number(num_thread));
         }
 
+        mask_type init_cache_group_affinity_mask(std::size_t num_thread) const;
+
         mask_type init_core_affinity_mask(std::size_t num_thread) const
         {
             mask_type const default_mask =
@@ -407,6 +439,8 @@ namespace hpx::threads {
         std::vector<std::size_t> socket_numbers_;
         std::vector<std::size_t> numa_node_numbers_;
         std::vector<std::size_t> core_numbers_;
+        std::vector<std::size_t> cache_group_numbers_;
+        std::size_t num_of_cache_groups_ = 0;
 
         // Affinity masks: vectors of bitmasks
         // - Length of the vector: number of PUs of the machine
@@ -419,6 +453,7 @@ namespace hpx::threads {
         mask_type machine_affinity_mask_ = mask_type();
         std::vector<mask_type> socket_affinity_masks_;
         std::vector<mask_type> numa_node_affinity_masks_;
+        std::vector<mask_type> cache_group_affinity_masks_;
         std::vector<mask_type> core_affinity_masks_;
         std::vector<mask_type> thread_affinity_masks_;
     };
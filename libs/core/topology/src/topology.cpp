@@ -303,6 +303,32 @@ namespace hpx::threads {
                 init_numa_node_affinity_mask(i));
         }
 
+        // cache groups never span more than a single NUMA domain, this makes
+        // sure they nest properly (core -> cache group -> NUMA domain)
+        cache_group_affinity_masks_.reserve(num_of_pus_);
+        cache_group_numbers_.reserve(num_of_pus_);
+        for (std::size_t i = 0; i < num_of_pus_; ++i)
+        {
+            mask_type const mask = init_cache_group_affinity_mask(i) &
+                numa_node_affinity_masks_[i];
+
+            // number the cache groups in the order they are first seen
+            std::size_t group = num_of_cache_groups_;
+            for (std::size_t j = 0; j != i; ++j)
+            {
+                if (equal(cache_group_affinity_masks_[j], mask))
+                {
+                    group = cache_group_numbers_[j];
+                    break;
+                }
+            }
+            if (group == num_of_cache_groups_)
+                ++num_of_cache_groups_;
+
+            cache_group_numbers_.push_back(group);
+            cache_group_affinity_masks_.push_back(mask);
+        }
+
         for (std::size_t i = 0; i < num_of_pus_; ++i)
         {
             core_affinity_masks_.emplace_back(init_core_affinity_mask(i));
@@ -336,6 +362,7 @@ namespace hpx::threads {
         detail::write_to_log("socket_number", socket_numbers_);
         detail::write_to_log("numa_node_number", numa_node_numbers_);
         detail::write_to_log("core_number", core_numbers_);
+        detail::write_to_log("cache_group_number", cache_group_numbers_);
 
         detail::write_to_log_mask(
             "machine_affinity_mask", machine_affinity_mask_);
@@ -344,6 +371,8 @@ namespace hpx::threads {
             "socket_affinity_mask", socket_affinity_masks_);
         detail::write_to_log_mask(
             "numa_node_affinity_mask", numa_node_affinity_masks_);
+        detail::write_to_log_mask(
+            "cache_group_affinity_mask", cache_group_affinity_masks_);
         detail::write_to_log_mask("core_affinity_mask", core_affinity_masks_);
         detail::write_to_log_mask(
             "thread_affinity_mask", thread_affinity_masks_);
@@ -445,6 +474,24 @@ namespace hpx::threads {
         return empty_mask;
     }
 
+    mask_cref_type topology::get_cache_group_affinity_mask(
+        std::size_t num_thread, error_code& ec) const
+    {
+        if (std::size_t const num_pu = num_thread % num_of_pus_;
+            num_pu < cache_group_affinity_masks_.size())
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return cache_group_affinity_masks_[num_pu];
+        }
+
+        HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+            "hpx::threads::topology::get_cache_group_affinity_mask",
+            "thread number {1} is out of range", num_thread);
+        return empty_mask;
+    }
+
     mask_cref_type topology::get_core_affinity_mask(
         std::size_t num_thread, error_code& ec) const
     {
@@ -754,6 +801,11 @@ namespace hpx::threads {
         return static_cast<std::size_t>(nobjs);
     }
 
+    std::size_t topology::get_number_of_cache_groups() const noexcept
+    {
+        return num_of_cache_groups_;
+    }
+
     std::size_t topology::get_number_of_cores() const
     {
         int nobjs = hwloc_get_nbobjs_by_type(topo, HWLOC_OBJ_CORE);
@@ -1082,6 +1134,43 @@ namespace hpx::threads {
         return machine_affinity_mask_;
     }
 
+    mask_type topology::init_cache_group_affinity_mask(
+        std::size_t num_thread) const
+    {
+        std::size_t const num_pu = (num_thread + pu_offset) % num_of_pus_;
+
+        // find the outermost data (or unified) cache covering the given PU
+        hwloc_obj_t cache_obj = nullptr;
+        {
+            std::unique_lock<mutex_type> lk(topo_mtx);
+            for (hwloc_obj_t obj = hwloc_get_obj_by_type(
+                     topo, HWLOC_OBJ_PU, static_cast<unsigned>(num_pu));
+                 obj != nullptr; obj = obj->parent)
+            {
+#if HWLOC_API_VERSION >= 0x00020000
+                if (hwloc_obj_type_is_dcache(obj->type))
+#else
+                if (obj->type == HWLOC_OBJ_CACHE)
+#endif
+                {
+                    cache_obj = obj;
+                }
+            }
+        }
+
+        if (cache_obj)
+        {
+            mask_type cache_affinity_mask = mask_type();
+            resize(cache_affinity_mask, get_number_of_pus());
+
+            extract_node_mask(cache_obj, cache_affinity_mask);
+            return cache_affinity_mask;
+        }
+
+        // no cache information is available, fall back to the NUMA domain
+        return numa_node_affinity_masks_[num_thread];
+    }
+
     mask_type topology::init_core_affinity_mask_from_core(
         std::size_t core, mask_cref_type default_mask) const
     {
@@ -1656,6 +1745,8 @@ namespace hpx::threads {
         print_mask_vector(os, socket_affinity_masks_);
         os << "numa node             : \n";
         print_mask_vector(os, numa_node_affinity_masks_);
+        os << "cache group           : \n";
+        print_mask_vector(os, cache_group_affinity_masks_);
         os << "core                  : \n";
         print_mask_vector(os, core_affinity_masks_);
         os << "PUs (/threads)        : \n";
@@ -1667,6 +1758,8 @@ namespace hpx::threads {
         print_vector(os, socket_numbers_);
         os << "numa node             : \n";
         print_vector(os, numa_node_numbers_);
+        os << "cache group           : \n";
+        print_vector(os, cache_group_numbers_);
         os << "core                  : \n";
         print_vector(os, core_numbers_);
         //os << "PUs (/threads)        : \n";
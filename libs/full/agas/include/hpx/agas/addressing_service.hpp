@@ -11,8 +11,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/agas/agas_fwd.hpp>
-#include <hpx/cache/lru_cache.hpp>
-#include <hpx/cache/statistics/local_full_statistics.hpp>
+#include <hpx/agas/detail/gva_cache.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
 #include <hpx/datastructures/detail/dynamic_bitset.hpp>
 #include <hpx/functional/function.hpp>
@@ -27,6 +26,7 @@
 #include <hpx/synchronization/spinlock.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <map>
@@ -63,15 +63,12 @@ namespace hpx { namespace agas {
         using mutex_type = hpx::spinlock;
 
         // gva cache
-        struct gva_cache_key;
-
-        using gva_cache_type = hpx::util::cache::lru_cache<gva_cache_key, gva,
-            hpx::util::cache::statistics::local_full_statistics>;
+        using gva_cache_type = detail::gva_cache;
 
         using migrated_objects_table_type = std::set<naming::gid_type>;
         using refcnt_requests_type = std::map<naming::gid_type, std::int64_t>;
 
-        mutable hpx::shared_mutex gva_cache_mtx_;
+        // the cache synchronizes accesses internally
         std::shared_ptr<gva_cache_type> gva_cache_;
 
         mutable mutex_type migrated_objects_mtx_;
@@ -82,12 +79,22 @@ namespace hpx { namespace agas {
 
         std::size_t const max_refcnt_requests_;
 
+        // pending decrements are flushed at the latest after this interval
+        // has passed (disabled if zero)
+        std::chrono::milliseconds const refcnt_flush_interval_;
+
         mutex_type refcnt_requests_mtx_;
         std::size_t refcnt_requests_count_;
         bool enable_refcnt_caching_;
+        bool refcnt_flush_scheduled_;
 
         std::shared_ptr<refcnt_requests_type> refcnt_requests_;
 
+        // counters measuring how well decrements are coalesced
+        std::atomic<std::int64_t> refcnt_requests_received_;
+        std::atomic<std::int64_t> refcnt_ranges_sent_;
+        std::atomic<std::int64_t> refcnt_parcels_sent_;
+
         service_mode const service_type;
         runtime_mode const runtime_type;
 
@@ -247,6 +254,11 @@ namespace hpx { namespace agas {
         void send_refcnt_requests_sync(
             std::unique_lock<mutex_type>& l, error_code& ec);
 
+        /// Make sure the pending decrements will be sent after
+        /// \a refcnt_flush_interval_ has passed. Assumes that
+        /// \a refcnt_requests_mtx_ is locked.
+        void schedule_refcnt_flush(std::unique_lock<mutex_type>& l);
+
     public:
         // Helper functions to access the current cache statistics
         std::uint64_t get_cache_entries(bool) const;
@@ -265,6 +277,12 @@ namespace hpx { namespace agas {
         std::uint64_t get_cache_update_entry_time(bool reset) const;
         std::uint64_t get_cache_erase_entry_time(bool reset) const;
 
+        // Helper functions to access the reference count coalescing
+        // statistics
+        std::uint64_t get_refcnt_requests_received(bool reset);
+        std::uint64_t get_refcnt_ranges_sent(bool reset);
+        std::uint64_t get_refcnt_parcels_sent(bool reset);
+
     public:
         /// \brief Add a locality to the runtime.
         bool register_locality(parcelset::endpoints_type const& endpoints,
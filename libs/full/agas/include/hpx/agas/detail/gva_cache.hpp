@@ -0,0 +1,279 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/modules/agas_base.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/synchronization/shared_mutex.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::agas::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The \a gva_cache holds the GVAs of remote objects resolved by
+    ///        the addressing service.
+    ///
+    /// Entries for single GIDs are stored in a set-associative table which is
+    /// sharded by the hash of the GID. Each shard is protected by a lock which
+    /// is held by writers only. Lookups do not take any lock, they validate
+    /// the slot they read using its sequence number instead. Entries are
+    /// evicted using the CLOCK algorithm within each set, thus a cache hit
+    /// merely sets the reference bit of the slot (if it was not set already).
+    ///
+    /// Entries describing a range of GIDs are kept in a separate ordered
+    /// table, which is only consulted if it is not empty. Inserting a range
+    /// entry removes the entries for the single GIDs it covers.
+    class HPX_EXPORT gva_cache
+    {
+    public:
+        HPX_NON_COPYABLE(gva_cache);
+
+        static constexpr std::size_t num_shards = 64;
+        static constexpr std::size_t num_ways = 4;
+
+        /// The key of a cache entry: the (stripped) base GID and the number
+        /// of GIDs covered by the entry.
+        struct key_type
+        {
+            naming::gid_type gid;
+            std::uint64_t count = 1;
+        };
+
+        /// The statistics collected by the cache. The counters are striped
+        /// over the OS threads accessing the cache.
+        class HPX_EXPORT statistics_type
+        {
+        public:
+            enum class method : std::uint8_t
+            {
+                get_entry = 0,
+                insert_entry = 1,
+                update_entry = 2,
+                erase_entry = 3
+            };
+
+            void got_hit() noexcept;
+            void got_miss() noexcept;
+            void got_insertion() noexcept;
+            void got_eviction(std::int64_t count = 1) noexcept;
+            void got_call(method m, std::int64_t time) noexcept;
+
+            [[nodiscard]] std::int64_t hits(bool reset) noexcept;
+            [[nodiscard]] std::int64_t misses(bool reset) noexcept;
+            [[nodiscard]] std::int64_t insertions(bool reset) noexcept;
+            [[nodiscard]] std::int64_t evictions(bool reset) noexcept;
+
+            [[nodiscard]] std::int64_t get_get_entry_count(bool reset) noexcept;
+            [[nodiscard]] std::int64_t get_insert_entry_count(
+                bool reset) noexcept;
+            [[nodiscard]] std::int64_t get_update_entry_count(
+                bool reset) noexcept;
+            [[nodiscard]] std::int64_t get_erase_entry_count(
+                bool reset) noexcept;
+
+            [[nodiscard]] std::int64_t get_get_entry_time(bool reset) noexcept;
+            [[nodiscard]] std::int64_t get_insert_entry_time(
+                bool reset) noexcept;
+            [[nodiscard]] std::int64_t get_update_entry_time(
+                bool reset) noexcept;
+            [[nodiscard]] std::int64_t get_erase_entry_time(
+                bool reset) noexcept;
+
+        private:
+            enum counter : std::uint8_t
+            {
+                hits_ = 0,
+                misses_,
+                insertions_,
+                evictions_,
+                calls_,                  // 4 counters, one per method
+                times_ = calls_ + 4,     // 4 counters, one per method
+                num_counters_ = times_ + 4
+            };
+
+            static constexpr std::size_t num_stripes = 32;
+
+            struct stripe_type
+            {
+                std::array<std::atomic<std::int64_t>, num_counters_>
+                    counters_ = {};
+            };
+
+            stripe_type& stripe() noexcept;
+            std::int64_t get_and_reset(std::size_t c, bool reset) noexcept;
+
+            std::array<util::cache_aligned_data_derived<stripe_type>,
+                num_stripes>
+                stripes_;
+        };
+
+        /// Construct a cache holding at most \a max_size entries
+        explicit gva_cache(std::size_t max_size = 0);
+        ~gva_cache();
+
+        /// Return the number of entries currently held by the cache
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /// Return the maximum number of entries the cache may hold
+        [[nodiscard]] std::size_t capacity() const noexcept;
+
+        /// Change the maximum number of entries the cache may hold. Entries
+        /// that do not fit into the resized cache are evicted.
+        void reserve(std::size_t max_size);
+
+        /// Look up the entry covering the given GID. On success, \a idbase
+        /// receives the base GID of the entry found.
+        bool get_entry(
+            naming::gid_type const& id, naming::gid_type& idbase, gva& g);
+
+        /// Insert or update the entry for the \a count GIDs starting at
+        /// \a id. Returns false (and the key of the existing entry in
+        /// \a existing) if the new entry would collide with a different
+        /// entry already held by the cache.
+        bool update_if(naming::gid_type const& id, std::uint64_t count,
+            gva const& g, key_type& existing);
+
+        /// Remove all entries whose base GID is \a id, return the number of
+        /// entries removed.
+        std::size_t erase(naming::gid_type const& id);
+
+        /// Remove all entries from the cache
+        void clear();
+
+        [[nodiscard]] statistics_type& get_statistics() noexcept
+        {
+            return statistics_;
+        }
+
+    private:
+        // The data of a slot is stored as atomic words so that readers may
+        // copy it while a writer modifies the slot. The sequence number is
+        // odd while a write is in progress.
+        struct slot_type
+        {
+            enum word : std::uint8_t
+            {
+                key_msb = 0,
+                key_lsb,
+                prefix_msb,
+                prefix_lsb,
+                type,
+                count,
+                lva,
+                offset,
+                num_words
+            };
+
+            std::atomic<std::uint64_t> seq_ = 0;
+            std::array<std::atomic<std::uint64_t>, num_words> words_ = {};
+            mutable std::atomic<bool> referenced_ = false;
+        };
+
+        struct set_type
+        {
+            std::array<slot_type, num_ways> slots_;
+            std::size_t hand_ = 0;    // protected by the shard lock
+        };
+
+        struct table_type
+        {
+            explicit table_type(std::size_t num_sets);
+
+            std::size_t set_mask_;
+            std::unique_ptr<set_type[]> sets_;
+        };
+
+        struct shard_type
+        {
+            hpx::spinlock mtx_;
+            std::atomic<table_type*> table_ = nullptr;
+            std::atomic<std::size_t> size_ = 0;
+        };
+
+        // Entries covering a range of GIDs compare equal if they overlap
+        struct range_key
+        {
+            naming::gid_type first;
+            naming::gid_type last;
+
+            friend bool operator<(
+                range_key const& lhs, range_key const& rhs) noexcept
+            {
+                return lhs.last < rhs.first;
+            }
+        };
+
+        struct range_entry
+        {
+            explicit range_entry(gva const& g) noexcept
+              : gva_(g)
+            {
+            }
+
+            gva gva_;
+            mutable std::atomic<bool> referenced_ = true;
+        };
+
+        using range_table_type = std::map<range_key, range_entry>;
+
+        static std::uint64_t hash(naming::gid_type const& id) noexcept;
+
+        static bool read_slot(slot_type const& slot,
+            naming::gid_type const& id, gva& g) noexcept;
+        static void write_slot(slot_type& slot, naming::gid_type const& id,
+            gva const& g) noexcept;
+        static void clear_slot(slot_type& slot) noexcept;
+
+        static std::size_t sets_per_shard(std::size_t max_size) noexcept;
+
+        bool get_single_entry(naming::gid_type const& id, gva& g);
+        bool get_range_entry(
+            naming::gid_type const& id, naming::gid_type& idbase, gva& g);
+
+        void update_single_entry(naming::gid_type const& id, gva const& g);
+        bool update_range_entry(naming::gid_type const& id,
+            std::uint64_t count, gva const& g, key_type& existing);
+
+        void evict_range_entry();
+
+        bool erase_single_entry(naming::gid_type const& id);
+        void erase_single_entries(
+            naming::gid_type const& id, std::uint64_t count);
+
+        std::array<util::cache_aligned_data_derived<shard_type>, num_shards>
+            shards_;
+
+        mutable hpx::shared_mutex range_mtx_;
+        range_table_type ranges_;
+        naming::gid_type range_hand_;
+        std::atomic<std::size_t> range_count_ = 0;
+
+        std::atomic<std::size_t> max_size_;
+
+        // Tables replaced while resizing the cache are kept alive until the
+        // cache is destroyed as concurrent readers might still access them.
+        // The cache is resized during startup only.
+        hpx::spinlock retired_mtx_;
+        std::vector<std::unique_ptr<table_type>> retired_tables_;
+
+        statistics_type statistics_;
+    };
+}    // namespace hpx::agas::detail
+
+#include <hpx/config/warnings_suffix.hpp>
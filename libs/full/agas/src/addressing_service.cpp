@@ -16,6 +16,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/components_base/component_type.hpp>
 #include <hpx/datastructures/detail/dynamic_bitset.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_back.hpp>
@@ -30,10 +31,12 @@
 #include <hpx/naming/split_gid.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/runtime_local/state.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/vector.hpp>
 #include <hpx/synchronization/shared_mutex.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/threading/thread.hpp>
 #include <hpx/type_support/assert_owns_lock.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/util/insert_checked.hpp>
@@ -52,77 +55,19 @@
 
 namespace hpx::agas {
 
-    struct addressing_service::gva_cache_key
-    {
-    private:
-        using key_type = std::pair<naming::gid_type, naming::gid_type>;
-
-        key_type key_;
-
-    public:
-        gva_cache_key() = default;
-
-        explicit gva_cache_key(
-            naming::gid_type const& id, std::uint64_t count = 1)
-          : key_(naming::detail::get_stripped_gid(id),
-                naming::detail::get_stripped_gid(id) + (count - 1))
-        {
-            HPX_ASSERT(count);
-        }
-
-        naming::gid_type get_gid() const
-        {
-            return key_.first;
-        }
-
-        std::uint64_t get_count() const
-        {
-            naming::gid_type const size = key_.second - key_.first;
-            HPX_ASSERT(size.get_msb() == 0);
-            return size.get_lsb();
-        }
-
-        friend bool operator<(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            return lhs.key_.second < rhs.key_.first;
-        }
-
-        friend bool operator==(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            // Direct hit
-            if (lhs.key_ == rhs.key_)
-            {
-                return true;
-            }
-
-            // Is lhs in rhs?
-            if (1 == lhs.get_count() && 1 != rhs.get_count())
-            {
-                return rhs.key_.first <= lhs.key_.first &&
-                    lhs.key_.second <= rhs.key_.second;
-            }
-
-            // Is rhs in lhs?
-            if (1 != lhs.get_count() && 1 == rhs.get_count())
-            {
-                return lhs.key_.first <= rhs.key_.first &&
-                    rhs.key_.second <= lhs.key_.second;
-            }
-
-            return false;
-        }
-    };
-
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
       : gva_cache_(new gva_cache_type)
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
+      , refcnt_flush_interval_(ini_.get_agas_refcnt_flush_interval())
       , refcnt_requests_count_(0)
       , enable_refcnt_caching_(true)
+      , refcnt_flush_scheduled_(false)
       , refcnt_requests_(new refcnt_requests_type)
+      , refcnt_requests_received_(0)
+      , refcnt_ranges_sent_(0)
+      , refcnt_parcels_sent_(0)
       , service_type(ini_.get_agas_service_mode())
       , runtime_type(ini_.mode_)
       , caching_(ini_.get_agas_caching_mode())
@@ -847,6 +792,23 @@ namespace hpx::agas {
                 get_local_locality().get_msb());
     }
 
+    namespace {
+
+        // The ids of (non-migratable) components located on other localities
+        // encode the address of the referenced object as well. Only the
+        // component types opting in are resolved from these ids, while their
+        // global reference counts are still maintained by the owning
+        // locality (which deletes the object once its count drops to zero).
+        bool is_directly_addressable(naming::gid_type const& id)
+        {
+            return naming::is_lva_encoded(id) &&
+                components::supports_direct_addressing(
+                    static_cast<components::component_type>(
+                        naming::detail::get_component_type_from_gid(
+                            id.get_msb())));
+        }
+    }    // namespace
+
     bool addressing_service::resolve_locally_known_addresses(
         naming::gid_type const& id, naming::address& addr) const
     {
@@ -879,6 +841,14 @@ namespace hpx::agas {
                 return true;
             }
         }
+        else if (is_directly_addressable(id))
+        {
+            addr.locality_ = naming::get_locality_from_gid(id);
+            addr.type_ = naming::detail::get_component_type_from_gid(msb);
+            addr.address_ =
+                reinterpret_cast<naming::address::address_type>(lsb);
+            return true;
+        }
 
         msb = naming::detail::strip_internal_bits_from_gid(msb);
 
@@ -1518,6 +1488,8 @@ namespace hpx::agas {
                 }
             }
 
+            refcnt_requests_received_.fetch_add(1, std::memory_order_relaxed);
+
             send_refcnt_requests(l, ec);
         }
         catch (hpx::exception const& e)
@@ -1677,15 +1649,6 @@ namespace hpx::agas {
         return symbol_ns_.iterate_async(pattern);
     }
 
-    // This function has to return false if the key is already in the cache (true
-    // means go ahead with the cache update).
-    bool check_for_collisions(addressing_service::gva_cache_key const& new_key,
-        addressing_service::gva_cache_key const& old_key)
-    {
-        return (new_key.get_gid() != old_key.get_gid()) ||
-            (new_key.get_count() != old_key.get_count());
-    }
-
     void addressing_service::update_cache_entry(
         naming::gid_type const& id, gva const& g, error_code& ec)
     {
@@ -1707,9 +1670,11 @@ namespace hpx::agas {
 
         naming::gid_type const gid = naming::detail::get_stripped_gid(id);
 
-        // don't look at the cache if the id is locally managed
+        // don't look at the cache if the id is locally managed or if the id
+        // is resolved from the address it encodes
         if (naming::get_locality_id_from_gid(gid) ==
-            naming::get_locality_id_from_gid(locality_))
+                naming::get_locality_id_from_gid(locality_) ||
+            is_directly_addressable(gid))
         {
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1747,37 +1712,14 @@ namespace hpx::agas {
                 "addressing_service::update_cache_entry, gid({1}), count({2})",
                 gid, count);
 
-            gva_cache_key const key(gid, count);
-
+            if (gva_cache_type::key_type existing;
+                !gva_cache_->update_if(gid, count, g, existing))
             {
-                std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-                if (!gva_cache_->update_if(key, g, check_for_collisions))
-                {
-                    if (LAGAS_ENABLED(warning))
-                    {
-                        // Figure out who we collided with.
-                        addressing_service::gva_cache_key idbase;
-                        addressing_service::gva_cache_type::entry_type e;
-
-                        if (!gva_cache_->get_entry(key, idbase, e))
-                        {
-                            // This is impossible under sane conditions.
-                            lock.unlock();
-                            HPX_THROWS_IF(ec, hpx::error::invalid_data,
-                                "addressing_service::update_cache_entry",
-                                "data corruption or lock error occurred in "
-                                "cache");
-                            return;
-                        }
-
-                        LAGAS_(warning).format(
-                            "addressing_service::update_cache_entry, aborting "
-                            "update due to key collision in cache, "
-                            "new_gid({1}), new_count({2}), old_gid({3}), "
-                            "old_count({4})",
-                            gid, count, idbase.get_gid(), idbase.get_count());
-                    }
-                }
+                LAGAS_(warning).format(
+                    "addressing_service::update_cache_entry, aborting update "
+                    "due to key collision in cache, new_gid({1}), "
+                    "new_count({2}), old_gid({3}), old_count({4})",
+                    gid, count, existing.gid, existing.count);
             }
 
             if (&ec != &throws)
@@ -1801,17 +1743,14 @@ namespace hpx::agas {
         // don't look at cache if gid is marked as non-cache-able
         HPX_ASSERT(naming::detail::store_in_cache(gid));
 
-        gva_cache_key const k(gid);
-
-        std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        if (gva_cache_key idbase_key; gva_cache_->get_entry(k, idbase_key, gva))
+        if (naming::gid_type idbase_gid;
+            gva_cache_->get_entry(gid, idbase_gid, gva))
         {
             std::uint64_t const id_msb =
                 naming::detail::strip_internal_bits_from_gid(gid.get_msb());
 
-            if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
+            if (HPX_UNLIKELY(id_msb != idbase_gid.get_msb()))
             {
-                lock.unlock();
                 HPX_THROWS_IF(ec, hpx::error::internal_server_error,
                     "addressing_service::get_cache_entry",
                     "bad entry in cache, MSBs of GID base and GID do not "
@@ -1819,7 +1758,7 @@ namespace hpx::agas {
                 return false;
             }
 
-            idbase = idbase_key.get_gid();
+            idbase = idbase_gid;
             return true;
         }
 
@@ -1841,8 +1780,6 @@ namespace hpx::agas {
             LAGAS_(warning).format(
                 "addressing_service::clear_cache, clearing cache");
 
-            std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-
             gva_cache_->clear();
 
             if (&ec != &throws)
@@ -1882,16 +1819,12 @@ namespace hpx::agas {
             return;
         }
 
-        naming::gid_type gid = naming::detail::get_stripped_gid(id);
+        naming::gid_type const gid = naming::detail::get_stripped_gid(id);
         try
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
-            std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-
-            gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
-                return gid == p.first.get_gid();
-            });
+            gva_cache_->erase(gid);
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1918,31 +1851,26 @@ namespace hpx::agas {
     // Helper functions to access the current cache statistics
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->size();
     }
 
     std::uint64_t addressing_service::get_cache_hits(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().hits(reset);
     }
 
     std::uint64_t addressing_service::get_cache_misses(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().misses(reset);
     }
 
     std::uint64_t addressing_service::get_cache_evictions(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().evictions(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertions(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().insertions(reset);
     }
 
@@ -1950,58 +1878,70 @@ namespace hpx::agas {
     std::uint64_t addressing_service::get_cache_get_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_get_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_insert_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_update_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_erase_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_get_entry_time(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_get_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_time(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_insert_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_time(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_update_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_time(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->get_statistics().get_erase_entry_time(reset);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Helper functions to access the reference count coalescing statistics
+    std::uint64_t addressing_service::get_refcnt_requests_received(bool reset)
+    {
+        return reset ? refcnt_requests_received_.exchange(0) :
+                       refcnt_requests_received_.load();
+    }
+
+    std::uint64_t addressing_service::get_refcnt_ranges_sent(bool reset)
+    {
+        return reset ? refcnt_ranges_sent_.exchange(0) :
+                       refcnt_ranges_sent_.load();
+    }
+
+    std::uint64_t addressing_service::get_refcnt_parcels_sent(bool reset)
+    {
+        return reset ? refcnt_parcels_sent_.exchange(0) :
+                       refcnt_parcels_sent_.load();
+    }
+
     void addressing_service::register_server_instances()
     {
         // register root server
@@ -2044,12 +1984,104 @@ namespace hpx::agas {
 
         if (!enable_refcnt_caching_ ||
             max_refcnt_requests_ == ++refcnt_requests_count_)
+        {
             send_refcnt_requests_non_blocking(l, ec);
+            return;
+        }
+
+        schedule_refcnt_flush(l);
 
-        else if (&ec != &throws)
+        if (&ec != &throws)
             ec = make_success_code();
     }
 
+    void addressing_service::schedule_refcnt_flush(
+        std::unique_lock<addressing_service::mutex_type>& l)
+    {
+        HPX_ASSERT_OWNS_LOCK(l);
+
+        if (refcnt_flush_scheduled_ || refcnt_flush_interval_.count() == 0 ||
+            !threads::threadmanager_is(hpx::state::running))
+        {
+            return;
+        }
+
+        refcnt_flush_scheduled_ = true;
+
+        hpx::post([this]() {
+            hpx::this_thread::sleep_for(refcnt_flush_interval_);
+
+            std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+            refcnt_flush_scheduled_ = false;
+
+            // the pending requests are flushed synchronously while shutting
+            // down, no parcels may be sent once the runtime has stopped
+            if (!enable_refcnt_caching_ ||
+                !threads::threadmanager_is(hpx::state::running))
+            {
+                return;
+            }
+
+            error_code ec(throwmode::lightweight);
+            send_refcnt_requests_non_blocking(l, ec);
+        });
+    }
+
+    namespace {
+
+        using refcnt_range_type =
+            hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>;
+        using coalesced_refcnt_requests_type =
+            std::map<std::uint32_t, std::vector<refcnt_range_type>>;
+
+        // Group the pending decrements by the locality responsible for the
+        // GIDs. Equal decrements of consecutive GIDs are merged into a single
+        // range (the upper bound of which is inclusive).
+        coalesced_refcnt_requests_type coalesce_refcnt_requests(
+            addressing_service::refcnt_requests_type const& requests)
+        {
+            coalesced_refcnt_requests_type result;
+
+            std::uint32_t locality_id = naming::invalid_locality_id;
+            std::vector<refcnt_range_type>* ranges = nullptr;
+
+            for (auto const& e : requests)
+            {
+                HPX_ASSERT(e.second < 0);
+
+                // the requests are sorted by GID, thus the requests for one
+                // locality are adjacent
+                std::uint32_t const id =
+                    naming::get_locality_id_from_gid(e.first);
+                if (id == naming::invalid_locality_id)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "addressing_service::coalesce_refcnt_requests",
+                        "can't retrieve a valid locality id from global "
+                        "address ({1}): ",
+                        e.first);
+                }
+
+                if (ranges == nullptr || id != locality_id)
+                {
+                    locality_id = id;
+                    ranges = &result[id];
+                }
+                else if (refcnt_range_type& last = ranges->back();
+                    hpx::get<0>(last) == e.second &&
+                    hpx::get<2>(last) + 1 == e.first)
+                {
+                    hpx::get<2>(last) = e.first;
+                    continue;
+                }
+
+                ranges->emplace_back(e.second, e.first, e.first);
+            }
+
+            return result;
+        }
+    }    // namespace
+
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void dump_refcnt_requests(
         std::unique_lock<addressing_service::mutex_type>& l,
@@ -2111,30 +2143,23 @@ namespace hpx::agas {
 #endif
 
             // collect all requests for each locality
-            using requests_type = std::map<hpx::id_type,
-                std::vector<hpx::tuple<std::int64_t, naming::gid_type,
-                    naming::gid_type>>>;
-            requests_type requests;
+            coalesced_refcnt_requests_type requests =
+                coalesce_refcnt_requests(*p);
 
-            for (refcnt_requests_type::const_reference e : *p)
+            // send requests to all locality
+            for (auto& [locality_id, ranges] : requests)
             {
-                HPX_ASSERT(e.second < 0);
-
-                naming::gid_type raw(e.first);
+                refcnt_ranges_sent_.fetch_add(
+                    static_cast<std::int64_t>(ranges.size()),
+                    std::memory_order_relaxed);
+                refcnt_parcels_sent_.fetch_add(1, std::memory_order_relaxed);
 
-                hpx::id_type target(
-                    primary_namespace::get_service_instance(raw),
+                hpx::id_type const target(
+                    primary_namespace::get_service_instance(locality_id),
                     hpx::id_type::management_type::unmanaged);
 
-                requests[target].emplace_back(e.second, raw, raw);
-            }
-
-            // send requests to all locality
-            auto const end = requests.end();
-            for (auto it = requests.begin(); it != end; ++it)
-            {
                 server::primary_namespace::decrement_credit_action action;
-                hpx::post(action, it->first, HPX_MOVE(it->second));
+                hpx::post(action, target, HPX_MOVE(ranges));
             }
 
             if (&ec != &throws)
@@ -2182,31 +2207,26 @@ namespace hpx::agas {
 #endif
 
         // collect all requests for each locality
-        using requests_type = std::map<hpx::id_type,
-            std::vector<
-                hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>>>;
-        requests_type requests;
+        coalesced_refcnt_requests_type requests = coalesce_refcnt_requests(*p);
 
+        // send requests to all locality
         std::vector<hpx::future<std::vector<std::int64_t>>> lazy_results;
-        for (refcnt_requests_type::const_reference e : *p)
-        {
-            HPX_ASSERT(e.second < 0);
+        lazy_results.reserve(requests.size());
 
-            naming::gid_type raw(e.first);
+        for (auto& [locality_id, ranges] : requests)
+        {
+            refcnt_ranges_sent_.fetch_add(
+                static_cast<std::int64_t>(ranges.size()),
+                std::memory_order_relaxed);
+            refcnt_parcels_sent_.fetch_add(1, std::memory_order_relaxed);
 
-            hpx::id_type target(primary_namespace::get_service_instance(raw),
+            hpx::id_type const target(
+                primary_namespace::get_service_instance(locality_id),
                 hpx::id_type::management_type::unmanaged);
 
-            requests[target].emplace_back(e.second, raw, raw);
-        }
-
-        // send requests to all locality
-        auto const end = requests.end();
-        for (auto it = requests.begin(); it != end; ++it)
-        {
             server::primary_namespace::decrement_credit_action action;
             lazy_results.push_back(
-                hpx::async(action, it->first, HPX_MOVE(it->second)));
+                hpx::async(action, target, HPX_MOVE(ranges)));
         }
 
         return lazy_results;
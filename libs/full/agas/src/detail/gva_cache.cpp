@@ -0,0 +1,826 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/agas/detail/gva_cache.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/agas_base.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/synchronization/shared_mutex.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+
+namespace hpx::agas::detail {
+
+    namespace {
+
+        // Update the call count and the time spent in an API function of the
+        // cache on exit
+        struct update_on_exit
+        {
+            using method = gva_cache::statistics_type::method;
+
+            [[nodiscard]] static std::int64_t now() noexcept
+            {
+                std::chrono::nanoseconds const ns =
+                    std::chrono::steady_clock::now().time_since_epoch();
+                return static_cast<std::int64_t>(ns.count());
+            }
+
+            update_on_exit(
+                gva_cache::statistics_type& stat, method m) noexcept
+              : stat_(stat)
+              , method_(m)
+              , started_at_(now())
+            {
+            }
+
+            ~update_on_exit()
+            {
+                stat_.got_call(method_, now() - started_at_);
+            }
+
+            gva_cache::statistics_type& stat_;
+            method method_;
+            std::int64_t started_at_;
+        };
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    gva_cache::statistics_type::stripe_type&
+    gva_cache::statistics_type::stripe() noexcept
+    {
+        // assign the stripes to the OS threads round-robin
+        static std::atomic<std::size_t> next_stripe(0);
+        thread_local std::size_t const index =
+            next_stripe.fetch_add(1, std::memory_order_relaxed) % num_stripes;
+        return stripes_[index];
+    }
+
+    void gva_cache::statistics_type::got_hit() noexcept
+    {
+        stripe().counters_[hits_].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void gva_cache::statistics_type::got_miss() noexcept
+    {
+        stripe().counters_[misses_].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void gva_cache::statistics_type::got_insertion() noexcept
+    {
+        stripe().counters_[insertions_].fetch_add(
+            1, std::memory_order_relaxed);
+    }
+
+    void gva_cache::statistics_type::got_eviction(std::int64_t count) noexcept
+    {
+        if (count != 0)
+        {
+            stripe().counters_[evictions_].fetch_add(
+                count, std::memory_order_relaxed);
+        }
+    }
+
+    void gva_cache::statistics_type::got_call(
+        method m, std::int64_t time) noexcept
+    {
+        auto& counters = stripe().counters_;
+        auto const index = static_cast<std::size_t>(m);
+        counters[calls_ + index].fetch_add(1, std::memory_order_relaxed);
+        counters[times_ + index].fetch_add(time, std::memory_order_relaxed);
+    }
+
+    std::int64_t gva_cache::statistics_type::get_and_reset(
+        std::size_t c, bool reset) noexcept
+    {
+        std::int64_t result = 0;
+        for (auto& s : stripes_)
+        {
+            result += reset ?
+                s.counters_[c].exchange(0, std::memory_order_relaxed) :
+                s.counters_[c].load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    std::int64_t gva_cache::statistics_type::hits(bool reset) noexcept
+    {
+        return get_and_reset(hits_, reset);
+    }
+
+    std::int64_t gva_cache::statistics_type::misses(bool reset) noexcept
+    {
+        return get_and_reset(misses_, reset);
+    }
+
+    std::int64_t gva_cache::statistics_type::insertions(bool reset) noexcept
+    {
+        return get_and_reset(insertions_, reset);
+    }
+
+    std::int64_t gva_cache::statistics_type::evictions(bool reset) noexcept
+    {
+        return get_and_reset(evictions_, reset);
+    }
+
+    std::int64_t gva_cache::statistics_type::get_get_entry_count(
+        bool reset) noexcept
+    {
+        return get_and_reset(
+            calls_ + static_cast<std::size_t>(method::get_entry), reset);
+    }
+
+    std::int64_t gva_cache::statistics_type::get_insert_entry_count(
+        bool reset) noexcept
+    {
+        return get_and_reset(
+            calls_ + static_cast<std::size_t>(method::insert_entry), reset);
+    }
+
+    std::int64_t gva_cache::statistics_type::get_update_entry_count(
+        bool reset) noexcept
+    {
+        return get_and_reset(
+            calls_ + static_cast<std::size_t>(method::update_entry), reset);
+    }
+
+    std::int64_t gva_cache::statistics_type::get_erase_entry_count(
+        bool reset) noexcept
+    {
+        return get_and_reset(
+            calls_ + static_cast<std::size_t>(method::erase_entry), reset);
+    }
+
+    std::int64_t gva_cache::statistics_type::get_get_entry_time(
+        bool reset) noexcept
+    {
+        return get_and_reset(
+            times_ + static_cast<std::size_t>(method::get_entry), reset);
+    }
+
+    std::int64_t gva_cache::statistics_type::get_insert_entry_time(
+        bool reset) noexcept
+    {
+        return get_and_reset(
+            times_ + static_cast<std::size_t>(method::insert_entry), reset);
+    }
+
+    std::int64_t gva_cache::statistics_type::get_update_entry_time(
+        bool reset) noexcept
+    {
+        return get_and_reset(
+            times_ + static_cast<std::size_t>(method::update_entry), reset);
+    }
+
+    std::int64_t gva_cache::statistics_type::get_erase_entry_time(
+        bool reset) noexcept
+    {
+        return get_and_reset(
+            times_ + static_cast<std::size_t>(method::erase_entry), reset);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    gva_cache::table_type::table_type(std::size_t num_sets)
+      : set_mask_(num_sets - 1)
+      , sets_(new set_type[num_sets])
+    {
+        HPX_ASSERT(num_sets != 0 && (num_sets & set_mask_) == 0);
+    }
+
+    gva_cache::gva_cache(std::size_t max_size)
+      : max_size_(0)
+    {
+        reserve(max_size);
+    }
+
+    gva_cache::~gva_cache()
+    {
+        for (auto& shard : shards_)
+        {
+            delete shard.table_.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t gva_cache::size() const noexcept
+    {
+        std::size_t result = range_count_.load(std::memory_order_relaxed);
+        for (auto const& shard : shards_)
+        {
+            result += shard.size_.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    std::size_t gva_cache::capacity() const noexcept
+    {
+        return max_size_.load(std::memory_order_relaxed);
+    }
+
+    // The GIDs of the objects of a locality are allocated sequentially, mix
+    // the bits before distributing them over the shards and sets.
+    std::uint64_t gva_cache::hash(naming::gid_type const& id) noexcept
+    {
+        std::uint64_t h = id.get_lsb() ^ (id.get_msb() * 0x9e3779b97f4a7c15ULL);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    std::size_t gva_cache::sets_per_shard(std::size_t max_size) noexcept
+    {
+        std::size_t const per_shard = (max_size + num_shards * num_ways - 1) /
+            (num_shards * num_ways);
+
+        std::size_t num_sets = 1;
+        while (num_sets < per_shard)
+        {
+            num_sets <<= 1;
+        }
+        return num_sets;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Readers copy the slot and validate the copy using the sequence number,
+    // retrying if a writer modified the slot concurrently.
+    bool gva_cache::read_slot(
+        slot_type const& slot, naming::gid_type const& id, gva& g) noexcept
+    {
+        auto const& w = slot.words_;
+        while (true)
+        {
+            std::uint64_t const seq = slot.seq_.load(std::memory_order_acquire);
+            if (seq & 1)
+            {
+                HPX_SMT_PAUSE;
+                continue;
+            }
+
+            // a torn key can't be mistaken for a hit as the sequence number
+            // is validated below
+            if (w[slot_type::key_lsb].load(std::memory_order_relaxed) !=
+                    id.get_lsb() ||
+                w[slot_type::key_msb].load(std::memory_order_relaxed) !=
+                    id.get_msb())
+            {
+                return false;
+            }
+
+            std::uint64_t const prefix_msb =
+                w[slot_type::prefix_msb].load(std::memory_order_relaxed);
+            std::uint64_t const prefix_lsb =
+                w[slot_type::prefix_lsb].load(std::memory_order_relaxed);
+            std::uint64_t const type =
+                w[slot_type::type].load(std::memory_order_relaxed);
+            std::uint64_t const count =
+                w[slot_type::count].load(std::memory_order_relaxed);
+            std::uint64_t const lva =
+                w[slot_type::lva].load(std::memory_order_relaxed);
+            std::uint64_t const offset =
+                w[slot_type::offset].load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq_.load(std::memory_order_relaxed) != seq)
+            {
+                continue;
+            }
+
+            g = gva(naming::gid_type(prefix_msb, prefix_lsb),
+                static_cast<gva::component_type>(type), count, lva, offset);
+            return true;
+        }
+    }
+
+    // Expects the lock of the shard owning the slot to be held
+    void gva_cache::write_slot(
+        slot_type& slot, naming::gid_type const& id, gva const& g) noexcept
+    {
+        auto& w = slot.words_;
+        std::uint64_t const seq = slot.seq_.load(std::memory_order_relaxed);
+
+        slot.seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        w[slot_type::key_msb].store(id.get_msb(), std::memory_order_relaxed);
+        w[slot_type::key_lsb].store(id.get_lsb(), std::memory_order_relaxed);
+        w[slot_type::prefix_msb].store(
+            g.prefix.get_msb(), std::memory_order_relaxed);
+        w[slot_type::prefix_lsb].store(
+            g.prefix.get_lsb(), std::memory_order_relaxed);
+        w[slot_type::type].store(static_cast<std::uint64_t>(g.type),
+            std::memory_order_relaxed);
+        w[slot_type::count].store(g.count, std::memory_order_relaxed);
+        w[slot_type::lva].store(reinterpret_cast<std::uint64_t>(g.lva()),
+            std::memory_order_relaxed);
+        w[slot_type::offset].store(g.offset, std::memory_order_relaxed);
+
+        slot.seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    void gva_cache::clear_slot(slot_type& slot) noexcept
+    {
+        write_slot(slot, naming::invalid_gid, gva());
+        slot.referenced_.store(false, std::memory_order_relaxed);
+    }
+
+    namespace {
+
+        template <typename Slot>
+        bool slot_holds(Slot const& slot, naming::gid_type const& id) noexcept
+        {
+            return slot.words_[Slot::key_lsb].load(
+                       std::memory_order_relaxed) == id.get_lsb() &&
+                slot.words_[Slot::key_msb].load(std::memory_order_relaxed) ==
+                id.get_msb();
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void gva_cache::reserve(std::size_t max_size)
+    {
+        max_size_.store(max_size, std::memory_order_relaxed);
+
+        std::size_t const num_sets = sets_per_shard(max_size);
+        for (auto& shard : shards_)
+        {
+            auto new_table = std::make_unique<table_type>(num_sets);
+
+            std::unique_lock<hpx::spinlock> l(shard.mtx_);
+
+            table_type* old_table = shard.table_.load(std::memory_order_relaxed);
+            if (old_table != nullptr && old_table->set_mask_ + 1 == num_sets)
+            {
+                continue;
+            }
+
+            // move the existing entries to the new table
+            std::size_t size = 0;
+            std::int64_t evicted = 0;
+            if (old_table != nullptr)
+            {
+                for (std::size_t i = 0; i <= old_table->set_mask_; ++i)
+                {
+                    for (slot_type const& slot : old_table->sets_[i].slots_)
+                    {
+                        naming::gid_type const id(
+                            slot.words_[slot_type::key_msb].load(
+                                std::memory_order_relaxed),
+                            slot.words_[slot_type::key_lsb].load(
+                                std::memory_order_relaxed));
+                        if (!id)
+                        {
+                            continue;
+                        }
+
+                        gva g;
+                        [[maybe_unused]] bool const found =
+                            read_slot(slot, id, g);
+                        HPX_ASSERT(found);
+
+                        set_type& set = new_table->sets_[(hash(id) /
+                                                             num_shards) &
+                            new_table->set_mask_];
+
+                        slot_type* target = nullptr;
+                        for (slot_type& s : set.slots_)
+                        {
+                            if (slot_holds(s, naming::invalid_gid))
+                            {
+                                target = &s;
+                                break;
+                            }
+                        }
+
+                        if (target == nullptr)
+                        {
+                            ++evicted;
+                            continue;
+                        }
+
+                        write_slot(*target, id, g);
+                        target->referenced_.store(
+                            slot.referenced_.load(std::memory_order_relaxed),
+                            std::memory_order_relaxed);
+                        ++size;
+                    }
+                }
+            }
+
+            shard.table_.store(new_table.release(), std::memory_order_release);
+            shard.size_.store(size, std::memory_order_relaxed);
+
+            l.unlock();
+
+            statistics_.got_eviction(evicted);
+            if (old_table != nullptr)
+            {
+                std::lock_guard<hpx::spinlock> rl(retired_mtx_);
+                retired_tables_.emplace_back(old_table);
+            }
+        }
+
+        std::unique_lock<hpx::shared_mutex> l(range_mtx_);
+        while (ranges_.size() > num_sets * num_ways)
+        {
+            evict_range_entry();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool gva_cache::get_single_entry(naming::gid_type const& id, gva& g)
+    {
+        std::uint64_t const h = hash(id);
+        shard_type const& shard = shards_[h % num_shards];
+
+        table_type const* table = shard.table_.load(std::memory_order_acquire);
+        set_type const& set = table->sets_[(h / num_shards) & table->set_mask_];
+
+        for (slot_type const& slot : set.slots_)
+        {
+            if (read_slot(slot, id, g))
+            {
+                // avoid writing to the slot if it was referenced already
+                if (!slot.referenced_.load(std::memory_order_relaxed))
+                {
+                    slot.referenced_.store(true, std::memory_order_relaxed);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool gva_cache::get_range_entry(
+        naming::gid_type const& id, naming::gid_type& idbase, gva& g)
+    {
+        std::shared_lock<hpx::shared_mutex> l(range_mtx_);
+
+        auto const it = ranges_.find(range_key{id, id});
+        if (it == ranges_.end())
+        {
+            return false;
+        }
+
+        idbase = it->first.first;
+        g = it->second.gva_;
+        if (!it->second.referenced_.load(std::memory_order_relaxed))
+        {
+            it->second.referenced_.store(true, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    bool gva_cache::get_entry(
+        naming::gid_type const& id, naming::gid_type& idbase, gva& g)
+    {
+        update_on_exit update(
+            statistics_, statistics_type::method::get_entry);
+
+        naming::gid_type const gid = naming::detail::get_stripped_gid(id);
+        HPX_ASSERT(gid);
+
+        if (get_single_entry(gid, g))
+        {
+            idbase = gid;
+            statistics_.got_hit();
+            return true;
+        }
+
+        if (range_count_.load(std::memory_order_relaxed) != 0 &&
+            get_range_entry(gid, idbase, g))
+        {
+            statistics_.got_hit();
+            return true;
+        }
+
+        statistics_.got_miss();
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void gva_cache::update_single_entry(
+        naming::gid_type const& id, gva const& g)
+    {
+        std::uint64_t const h = hash(id);
+        shard_type& shard = shards_[h % num_shards];
+
+        std::lock_guard<hpx::spinlock> l(shard.mtx_);
+
+        table_type* table = shard.table_.load(std::memory_order_relaxed);
+        set_type& set = table->sets_[(h / num_shards) & table->set_mask_];
+
+        slot_type* empty = nullptr;
+        for (slot_type& slot : set.slots_)
+        {
+            if (slot_holds(slot, id))
+            {
+                write_slot(slot, id, g);
+                slot.referenced_.store(true, std::memory_order_relaxed);
+                statistics_.got_hit();
+                return;
+            }
+
+            if (empty == nullptr && slot_holds(slot, naming::invalid_gid))
+            {
+                empty = &slot;
+            }
+        }
+
+        statistics_.got_miss();
+        statistics_.got_insertion();
+
+        if (empty != nullptr)
+        {
+            write_slot(*empty, id, g);
+            shard.size_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // the set is full, give the entries referenced since the hand passed
+        // them last a second chance
+        slot_type* victim = nullptr;
+        while (victim == nullptr)
+        {
+            slot_type& slot = set.slots_[set.hand_];
+            set.hand_ = (set.hand_ + 1) % num_ways;
+
+            if (slot.referenced_.load(std::memory_order_relaxed))
+            {
+                slot.referenced_.store(false, std::memory_order_relaxed);
+            }
+            else
+            {
+                victim = &slot;
+            }
+        }
+
+        write_slot(*victim, id, g);
+        statistics_.got_eviction();
+    }
+
+    // Expects the range table to be locked exclusively
+    void gva_cache::evict_range_entry()
+    {
+        if (ranges_.empty())
+        {
+            return;
+        }
+
+        auto it = ranges_.lower_bound(range_key{range_hand_, range_hand_});
+        while (true)
+        {
+            if (it == ranges_.end())
+            {
+                it = ranges_.begin();
+            }
+
+            if (!it->second.referenced_.load(std::memory_order_relaxed))
+            {
+                break;
+            }
+
+            it->second.referenced_.store(false, std::memory_order_relaxed);
+            ++it;
+        }
+
+        it = ranges_.erase(it);
+        range_hand_ =
+            it != ranges_.end() ? it->first.first : naming::invalid_gid;
+        range_count_.store(ranges_.size(), std::memory_order_relaxed);
+
+        statistics_.got_eviction();
+    }
+
+    bool gva_cache::update_range_entry(naming::gid_type const& id,
+        std::uint64_t count, gva const& g, key_type& existing)
+    {
+        range_key const key{id, id + (count - 1)};
+
+        std::unique_lock<hpx::shared_mutex> l(range_mtx_);
+
+        if (auto const it = ranges_.find(key); it != ranges_.end())
+        {
+            if (it->first.first != key.first || it->first.last != key.last)
+            {
+                // the new entry overlaps with a different one
+                existing.gid = it->first.first;
+                existing.count =
+                    (it->first.last - it->first.first).get_lsb() + 1;
+                return false;
+            }
+
+            it->second.gva_ = g;
+            it->second.referenced_.store(true, std::memory_order_relaxed);
+            statistics_.got_hit();
+            return true;
+        }
+
+        statistics_.got_miss();
+        statistics_.got_insertion();
+
+        // the range table may hold as many entries as a single shard
+        std::size_t const max_ranges =
+            sets_per_shard(max_size_.load(std::memory_order_relaxed)) *
+            num_ways;
+        if (ranges_.size() >= max_ranges)
+        {
+            evict_range_entry();
+        }
+
+        ranges_.try_emplace(key, g);
+        range_count_.store(ranges_.size(), std::memory_order_relaxed);
+
+        return true;
+    }
+
+    bool gva_cache::update_if(naming::gid_type const& id, std::uint64_t count,
+        gva const& g, key_type& existing)
+    {
+        update_on_exit update(
+            statistics_, statistics_type::method::update_entry);
+
+        HPX_ASSERT(count != 0);
+
+        naming::gid_type const gid = naming::detail::get_stripped_gid(id);
+        HPX_ASSERT(gid);
+
+        if (count != 1)
+        {
+            if (!update_range_entry(gid, count, g, existing))
+            {
+                return false;
+            }
+
+            erase_single_entries(gid, count);
+            return true;
+        }
+
+        // don't add single entries for GIDs covered by a range entry
+        auto const covered_by_range = [&]() {
+            gva range_gva;
+            if (naming::gid_type idbase;
+                range_count_.load(std::memory_order_relaxed) != 0 &&
+                get_range_entry(gid, idbase, range_gva))
+            {
+                existing.gid = idbase;
+                existing.count = range_gva.count;
+                return true;
+            }
+            return false;
+        };
+
+        if (covered_by_range())
+        {
+            return false;
+        }
+
+        update_single_entry(gid, g);
+
+        // a range entry covering the GID might have been added concurrently
+        // after its single entries were removed
+        if (covered_by_range())
+        {
+            statistics_.got_eviction(erase_single_entry(gid) ? 1 : 0);
+            return false;
+        }
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool gva_cache::erase_single_entry(naming::gid_type const& id)
+    {
+        std::uint64_t const h = hash(id);
+        shard_type& shard = shards_[h % num_shards];
+
+        std::lock_guard<hpx::spinlock> l(shard.mtx_);
+
+        table_type* table = shard.table_.load(std::memory_order_relaxed);
+        set_type& set = table->sets_[(h / num_shards) & table->set_mask_];
+
+        for (slot_type& slot : set.slots_)
+        {
+            if (slot_holds(slot, id))
+            {
+                clear_slot(slot);
+                shard.size_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Entries for single GIDs are looked up before the range entries, remove
+    // those covered by a new range entry as they would shadow it otherwise.
+    void gva_cache::erase_single_entries(
+        naming::gid_type const& id, std::uint64_t count)
+    {
+        std::int64_t erased = 0;
+        if (count <= max_size_.load(std::memory_order_relaxed))
+        {
+            naming::gid_type gid = id;
+            for (std::uint64_t i = 0; i != count; ++i, ++gid)
+            {
+                if (erase_single_entry(gid))
+                {
+                    ++erased;
+                }
+            }
+        }
+        else
+        {
+            // the range is larger than the cache, scan all slots instead
+            naming::gid_type const last = id + (count - 1);
+            for (auto& shard : shards_)
+            {
+                std::lock_guard<hpx::spinlock> l(shard.mtx_);
+
+                table_type* table =
+                    shard.table_.load(std::memory_order_relaxed);
+                for (std::size_t i = 0; i <= table->set_mask_; ++i)
+                {
+                    for (slot_type& slot : table->sets_[i].slots_)
+                    {
+                        naming::gid_type const gid(
+                            slot.words_[slot_type::key_msb].load(
+                                std::memory_order_relaxed),
+                            slot.words_[slot_type::key_lsb].load(
+                                std::memory_order_relaxed));
+                        if (gid && !(gid < id) && !(last < gid))
+                        {
+                            clear_slot(slot);
+                            shard.size_.fetch_sub(
+                                1, std::memory_order_relaxed);
+                            ++erased;
+                        }
+                    }
+                }
+            }
+        }
+
+        statistics_.got_eviction(erased);
+    }
+
+    std::size_t gva_cache::erase(naming::gid_type const& id)
+    {
+        update_on_exit update(
+            statistics_, statistics_type::method::erase_entry);
+
+        naming::gid_type const gid = naming::detail::get_stripped_gid(id);
+
+        std::size_t erased = erase_single_entry(gid) ? 1 : 0;
+
+        if (range_count_.load(std::memory_order_relaxed) != 0)
+        {
+            std::unique_lock<hpx::shared_mutex> l(range_mtx_);
+
+            auto const it = ranges_.find(range_key{gid, gid});
+            if (it != ranges_.end() && it->first.first == gid)
+            {
+                ranges_.erase(it);
+                range_count_.store(ranges_.size(), std::memory_order_relaxed);
+                ++erased;
+            }
+        }
+
+        statistics_.got_eviction(static_cast<std::int64_t>(erased));
+        return erased;
+    }
+
+    void gva_cache::clear()
+    {
+        for (auto& shard : shards_)
+        {
+            std::lock_guard<hpx::spinlock> l(shard.mtx_);
+
+            table_type* table = shard.table_.load(std::memory_order_relaxed);
+            for (std::size_t i = 0; i <= table->set_mask_; ++i)
+            {
+                for (slot_type& slot : table->sets_[i].slots_)
+                {
+                    if (!slot_holds(slot, naming::invalid_gid))
+                    {
+                        clear_slot(slot);
+                    }
+                }
+            }
+            shard.size_.store(0, std::memory_order_relaxed);
+        }
+
+        std::unique_lock<hpx::shared_mutex> l(range_mtx_);
+        ranges_.clear();
+        range_hand_ = naming::invalid_gid;
+        range_count_.store(0, std::memory_order_relaxed);
+    }
+}    // namespace hpx::agas::detail
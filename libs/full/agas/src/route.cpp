@@ -53,7 +53,8 @@ namespace hpx::agas::server {
         // resolve destination addresses, we should be able to resolve all of
         // them, otherwise it's an error
         {
-            std::unique_lock<primary_namespace::mutex_type> l(server.mutex());
+            std::unique_lock<primary_namespace::mutex_type> l(
+                server.mutex(gid));
 
             error_code& ec = throws;
 
@@ -0,0 +1,373 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/agas/detail/gva_cache.hpp>
+#include <hpx/future.hpp>
+#include <hpx/modules/agas_base.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::agas::gva;
+using hpx::agas::detail::gva_cache;
+using hpx::naming::gid_type;
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::uint64_t locality_msb = 0x0000000200000000ull;
+
+gid_type make_gid(std::uint64_t lsb)
+{
+    return gid_type(locality_msb, lsb);
+}
+
+// all fields of the gva are derived from the given value, which allows to
+// detect a gva assembled from different writes
+gva make_gva(std::uint64_t value, std::uint64_t count = 1)
+{
+    return gva(gid_type(value), static_cast<gva::component_type>(value % 1000),
+        count, value, value);
+}
+
+bool is_consistent(gva const& g)
+{
+    std::uint64_t const value = g.prefix.get_lsb();
+    return g.prefix.get_msb() == 0 &&
+        g.type == static_cast<gva::component_type>(value % 1000) &&
+        g.count == 1 && reinterpret_cast<std::uint64_t>(g.lva()) == value &&
+        g.offset == value;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_hit_miss()
+{
+    gva_cache cache(1024);
+
+    gid_type const id = make_gid(1);
+    gid_type idbase;
+    gva g;
+
+    HPX_TEST(!cache.get_entry(id, idbase, g));
+
+    gva_cache::key_type existing;
+    HPX_TEST(cache.update_if(id, 1, make_gva(42), existing));
+    HPX_TEST_EQ(cache.size(), static_cast<std::size_t>(1));
+
+    HPX_TEST(cache.get_entry(id, idbase, g));
+    HPX_TEST_EQ(idbase, id);
+    HPX_TEST(g == make_gva(42));
+
+    // updating the entry replaces the gva without adding a new entry
+    HPX_TEST(cache.update_if(id, 1, make_gva(43), existing));
+    HPX_TEST_EQ(cache.size(), static_cast<std::size_t>(1));
+
+    HPX_TEST(cache.get_entry(id, idbase, g));
+    HPX_TEST(g == make_gva(43));
+
+    HPX_TEST(!cache.get_entry(make_gid(2), idbase, g));
+
+    auto& stats = cache.get_statistics();
+    HPX_TEST_EQ(stats.hits(false), std::int64_t(3));
+    HPX_TEST_EQ(stats.misses(false), std::int64_t(3));
+    HPX_TEST_EQ(stats.insertions(false), std::int64_t(1));
+}
+
+// A cache of this size has a single set per shard, thus the inserted GIDs
+// fill the sets and evict each other.
+void test_clock_eviction()
+{
+    gva_cache cache(gva_cache::num_shards * gva_cache::num_ways);
+
+    gid_type const referenced = make_gid(1);
+
+    gva_cache::key_type existing;
+    HPX_TEST(cache.update_if(referenced, 1, make_gva(1), existing));
+
+    gid_type idbase;
+    gva g;
+    for (std::uint64_t i = 2; i != 10000; ++i)
+    {
+        HPX_TEST(cache.update_if(make_gid(i), 1, make_gva(i), existing));
+
+        // the entry referenced after each insertion gets a second chance
+        // whenever its set is full
+        HPX_TEST(cache.get_entry(referenced, idbase, g));
+        HPX_TEST(g == make_gva(1));
+    }
+
+    HPX_TEST_LTE(cache.size(), cache.capacity());
+    HPX_TEST_EQ(cache.size(), cache.capacity());
+    HPX_TEST_LT(std::int64_t(0), cache.get_statistics().evictions(false));
+
+    // all entries that are still cached map to their original gva
+    std::size_t found = 0;
+    for (std::uint64_t i = 1; i != 10000; ++i)
+    {
+        if (cache.get_entry(make_gid(i), idbase, g))
+        {
+            HPX_TEST(g == make_gva(i));
+            ++found;
+        }
+    }
+    HPX_TEST_EQ(found, cache.size());
+}
+
+void test_range_overlap()
+{
+    gva_cache cache(1024);
+
+    gva_cache::key_type existing;
+    HPX_TEST(cache.update_if(make_gid(1000), 16, make_gva(1, 16), existing));
+
+    // partially overlapping ranges are rejected
+    HPX_TEST(!cache.update_if(make_gid(1008), 16, make_gva(2, 16), existing));
+    HPX_TEST_EQ(existing.gid, make_gid(1000));
+    HPX_TEST_EQ(existing.count, std::uint64_t(16));
+
+    existing = gva_cache::key_type();
+    HPX_TEST(!cache.update_if(make_gid(990), 16, make_gva(2, 16), existing));
+    HPX_TEST_EQ(existing.gid, make_gid(1000));
+    HPX_TEST_EQ(existing.count, std::uint64_t(16));
+
+    // as are single entries inside of the range
+    existing = gva_cache::key_type();
+    HPX_TEST(!cache.update_if(make_gid(1005), 1, make_gva(3), existing));
+    HPX_TEST_EQ(existing.gid, make_gid(1000));
+    HPX_TEST_EQ(existing.count, std::uint64_t(16));
+
+    // the same range may be updated
+    HPX_TEST(cache.update_if(make_gid(1000), 16, make_gva(4, 16), existing));
+    HPX_TEST_EQ(cache.size(), static_cast<std::size_t>(1));
+
+    gid_type idbase;
+    gva g;
+    HPX_TEST(cache.get_entry(make_gid(1015), idbase, g));
+    HPX_TEST_EQ(idbase, make_gid(1000));
+    HPX_TEST(g == make_gva(4, 16));
+
+    HPX_TEST(!cache.get_entry(make_gid(1016), idbase, g));
+    HPX_TEST(!cache.get_entry(make_gid(999), idbase, g));
+
+    // adjacent ranges do not overlap
+    HPX_TEST(cache.update_if(make_gid(1016), 16, make_gva(5, 16), existing));
+    HPX_TEST_EQ(cache.size(), static_cast<std::size_t>(2));
+
+    HPX_TEST(cache.get_entry(make_gid(1016), idbase, g));
+    HPX_TEST_EQ(idbase, make_gid(1016));
+    HPX_TEST(g == make_gva(5, 16));
+}
+
+void test_range_covers_single(std::uint64_t base, std::uint64_t count)
+{
+    gva_cache cache(1024);
+
+    gva_cache::key_type existing;
+    for (std::uint64_t i = 0; i != 8; ++i)
+    {
+        HPX_TEST(
+            cache.update_if(make_gid(base + i), 1, make_gva(i + 1), existing));
+    }
+    HPX_TEST(cache.update_if(make_gid(base + 8), 1, make_gva(9), existing));
+
+    // the range replaces the single entries it covers
+    HPX_TEST(cache.update_if(make_gid(base), count, make_gva(100, count),
+        existing));
+    HPX_TEST_EQ(cache.size(), static_cast<std::size_t>(count < 9 ? 2 : 1));
+
+    gid_type idbase;
+    gva g;
+    for (std::uint64_t i = 0; i != 8; ++i)
+    {
+        HPX_TEST(cache.get_entry(make_gid(base + i), idbase, g));
+        HPX_TEST_EQ(idbase, make_gid(base));
+        HPX_TEST(g == make_gva(100, count));
+    }
+
+    HPX_TEST(cache.get_entry(make_gid(base + 8), idbase, g));
+    if (count < 9)
+    {
+        HPX_TEST_EQ(idbase, make_gid(base + 8));
+        HPX_TEST(g == make_gva(9));
+    }
+    else
+    {
+        HPX_TEST_EQ(idbase, make_gid(base));
+    }
+}
+
+void test_erase()
+{
+    gva_cache cache(1024);
+
+    gva_cache::key_type existing;
+    HPX_TEST(cache.update_if(make_gid(1), 1, make_gva(1), existing));
+    HPX_TEST(cache.update_if(make_gid(100), 16, make_gva(2, 16), existing));
+    HPX_TEST_EQ(cache.size(), static_cast<std::size_t>(2));
+
+    HPX_TEST_EQ(cache.erase(make_gid(1)), static_cast<std::size_t>(1));
+    HPX_TEST_EQ(cache.erase(make_gid(1)), static_cast<std::size_t>(0));
+
+    // ranges are erased using their base GID only
+    HPX_TEST_EQ(cache.erase(make_gid(105)), static_cast<std::size_t>(0));
+    HPX_TEST_EQ(cache.erase(make_gid(100)), static_cast<std::size_t>(1));
+    HPX_TEST_EQ(cache.size(), static_cast<std::size_t>(0));
+
+    gid_type idbase;
+    gva g;
+    HPX_TEST(!cache.get_entry(make_gid(1), idbase, g));
+    HPX_TEST(!cache.get_entry(make_gid(105), idbase, g));
+
+    // erased slots are reused
+    HPX_TEST(cache.update_if(make_gid(1), 1, make_gva(3), existing));
+    HPX_TEST(cache.get_entry(make_gid(1), idbase, g));
+    HPX_TEST(g == make_gva(3));
+
+    cache.clear();
+    HPX_TEST_EQ(cache.size(), static_cast<std::size_t>(0));
+    HPX_TEST(!cache.get_entry(make_gid(1), idbase, g));
+}
+
+void test_reserve()
+{
+    constexpr std::uint64_t num_entries = 2000;
+
+    gva_cache cache(4096);
+
+    gva_cache::key_type existing;
+    for (std::uint64_t i = 1; i <= num_entries; ++i)
+    {
+        HPX_TEST(cache.update_if(make_gid(i), 1, make_gva(i), existing));
+    }
+
+    gid_type idbase;
+    gva g;
+    std::vector<std::uint64_t> cached;
+    for (std::uint64_t i = 1; i <= num_entries; ++i)
+    {
+        if (cache.get_entry(make_gid(i), idbase, g))
+        {
+            cached.push_back(i);
+        }
+    }
+    HPX_TEST_EQ(cached.size(), cache.size());
+
+    // growing the cache keeps all entries
+    cache.reserve(16384);
+    HPX_TEST_EQ(cache.capacity(), static_cast<std::size_t>(16384));
+    HPX_TEST_EQ(cache.size(), cached.size());
+    for (std::uint64_t i : cached)
+    {
+        HPX_TEST(cache.get_entry(make_gid(i), idbase, g));
+        HPX_TEST(g == make_gva(i));
+    }
+
+    // shrinking the cache evicts the entries that don't fit anymore
+    std::int64_t const evictions = cache.get_statistics().evictions(false);
+
+    cache.reserve(256);
+    HPX_TEST_EQ(cache.capacity(), static_cast<std::size_t>(256));
+    HPX_TEST_LTE(cache.size(), static_cast<std::size_t>(256));
+    HPX_TEST_EQ(cache.get_statistics().evictions(false) - evictions,
+        static_cast<std::int64_t>(cached.size() - cache.size()));
+
+    std::size_t found = 0;
+    for (std::uint64_t i = 1; i <= num_entries; ++i)
+    {
+        if (cache.get_entry(make_gid(i), idbase, g))
+        {
+            HPX_TEST(g == make_gva(i));
+            ++found;
+        }
+    }
+    HPX_TEST_EQ(found, cache.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Readers must never observe a gva assembled from different writes to the
+// same slot.
+void test_concurrent_access()
+{
+    constexpr std::size_t num_writers = 4;
+    constexpr std::size_t num_readers = 4;
+    constexpr std::uint64_t num_ids = 64;
+    constexpr std::uint64_t num_iterations = 100000;
+
+    // a small cache makes the writers evict each other's entries
+    gva_cache cache(gva_cache::num_shards * gva_cache::num_ways);
+
+    std::vector<hpx::future<void>> threads;
+    threads.reserve(num_writers + num_readers);
+
+    for (std::size_t w = 0; w != num_writers; ++w)
+    {
+        threads.push_back(hpx::async([&cache, w]() {
+            gva_cache::key_type existing;
+            for (std::uint64_t i = 0; i != num_iterations; ++i)
+            {
+                std::uint64_t const value = i * num_writers + w + 1;
+                cache.update_if(make_gid(1 + value % num_ids), 1,
+                    make_gva(value), existing);
+            }
+        }));
+    }
+
+    for (std::size_t r = 0; r != num_readers; ++r)
+    {
+        threads.push_back(hpx::async([&cache, r]() {
+            gid_type idbase;
+            gva g;
+            for (std::uint64_t i = 0; i != num_iterations; ++i)
+            {
+                gid_type const id = make_gid(1 + (i + r) % num_ids);
+                if (cache.get_entry(id, idbase, g))
+                {
+                    HPX_TEST_EQ(idbase, id);
+                    HPX_TEST(is_consistent(g));
+                }
+            }
+        }));
+    }
+
+    hpx::wait_all(threads);
+    for (auto& f : threads)
+    {
+        HPX_TEST(!f.has_exception());
+    }
+
+    HPX_TEST_LTE(cache.size(), cache.capacity());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_hit_miss();
+    test_clock_eviction();
+    test_range_overlap();
+
+    // ranges smaller and larger than the cache remove the covered entries
+    // using different strategies
+    test_range_covers_single(1000, 8);
+    test_range_covers_single(1000, 4096);
+
+    test_erase();
+    test_reserve();
+    test_concurrent_access();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
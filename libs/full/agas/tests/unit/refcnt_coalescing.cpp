@@ -0,0 +1,173 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the buffered credit decrements of consecutive GIDs are sent as
+// ranges and that every GID of a range is decremented.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> destroyed(0);
+
+struct test_server : hpx::components::component_base<test_server>
+{
+    ~test_server()
+    {
+        ++destroyed;
+    }
+
+    hpx::id_type call() const
+    {
+        return hpx::find_here();
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call)
+};
+
+using server_type = hpx::components::component<test_server>;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+using call_action = test_server::call_action;
+HPX_REGISTER_ACTION(call_action)
+
+constexpr std::size_t num_objects = 64;
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t query_counter(std::string const& name)
+{
+    hpx::performance_counters::performance_counter counter(
+        "/agas{locality#0/total}/count/refcnt/" + name);
+    return counter.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+hpx::naming::gid_type stripped_gid(hpx::id_type const& id)
+{
+    return hpx::naming::detail::get_stripped_gid(id.get_gid());
+}
+
+// the objects are destroyed once their last credit was returned
+void wait_for_destroyed(std::size_t expected)
+{
+    auto const deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (destroyed.load() < expected &&
+        std::chrono::steady_clock::now() < deadline)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    HPX_TEST_EQ(destroyed.load(), expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::vector<hpx::id_type> ids =
+        hpx::new_<test_server[]>(hpx::find_here(), num_objects).get();
+    HPX_TEST_EQ(ids.size(), num_objects);
+
+    std::sort(ids.begin(), ids.end(),
+        [](hpx::id_type const& lhs, hpx::id_type const& rhs) {
+            return stripped_gid(lhs) < stripped_gid(rhs);
+        });
+
+    // split the credits of all objects, thus their credits are returned to
+    // AGAS instead of destroying them directly. Keep the split credits of the
+    // first half of the objects, thus the decrements of both halves differ.
+    std::vector<hpx::id_type> kept;
+    std::vector<hpx::id_type> released;
+    kept.reserve(num_objects / 2);
+    released.reserve(num_objects - num_objects / 2);
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        (i < num_objects / 2 ? kept : released)
+            .emplace_back(hpx::naming::detail::split_credits_for_gid(
+                              ids[i].get_gid()),
+                hpx::id_type::management_type::managed);
+    }
+
+    // count the runs of consecutive GIDs with equal decrements
+    std::int64_t runs = 1;
+    for (std::size_t i = 1; i != num_objects; ++i)
+    {
+        if (i == num_objects / 2 ||
+            stripped_gid(ids[i - 1]) + 1 != stripped_gid(ids[i]))
+        {
+            ++runs;
+        }
+    }
+
+    std::int64_t const requests = query_counter("requests");
+    std::int64_t const ranges = query_counter("ranges");
+    std::int64_t const parcels = query_counter("parcels");
+
+    // the decrements are buffered until they are flushed explicitly
+    ids.clear();
+    released.clear();
+    HPX_TEST_EQ(destroyed.load(), std::size_t(0));
+
+    hpx::agas::garbage_collect();
+
+    std::int64_t const expected_requests =
+        static_cast<std::int64_t>(num_objects + num_objects / 2);
+    std::int64_t const requests_received = query_counter("requests") - requests;
+    std::int64_t const ranges_sent = query_counter("ranges") - ranges;
+
+    HPX_TEST_LTE(expected_requests, requests_received);
+    HPX_TEST_LT(parcels, query_counter("parcels"));
+
+    // other decrements may have been buffered concurrently, those are sent
+    // as ranges of their own at worst
+    HPX_TEST_LTE(ranges_sent, runs + requests_received - expected_requests);
+    HPX_TEST_LT(ranges_sent, requests_received);
+
+    // every GID of the second half has lost its last credit, while the GIDs
+    // of the first half still hold the credits kept
+    wait_for_destroyed(num_objects - num_objects / 2);
+    for (hpx::id_type const& id : kept)
+    {
+        HPX_TEST_EQ(hpx::async<call_action>(id).get(), hpx::find_here());
+    }
+
+    kept.clear();
+    hpx::agas::garbage_collect();
+
+    wait_for_destroyed(num_objects);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // disable flushing the buffered decrements implicitly
+    std::vector<std::string> const cfg = {
+        "hpx.agas.max_pending_refcnt_requests!=100000",
+        "hpx.agas.refcnt_flush_interval!=0"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
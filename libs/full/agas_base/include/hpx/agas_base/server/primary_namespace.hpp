@@ -19,12 +19,15 @@
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/server/fixed_component_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/parcelset_base/traits/action_get_embedded_parcel.hpp>
 #include <hpx/synchronization/condition_variable.hpp>
 
+#include <array>
 #include <atomic>
+#include <bitset>
 #include <cstddef>
 #include <cstdint>
 #include <list>
@@ -126,27 +129,129 @@ namespace hpx::agas::server {
         using resolved_type =
             hpx::tuple<naming::gid_type, gva, naming::gid_type>;
 
-        mutex_type& mutex()
+        // The GVA, reference count, and migration tables are partitioned
+        // into shards, each of which is protected by its own lock. Aligned
+        // blocks of 2^gid_block_bits consecutive GIDs are assigned to the
+        // shards round-robin, thus operations on different objects rarely
+        // contend for the same lock.
+        static constexpr std::size_t num_shards = 64;
+        static constexpr std::size_t gid_block_bits = 4;
+
+        // Return the mutex protecting the table entries for the given GID
+        mutex_type& mutex(naming::gid_type const& id) noexcept
         {
-            return mutex_;
+            return shard_for(id).mutex_;
         }
 
     private:
-        // REVIEW: Separate mutexes might reduce contention here. This has to be
-        // investigated carefully.
-        mutex_type mutex_;
-
-        gva_table_type gvas_;
-        refcnt_table_type refcnts_;
-
         using migration_table_type = std::map<naming::gid_type,
             hpx::tuple<bool, std::size_t,
                 lcos::local::detail::condition_variable>>;
 
+        struct shard_type
+        {
+            mutex_type mutex_;
+            gva_table_type gvas_;
+
+            // GVA table entries for ranges crossing a block boundary. These
+            // are stored in every shard one of their blocks belongs to, thus
+            // looking up a GID needs to lock its own shard only.
+            gva_table_type spanning_gvas_;
+
+            refcnt_table_type refcnts_;
+            migration_table_type migrating_objects_;
+        };
+
+        static constexpr std::size_t shard_index(
+            naming::gid_type const& id) noexcept
+        {
+            std::uint64_t const msb =
+                naming::detail::strip_internal_bits_from_gid(id.get_msb());
+            return static_cast<std::size_t>(
+                ((id.get_lsb() >> gid_block_bits) ^ msb) % num_shards);
+        }
+
+        // Return whether the given (stripped) GIDs belong to the same block
+        static constexpr bool same_block(
+            naming::gid_type const& lhs, naming::gid_type const& rhs) noexcept
+        {
+            return lhs.get_msb() == rhs.get_msb() &&
+                (lhs.get_lsb() >> gid_block_bits) ==
+                (rhs.get_lsb() >> gid_block_bits);
+        }
+
+        shard_type& shard_for(naming::gid_type const& id) noexcept
+        {
+            return shards_[shard_index(id)];
+        }
+
+        // Return the shards the blocks of the given (stripped) range belong
+        // to
+        static std::bitset<num_shards> spanned_shards(
+            naming::gid_type const& id, std::uint64_t count) noexcept;
+
+        // The locks of several shards are always acquired in the order of
+        // the shard indices
+        void lock_shards(std::bitset<num_shards> const& shards);
+        void unlock_shards(std::bitset<num_shards> const& shards) noexcept;
+
+        // Holds the locks of a set of shards, the locks are released when
+        // the guard goes out of scope
+        class shards_lock
+        {
+        public:
+            HPX_NON_COPYABLE(shards_lock);
+
+            shards_lock(primary_namespace& pns,
+                std::bitset<num_shards> const& shards)
+              : pns_(pns)
+              , shards_(shards)
+            {
+                pns_.lock_shards(shards_);
+                owns_lock_ = true;
+            }
+
+            ~shards_lock()
+            {
+                unlock();
+            }
+
+            // release the held locks and acquire the locks of the given
+            // shards instead
+            void lock(std::bitset<num_shards> const& shards)
+            {
+                unlock();
+                shards_ = shards;
+                pns_.lock_shards(shards_);
+                owns_lock_ = true;
+            }
+
+            void unlock() noexcept
+            {
+                if (owns_lock_)
+                {
+                    owns_lock_ = false;
+                    pns_.unlock_shards(shards_);
+                }
+            }
+
+            [[nodiscard]] std::bitset<num_shards> const& shards() const noexcept
+            {
+                return shards_;
+            }
+
+        private:
+            primary_namespace& pns_;
+            std::bitset<num_shards> shards_;
+            bool owns_lock_ = false;
+        };
+
+        std::array<util::cache_aligned_data_derived<shard_type>, num_shards>
+            shards_;
+
         std::string instance_name_;
         naming::gid_type next_id_;     // next available gid
         naming::gid_type locality_;    // our locality id
-        migration_table_type migrating_objects_;
 
     public:
         // data structure holding all counters for the component_namespace
@@ -238,10 +343,11 @@ namespace hpx::agas::server {
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
         /// Dump the credit counts of all matching ranges. Expects that \p l
         /// is locked.
-        void dump_refcnt_matches(refcnt_table_type::iterator lower_it,
-            refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
-            naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
-            char const* func_name);
+        static void dump_refcnt_matches(refcnt_table_type const& refcnts,
+            refcnt_table_type::const_iterator lower_it,
+            refcnt_table_type::const_iterator upper_it,
+            naming::gid_type const& lower, naming::gid_type const& upper,
+            std::unique_lock<mutex_type>& l, char const* func_name);
 #endif
 
     public:
@@ -332,6 +438,7 @@ namespace hpx::agas::server {
             std::list<free_entry, free_entry_allocator_type>;
 
         void resolve_free_list(std::unique_lock<mutex_type>& l,
+            shard_type& shard,
             std::list<refcnt_table_type::iterator> const& free_list,
             free_entry_list_type& free_entry_list,
             naming::gid_type const& lower, naming::gid_type const& upper,
@@ -24,7 +24,10 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -48,14 +51,22 @@ namespace hpx::agas::server {
         using iterate_names_return_type =
             std::map<std::string, naming::gid_type>;
 
-        using gid_table_type =
-            std::map<std::string, std::shared_ptr<naming::gid_type>>;
+        using gid_table_type = std::unordered_map<std::string,
+            std::shared_ptr<naming::gid_type>>;
 
-        using on_event_data_map_type = std::multimap<std::string, hpx::id_type>;
+        // Ordered index of the registered names, referring to the entries of
+        // the GID table (which are not moved while rehashing). It is used to
+        // answer prefix and pattern queries without scanning all entries.
+        using name_index_type =
+            std::map<std::string_view, gid_table_type::value_type*>;
+
+        using on_event_data_map_type =
+            std::unordered_map<std::string, std::vector<hpx::id_type>>;
 
     private:
         mutex_type mutex_;
         gid_table_type gids_;
+        name_index_type names_;
         std::string instance_name_;
         on_event_data_map_type on_event_data_;
 
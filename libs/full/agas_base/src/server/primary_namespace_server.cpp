@@ -22,6 +22,8 @@
 #include <hpx/util/insert_checked.hpp>
 
 #include <atomic>
+#include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <list>
 #include <memory>
@@ -92,7 +94,8 @@ namespace hpx::agas::server {
         counter_data_.increment_begin_migration_count();
         using hpx::get;
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard_type& shard = shard_for(id);
+        std::unique_lock<mutex_type> l(shard.mutex_);
 
         wait_for_migration_locked(l, id, hpx::throws);
         resolved_type r = resolve_gid_locked_non_local(l, id, hpx::throws);
@@ -107,11 +110,11 @@ namespace hpx::agas::server {
             return std::make_pair(hpx::invalid_id, naming::address());
         }
 
-        auto it = migrating_objects_.find(id);
-        if (it == migrating_objects_.end())
+        auto it = shard.migrating_objects_.find(id);
+        if (it == shard.migrating_objects_.end())
         {
             std::pair<migration_table_type::iterator, bool> const p =
-                migrating_objects_.emplace(std::piecewise_construct,
+                shard.migrating_objects_.emplace(std::piecewise_construct,
                     std::forward_as_tuple(id), std::forward_as_tuple());
             HPX_ASSERT(p.second);
             it = p.first;
@@ -139,12 +142,13 @@ namespace hpx::agas::server {
             counter_data_.end_migration_.enabled_);
         counter_data_.increment_end_migration_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard_type& shard = shard_for(id);
+        std::unique_lock<mutex_type> l(shard.mutex_);
 
         using hpx::get;
 
-        if (auto const it = migrating_objects_.find(id);
-            it != migrating_objects_.end())
+        if (auto const it = shard.migrating_objects_.find(id);
+            it != shard.migrating_objects_.end())
         {
             // flag this id as not being migrated anymore
             get<0>(it->second) = false;
@@ -154,7 +158,7 @@ namespace hpx::agas::server {
             }
             else
             {
-                migrating_objects_.erase(it);
+                shard.migrating_objects_.erase(it);
             }
         }
 
@@ -167,11 +171,15 @@ namespace hpx::agas::server {
         error_code& ec)
     {
         HPX_ASSERT_OWNS_LOCK(l);
+        HPX_ASSERT(l.mutex() == &mutex(id));
 
         using hpx::get;
 
-        if (auto const it = migrating_objects_.find(id);
-            it != migrating_objects_.end())
+        migration_table_type& migrating_objects =
+            shard_for(id).migrating_objects_;
+
+        if (auto const it = migrating_objects.find(id);
+            it != migrating_objects.end())
         {
             if (get<0>(it->second))
             {
@@ -181,19 +189,94 @@ namespace hpx::agas::server {
 
                 if (--get<1>(it->second) == 0)    //-V516
                 {
-                    migrating_objects_.erase(it);
+                    migrating_objects.erase(it);
                 }
             }
             else
             {
                 if (get<1>(it->second) == 0)
                 {
-                    migrating_objects_.erase(it);
+                    migrating_objects.erase(it);
                 }
             }
         }
     }
 
+    // Return the entry of the given GVA table covering the given (stripped)
+    // id, or the end iterator if there is none.
+    inline primary_namespace::gva_table_type::const_iterator find_range(
+        primary_namespace::gva_table_type const& gvas,
+        naming::gid_type const& id)
+    {
+        auto it = gvas.upper_bound(id);
+        if (it == gvas.begin())
+        {
+            return gvas.end();
+        }
+
+        --it;
+        if ((it->first + it->second.first.count) > id)
+        {
+            return it;
+        }
+        return gvas.end();
+    }
+
+    inline bool is_covered(primary_namespace::gva_table_type const& gvas,
+        naming::gid_type const& id)
+    {
+        return find_range(gvas, id) != gvas.end();
+    }
+
+    std::bitset<primary_namespace::num_shards>
+    primary_namespace::spanned_shards(
+        naming::gid_type const& id, std::uint64_t count) noexcept
+    {
+        std::bitset<num_shards> shards;
+
+        std::uint64_t const first = id.get_lsb() >> gid_block_bits;
+        std::uint64_t const last =
+            (id.get_lsb() + (count - 1)) >> gid_block_bits;
+
+        // ranges wrapping around the LSB are rejected by bind_gid, lock all
+        // shards in this case
+        if (last < first || last - first >= num_shards - 1)
+        {
+            shards.set();
+            return shards;
+        }
+
+        for (std::uint64_t block = first; block <= last; ++block)
+        {
+            shards.set(shard_index(
+                naming::gid_type(id.get_msb(), block << gid_block_bits)));
+        }
+        return shards;
+    }
+
+    void primary_namespace::lock_shards(std::bitset<num_shards> const& shards)
+    {
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            if (shards.test(i))
+            {
+                shards_[i].mutex_.lock();
+            }
+        }
+    }
+
+    void primary_namespace::unlock_shards(
+        std::bitset<num_shards> const& shards) noexcept
+    {
+        for (std::size_t i = num_shards; i != 0; --i)
+        {
+            if (shards.test(i - 1))
+            {
+                shards_[i - 1].mutex_.unlock();
+            }
+        }
+    }
+
     bool primary_namespace::bind_gid(
         gva const& g, naming::gid_type id, naming::gid_type const& locality)
     {    // {{{ bind_gid implementation
@@ -205,124 +288,129 @@ namespace hpx::agas::server {
         naming::gid_type const gid = id;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        // ranges crossing a block boundary are stored in a separate table
+        bool const spanning =
+            g.count > 1 && !same_block(id, id + (g.count - 1));
 
-        auto const begin = gvas_.begin();
-        auto const end = gvas_.end();
+        shard_type& shard = shard_for(id);
 
-        if (auto it = gvas_.lower_bound(id); it != end)
+        // a range crossing a block boundary is stored in all shards its
+        // blocks belong to, all of those need to be locked
+        std::bitset<num_shards> locked;
+        if (spanning)
         {
-            // If we got an exact match, this is a request to update an existing
-            // binding (e.g. move semantics).
-            if (it->first == id)
-            {
-                // non-migratable gids can't be rebound
-                if (naming::refers_to_local_lva(gid) &&
-                    !naming::refers_to_virtual_memory(gid))
-                {
-                    l.unlock();
-
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "cannot rebind gids for non-migratable objects");
-                }
+            locked = spanned_shards(id, g.count);
+        }
+        else
+        {
+            locked.set(shard_index(id));
+        }
+        shards_lock l(*this, locked);
 
-                gva& gaddr = it->second.first;
-                naming::gid_type& loc = it->second.second;
+        gva_table_type& gvas = spanning ? shard.spanning_gvas_ : shard.gvas_;
 
-                // Check for count mismatch (we can't change block sizes of
-                // existing bindings).
-                if (HPX_UNLIKELY(gaddr.count != g.count))
-                {
-                    // REVIEW: Is this the right error code to use?
-                    l.unlock();
+        // If we got an exact match, this is a request to update an existing
+        // binding (e.g. move semantics).
+        if (auto const it = gvas.find(id); it != gvas.end())
+        {
+            // non-migratable gids can't be rebound
+            if (naming::refers_to_local_lva(gid) &&
+                !naming::refers_to_virtual_memory(gid))
+            {
+                l.unlock();
 
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "cannot change block size of existing binding");
-                }
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "primary_namespace::bind_gid",
+                    "cannot rebind gids for non-migratable objects");
+            }
 
-                if (HPX_UNLIKELY(
-                        to_int(hpx::components::component_enum_type::invalid) ==
-                        g.type))
-                {
-                    l.unlock();
+            gva& gaddr = it->second.first;
+            naming::gid_type& loc = it->second.second;
 
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "attempt to update a GVA with an invalid type, "
-                        "gid({1}), gva({2}), locality({3})",
-                        id, g, locality);
-                }
+            // Check for count mismatch (we can't change block sizes of
+            // existing bindings).
+            if (HPX_UNLIKELY(gaddr.count != g.count))
+            {
+                // REVIEW: Is this the right error code to use?
+                l.unlock();
 
-                if (HPX_UNLIKELY(!locality))
-                {
-                    l.unlock();
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "primary_namespace::bind_gid",
+                    "cannot change block size of existing binding");
+            }
 
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "attempt to update a GVA with an invalid "
-                        "locality id, "
-                        "gid({1}), gva({2}), locality({3})",
-                        id, g, locality);
-                }
+            if (HPX_UNLIKELY(
+                    to_int(hpx::components::component_enum_type::invalid) ==
+                    g.type))
+            {
+                l.unlock();
 
-                // Store the new endpoint and offset
-                gaddr.prefix = g.prefix;
-                gaddr.type = g.type;
-                gaddr.lva(g.lva());
-                gaddr.offset = g.offset;
-                loc = locality;
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "primary_namespace::bind_gid",
+                    "attempt to update a GVA with an invalid type, "
+                    "gid({1}), gva({2}), locality({3})",
+                    id, g, locality);
+            }
 
+            if (HPX_UNLIKELY(!locality))
+            {
                 l.unlock();
 
-                LAGAS_(info).format(
-                    "primary_namespace::bind_gid, gid({1}), gva({2}), "
-                    "locality({3}), response(repeated_request)",
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "primary_namespace::bind_gid",
+                    "attempt to update a GVA with an invalid "
+                    "locality id, "
+                    "gid({1}), gva({2}), locality({3})",
                     id, g, locality);
-
-                return false;
             }
 
-            // We're about to decrement the iterator it - first, we
-            // check that it's safe to do this.
-            else if (it != begin)
-            {
-                --it;
+            // Store the new endpoint and offset
+            gaddr.prefix = g.prefix;
+            gaddr.type = g.type;
+            gaddr.lva(g.lva());
+            gaddr.offset = g.offset;
+            loc = locality;
 
-                // Check that a previous range doesn't cover the new id.
-                if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
+            // update the copies of the entry stored in the other shards
+            if (spanning)
+            {
+                for (std::size_t i = 0; i != num_shards; ++i)
                 {
-                    // REVIEW: Is this the right error code to use?
-                    l.unlock();
-
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "the new GID is contained in an existing range");
+                    if (locked.test(i) && &shards_[i] != &shard)
+                    {
+                        shards_[i].spanning_gvas_[id] = it->second;
+                    }
                 }
             }
+
+            l.unlock();
+
+            LAGAS_(info).format(
+                "primary_namespace::bind_gid, gid({1}), gva({2}), "
+                "locality({3}), response(repeated_request)",
+                id, g, locality);
+
+            return false;
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
+        // Check that a previous range doesn't cover the new id.
+        if (HPX_UNLIKELY(is_covered(shard.gvas_, id) ||
+                is_covered(shard.spanning_gvas_, id)))
         {
-            --it;
-
-            // Check that a previous range doesn't cover the new id.
-            if ((it->first + it->second.first.count) > id)
-            {
-                // REVIEW: Is this the right error code to use?
-                l.unlock();
+            // REVIEW: Is this the right error code to use?
+            l.unlock();
 
-                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                    "primary_namespace::bind_gid",
-                    "the new GID is contained in an existing range");
-            }
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "primary_namespace::bind_gid",
+                "the new GID is contained in an existing range");
         }
 
         // non-migratable gids don't need to be bound
         if (naming::refers_to_local_lva(gid) &&
             !naming::refers_to_virtual_memory(gid))
         {
+            l.unlock();
+
             LAGAS_(info).format(
                 "primary_namespace::bind_gid, gid({1}), gva({2}), "
                 "locality({3})",
@@ -355,17 +443,28 @@ namespace hpx::agas::server {
                 id, g, locality);
         }
 
-        // Insert a GID -> GVA entry into the GVA table.
-        if (HPX_UNLIKELY(!util::insert_checked(
-                gvas_.emplace(id, std::make_pair(g, locality)))))
+        // Insert a GID -> GVA entry into the GVA table (of all affected
+        // shards).
+        for (std::size_t i = 0; i != num_shards; ++i)
         {
-            l.unlock();
+            if (!locked.test(i))
+            {
+                continue;
+            }
 
-            HPX_THROW_EXCEPTION(hpx::error::lock_error,
-                "primary_namespace::bind_gid",
-                "GVA table insertion failed due to a locking error or "
-                "memory corruption, gid({1}), gva({2}), locality({3})",
-                id, g, locality);
+            gva_table_type& table =
+                spanning ? shards_[i].spanning_gvas_ : shards_[i].gvas_;
+            if (HPX_UNLIKELY(!util::insert_checked(
+                    table.emplace(id, std::make_pair(g, locality)))))
+            {
+                l.unlock();
+
+                HPX_THROW_EXCEPTION(hpx::error::lock_error,
+                    "primary_namespace::bind_gid",
+                    "GVA table insertion failed due to a locking error or "
+                    "memory corruption, gid({1}), gva({2}), locality({3})",
+                    id, g, locality);
+            }
         }
 
         l.unlock();
@@ -407,7 +506,7 @@ namespace hpx::agas::server {
         }
         else
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            std::unique_lock<mutex_type> l(mutex(id));
 
             // wait for any migration to be completed
             if (naming::detail::is_migratable(id))
@@ -453,10 +552,27 @@ namespace hpx::agas::server {
 
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard_type& shard = shard_for(id);
+
+        std::bitset<num_shards> locked;
+        locked.set(shard_index(id));
+        shards_lock l(*this, locked);
+
+        gva_table_type* gvas = &shard.gvas_;
+        auto it = gvas->find(id);
+        if (it == gvas->end() && count > 1 &&
+            shard.spanning_gvas_.find(id) != shard.spanning_gvas_.end())
+        {
+            // the range is stored in all shards its blocks belong to, the
+            // entry has to be looked up again after all of those have been
+            // locked
+            l.lock(spanned_shards(id, count));
+
+            gvas = &shard.spanning_gvas_;
+            it = gvas->find(id);
+        }
 
-        auto const it = gvas_.find(id);
-        if (auto const end = gvas_.end(); it != end)
+        if (it != gvas->end())
         {
             if (HPX_UNLIKELY(it->second.first.count != count))
             {
@@ -468,7 +584,20 @@ namespace hpx::agas::server {
 
             gva_table_data_type const data = it->second;
 
-            gvas_.erase(it);
+            if (gvas == &shard.spanning_gvas_)
+            {
+                for (std::size_t i = 0; i != num_shards; ++i)
+                {
+                    if (l.shards().test(i))
+                    {
+                        shards_[i].spanning_gvas_.erase(id);
+                    }
+                }
+            }
+            else
+            {
+                gvas->erase(it);
+            }
 
             l.unlock();
             LAGAS_(info).format(
@@ -480,6 +609,8 @@ namespace hpx::agas::server {
             return {g.prefix, g.type, g.lva()};
         }
 
+        l.unlock();
+
         // non-migratable gids are not bound
         if (naming::refers_to_local_lva(id) &&
             !naming::refers_to_virtual_memory(id))
@@ -498,8 +629,6 @@ namespace hpx::agas::server {
             return {g.prefix, g.type, g.lva()};
         }
 
-        l.unlock();
-
         LAGAS_(info).format(
             "primary_namespace::unbind_gid, gid({1}), count({2}), "
             "response(no_success)",
@@ -548,15 +677,15 @@ namespace hpx::agas::server {
 
         for (auto& req : requests)
         {
+            // the upper bound of the requested range is inclusive
             std::int64_t credits = hpx::get<0>(req);
             naming::gid_type lower = hpx::get<1>(req);
-            naming::gid_type upper = hpx::get<1>(req);
+            naming::gid_type upper = hpx::get<2>(req);
 
             naming::detail::strip_internal_bits_from_gid(lower);
             naming::detail::strip_internal_bits_from_gid(upper);
 
-            if (lower == upper)
-                ++upper;
+            ++upper;
 
             // Decrement.
             if (credits < 0)
@@ -641,15 +770,16 @@ namespace hpx::agas::server {
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void primary_namespace::dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it,
-        refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
-        naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
-        char const* func_name)
+        refcnt_table_type const& refcnts,
+        refcnt_table_type::const_iterator lower_it,
+        refcnt_table_type::const_iterator upper_it,
+        naming::gid_type const& lower, naming::gid_type const& upper,
+        std::unique_lock<mutex_type>& l, char const* func_name)
     {
         // dump_refcnt_matches implementation
         HPX_ASSERT(l.owns_lock());
 
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
+        if (lower_it == refcnts.end() && upper_it == refcnts.end())
             // We got nothing, bail - our caller is probably about to throw.
             return;
 
@@ -676,30 +806,6 @@ namespace hpx::agas::server {
         naming::gid_type const& upper, std::int64_t const& credits,
         error_code& ec)
     {    // {{{ increment implementation
-        std::unique_lock<mutex_type> l(mutex_);
-
-#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        if (LAGAS_ENABLED(debug))
-        {
-            typedef refcnt_table_type::iterator iterator;
-
-            // Find the mappings that we're about to touch.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
-            {
-                upper_it = lower_it;
-                ++upper_it;
-            }
-
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::increment");
-        }
-#endif
 
         // TODO: Whine loudly if a reference count overflows. We reserve ~0 for
         // internal bookkeeping in the decrement algorithm, so the maximum global
@@ -711,39 +817,66 @@ namespace hpx::agas::server {
         // allocate/bind them, so if a GID is not in the refcnt table, we know that
         // it's global reference count is the initial global reference count.
 
-        for (naming::gid_type raw = lower; raw != upper; ++raw)
+        // The key space is processed block by block, each of which is
+        // protected by the lock of its shard.
+        for (naming::gid_type raw = lower; raw != upper; /**/)
         {
-            auto it = refcnts_.find(raw);
-            if (it == refcnts_.end())
+            shard_type& shard = shard_for(raw);
+            refcnt_table_type& refcnts = shard.refcnts_;
+
+            naming::gid_type const block_begin = raw;
+
+            std::unique_lock<mutex_type> l(shard.mutex_);
+
+#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
+            if (LAGAS_ENABLED(debug))
             {
-                std::int64_t count =
-                    static_cast<std::int64_t>(HPX_GLOBALCREDIT_INITIAL) +
-                    credits;
+                // Find the mappings that we're about to touch.
+                auto const lower_it = refcnts.lower_bound(raw);
+                auto const upper_it = refcnts.lower_bound(upper);
 
-                std::pair<refcnt_table_type::iterator, bool> const p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
-                if (!p.second)
+                dump_refcnt_matches(refcnts, lower_it, upper_it, lower, upper,
+                    l, "primary_namespace::increment");
+            }
+#endif
+
+            do
+            {
+                auto it = refcnts.find(raw);
+                if (it == refcnts.end())
                 {
-                    l.unlock();
+                    std::int64_t count =
+                        static_cast<std::int64_t>(HPX_GLOBALCREDIT_INITIAL) +
+                        credits;
 
-                    HPX_THROWS_IF(ec, hpx::error::invalid_data,
-                        "primary_namespace::increment",
-                        "couldn't create entry in reference count table, "
-                        "raw({1}), ref-count({2})",
-                        raw, count);
-                    return;
+                    std::pair<refcnt_table_type::iterator, bool> const p =
+                        refcnts.insert(
+                            refcnt_table_type::value_type(raw, count));
+                    if (!p.second)
+                    {
+                        l.unlock();
+
+                        HPX_THROWS_IF(ec, hpx::error::invalid_data,
+                            "primary_namespace::increment",
+                            "couldn't create entry in reference count table, "
+                            "raw({1}), ref-count({2})",
+                            raw, count);
+                        return;
+                    }
+
+                    it = p.first;
+                }
+                else
+                {
+                    it->second += credits;
                 }
 
-                it = p.first;
-            }
-            else
-            {
-                it->second += credits;
-            }
+                LAGAS_(info).format(
+                    "primary_namespace::increment, raw({1}), refcnt({2})",
+                    lower, it->second);
 
-            LAGAS_(info).format(
-                "primary_namespace::increment, raw({1}), refcnt({2})", lower,
-                it->second);
+                ++raw;
+            } while (raw != upper && same_block(block_begin, raw));
         }
 
         if (&ec != &throws)
@@ -752,12 +885,14 @@ namespace hpx::agas::server {
 
     ///////////////////////////////////////////////////////////////////////////////
     void primary_namespace::resolve_free_list(std::unique_lock<mutex_type>& l,
+        shard_type& shard,
         std::list<refcnt_table_type::iterator> const& free_list,
         free_entry_list_type& free_entry_list,
         naming::gid_type const& /* lower */,
         naming::gid_type const& /* upper */, error_code& ec)
     {
         HPX_ASSERT_OWNS_LOCK(l);
+        HPX_ASSERT(l.mutex() == &shard.mutex_);
 
         using hpx::get;
 
@@ -836,7 +971,7 @@ namespace hpx::agas::server {
             free_entry_list.emplace_back(resolved, gid, get<2>(r));
 
             // remove this entry from the refcnt table
-            refcnts_.erase(it);
+            shard.refcnts_.erase(it);
         }
     }
 
@@ -852,46 +987,43 @@ namespace hpx::agas::server {
 
         free_entry_list.clear();
 
+        ///////////////////////////////////////////////////////////////////////
+        // Apply the decrement across the entire key space (e.g. [lower, upper]).
+
+        // The third parameter we pass here is the default data to use in case
+        // the key is not mapped. We don't insert GIDs into the refcnt table
+        // when we allocate/bind them, so if a GID is not in the refcnt table,
+        // we know that it's global reference count is the initial global
+        // reference count.
+
+        // The key space is processed block by block, each of which is
+        // protected by the lock of its shard.
+        for (naming::gid_type raw = lower; raw != upper; /**/)
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            shard_type& shard = shard_for(raw);
+            refcnt_table_type& refcnts = shard.refcnts_;
+
+            naming::gid_type const block_begin = raw;
+
+            std::unique_lock<mutex_type> l(shard.mutex_);
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
             if (LAGAS_ENABLED(debug))
             {
-                typedef refcnt_table_type::iterator iterator;
-
-                // Find the mappings that we just added or modified.
-                refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-                refcnt_table_type::iterator upper_it;
-                if (lower != upper)
-                {
-                    upper_it = refcnts_.find(upper);
-                }
-                else
-                {
-                    upper_it = lower_it;
-                    ++upper_it;
-                }
+                // Find the mappings that we're about to touch.
+                auto const lower_it = refcnts.lower_bound(raw);
+                auto const upper_it = refcnts.lower_bound(upper);
 
-                dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                    "primary_namespace::decrement_sweep");
+                dump_refcnt_matches(refcnts, lower_it, upper_it, lower, upper,
+                    l, "primary_namespace::decrement_sweep");
             }
 #endif
 
-            ///////////////////////////////////////////////////////////////////////
-            // Apply the decrement across the entire key space (e.g. [lower, upper]).
-
-            // The third parameter we pass here is the default data to use in case
-            // the key is not mapped. We don't insert GIDs into the refcnt table
-            // when we allocate/bind them, so if a GID is not in the refcnt table,
-            // we know that it's global reference count is the initial global
-            // reference count.
-
             std::list<refcnt_table_type::iterator> free_list;    //-V826
-            for (naming::gid_type raw = lower; raw != upper; ++raw)
+            do
             {
-                auto it = refcnts_.find(raw);
-                if (it == refcnts_.end())
+                auto it = refcnts.find(raw);
+                if (it == refcnts.end())
                 {
                     if (credits >
                         static_cast<std::int64_t>(HPX_GLOBALCREDIT_INITIAL))
@@ -914,7 +1046,7 @@ namespace hpx::agas::server {
                         credits;
 
                     std::pair<refcnt_table_type::iterator, bool> const p =
-                        refcnts_.emplace(raw, count);
+                        refcnts.emplace(raw, count);
                     if (!p.second)
                     {
                         l.unlock();
@@ -950,10 +1082,15 @@ namespace hpx::agas::server {
                 // this objects needs to be deleted
                 if (it->second == 0)
                     free_list.push_back(it);
-            }
+
+                ++raw;
+            } while (raw != upper && same_block(block_begin, raw));
 
             // Resolve the objects which have to be deleted.
-            resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+            resolve_free_list(
+                l, shard, free_list, free_entry_list, lower, upper, ec);
+            if (ec)
+                return;
 
         }    // Unlock the mutex.
 
@@ -1049,75 +1186,39 @@ namespace hpx::agas::server {
         naming::gid_type id = gid;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        gva_table_type::const_iterator it = gvas_.lower_bound(id);
-        gva_table_type::const_iterator const begin = gvas_.begin();
+        HPX_ASSERT(l.mutex() == &mutex(id));
 
-        if (gva_table_type::const_iterator const end = gvas_.end(); it != end)
-        {
-            // Check for exact match
-            if (it->first == id)
-            {
-                if (&ec != &throws)
-                    ec = make_success_code();
-
-                gva_table_data_type const& data = it->second;
-                return resolved_type(it->first, data.first, data.second);
-            }
-
-            // We need to decrement the iterator, first we check that it's safe
-            // to do this.
-            if (it != begin)
-            {
-                --it;
-
-                // Found the GID in a range
-                gva_table_data_type const& data = it->second;
-                if ((it->first + data.first.count) > id)
-                {
-                    if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-                    {
-                        l.unlock();
-
-                        HPX_THROWS_IF(ec, hpx::error::internal_server_error,
-                            "primary_namespace::resolve_gid_locked",
-                            "MSBs of lower and upper range bound do not "
-                            "match");
-                        return resolved_type(
-                            naming::invalid_gid, gva(), naming::invalid_gid);
-                    }
+        // Find the range covering the given id, ranges crossing a block
+        // boundary are looked up in a separate table of the same shard.
+        shard_type& shard = shard_for(id);
 
-                    if (&ec != &throws)
-                        ec = make_success_code();
-
-                    return resolved_type(it->first, data.first, data.second);
-                }
-            }
+        gva_table_type const* gvas = &shard.gvas_;
+        gva_table_type::const_iterator it = find_range(*gvas, id);
+        if (it == gvas->end())
+        {
+            gvas = &shard.spanning_gvas_;
+            it = find_range(*gvas, id);
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
+        if (it != gvas->end())
         {
-            --it;
-
             // Found the GID in a range
-            gva_table_data_type const& data = it->second;
-            if ((it->first + data.first.count) > id)
+            if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
             {
-                if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-                {
-                    l.unlock();
+                l.unlock();
 
-                    HPX_THROWS_IF(ec, hpx::error::internal_server_error,
-                        "primary_namespace::resolve_gid_locked",
-                        "MSBs of lower and upper range bound do not match");
-                    return resolved_type(
-                        naming::invalid_gid, gva(), naming::invalid_gid);
-                }
+                HPX_THROWS_IF(ec, hpx::error::internal_server_error,
+                    "primary_namespace::resolve_gid_locked",
+                    "MSBs of lower and upper range bound do not match");
+                return resolved_type(
+                    naming::invalid_gid, gva(), naming::invalid_gid);
+            }
 
-                if (&ec != &throws)
-                    ec = make_success_code();
+            if (&ec != &throws)
+                ec = make_success_code();
 
-                return resolved_type(it->first, data.first, data.second);
-            }
+            gva_table_data_type const& data = it->second;
+            return resolved_type(it->first, data.first, data.second);
         }
 
         if (&ec != &throws)
@@ -19,6 +19,7 @@
 #include <hpx/util/insert_checked.hpp>
 #include <hpx/util/regex_from_pattern.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <map>
@@ -26,6 +27,7 @@
 #include <mutex>
 #include <regex>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -135,8 +137,11 @@ namespace hpx::agas::server {
             return false;
         }
 
-        if (HPX_UNLIKELY(!util::insert_checked(
-                gids_.emplace(key, std::make_shared<naming::gid_type>(gid)))))
+        auto const p =
+            gids_.emplace(key, std::make_shared<naming::gid_type>(gid));
+        if (HPX_UNLIKELY(!util::insert_checked(p) ||
+                !util::insert_checked(names_.emplace(
+                    std::string_view(p.first->first), &*p.first))))
         {
             l.unlock();
 
@@ -147,19 +152,11 @@ namespace hpx::agas::server {
         }
 
         // handle registered events
-        if (auto const [first, last] = on_event_data_.equal_range(key);
-            first != last)
+        if (auto const events = on_event_data_.find(key);
+            events != on_event_data_.end())
         {
-            std::vector<hpx::id_type> lcos;
-
-            auto iter = first;
-            while (iter != last)
-            {
-                lcos.push_back(iter->second);
-                ++iter;
-            }
-
-            on_event_data_.erase(first, last);
+            std::vector<hpx::id_type> lcos = HPX_MOVE(events->second);
+            on_event_data_.erase(events);
 
             // notify all LCOS which were registered with this name
             for (hpx::id_type const& id : lcos)
@@ -266,6 +263,7 @@ namespace hpx::agas::server {
 
         naming::gid_type gid = *(it->second);
 
+        names_.erase(std::string_view(it->first));
         gids_.erase(it);
 
         l.unlock();
@@ -285,44 +283,69 @@ namespace hpx::agas::server {
             counter_data_.iterate_names_.enabled_);
         counter_data_.increment_iterate_names_count();
 
-        std::map<std::string, naming::gid_type> found;
+        // collect the matching entries while holding the lock, split their
+        // credits afterwards
+        std::vector<std::pair<std::string, std::shared_ptr<naming::gid_type>>>
+            matches;
 
-        if (pattern.find_first_of("*?[]") != std::string::npos)
+        if (std::string::size_type const wildcard =
+                pattern.find_first_of("*?[]");
+            wildcard != std::string::npos)
         {
-            std::string const str_rx(util::regex_from_pattern(pattern, throws));
-            std::regex const rx(str_rx);
-
-            std::unique_lock<mutex_type> l(mutex_);
-            for (auto& gid : gids_)
+            // only the names starting with the literal prefix of the pattern
+            // can match, the prefix ends before the first escaped character
+            std::string::size_type const prefix_size =
+                (std::min)(pattern.find('\\'), wildcard);
+            std::string_view const prefix(pattern.data(), prefix_size);
+
+            // patterns of the form 'prefix*' match all of these names
+            bool const match_all = prefix_size == wildcard &&
+                wildcard + 1 == pattern.size() && pattern[wildcard] == '*';
+
+            std::regex rx;
+            if (!match_all)
             {
-                if (!std::regex_match(gid.first, rx))
-                    continue;
-
-                // hold on to entry while map is unlocked
-                std::shared_ptr<naming::gid_type> current_gid(gid.second);
-                unlock_guard<std::unique_lock<mutex_type>> ul(l);
+                rx = std::regex(util::regex_from_pattern(pattern, throws));
+            }
 
-                found[gid.first] = naming::detail::split_gid_if_needed(
-                    hpx::launch::sync, *current_gid);
+            std::lock_guard<mutex_type> l(mutex_);
+            for (auto it = names_.lower_bound(prefix); it != names_.end() &&
+                 it->first.substr(0, prefix.size()) == prefix;
+                 ++it)
+            {
+                if (match_all || std::regex_match(it->second->first, rx))
+                {
+                    matches.emplace_back(
+                        it->second->first, it->second->second);
+                }
+            }
+        }
+        else if (!pattern.empty())
+        {
+            std::lock_guard<mutex_type> l(mutex_);
+            if (auto const it = gids_.find(pattern); it != gids_.end())
+            {
+                matches.emplace_back(it->first, it->second);
             }
         }
         else
         {
-            std::unique_lock<mutex_type> l(mutex_);
-            for (auto& gid : gids_)
+            std::lock_guard<mutex_type> l(mutex_);
+            matches.reserve(gids_.size());
+            for (auto const& gid : gids_)
             {
-                if (!pattern.empty() && pattern != gid.first)
-                    continue;
-
-                // hold on to entry while map is unlocked
-                std::shared_ptr<naming::gid_type> current_gid(gid.second);
-                unlock_guard<std::unique_lock<mutex_type>> ul(l);
-
-                found[gid.first] = naming::detail::split_gid_if_needed(
-                    hpx::launch::sync, *current_gid);
+                matches.emplace_back(gid.first, gid.second);
             }
         }
 
+        std::map<std::string, naming::gid_type> found;
+        for (auto& [name, current_gid] : matches)
+        {
+            found.emplace(HPX_MOVE(name),
+                naming::detail::split_gid_if_needed(
+                    hpx::launch::sync, *current_gid));
+        }
+
         LAGAS_(info).format("symbol_namespace::iterate");
 
         return found;
@@ -371,11 +394,7 @@ namespace hpx::agas::server {
 
         if (!handled)
         {
-            [[maybe_unused]] auto const it = on_event_data_.emplace(name, lco);
-
-            // This overload of insert always returns the iterator pointing
-            // to the inserted value. It should never point to end
-            HPX_ASSERT_LOCKED(l, it != on_event_data_.end());
+            on_event_data_[name].push_back(lco);
         }
 
         l.unlock();
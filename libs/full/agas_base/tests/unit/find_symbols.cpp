@@ -0,0 +1,101 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the symbol namespace finds all names matching a pattern, in
+// particular for names sharing the literal prefix of the pattern.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::string> const names = {
+    "/find_symbols/a/x",
+    "/find_symbols/a/y",
+    "/find_symbols/a/xy",
+    "/find_symbols/ab/x",
+    "/find_symbols/b/x",
+    "/find_symbols/a.b",
+    "/find_symbols/a\\b",
+};
+
+std::set<std::string> find(std::string const& pattern)
+{
+    std::set<std::string> result;
+    for (auto const& e : hpx::agas::find_symbols(hpx::launch::sync, pattern))
+    {
+        HPX_TEST_EQ(e.second, hpx::find_here());
+        result.insert(e.first);
+    }
+    return result;
+}
+
+void check(std::string const& pattern, std::set<std::string> const& expected)
+{
+    std::set<std::string> const found = find(pattern);
+    HPX_TEST_EQ_MSG(found.size(), expected.size(), pattern.c_str());
+    HPX_TEST_MSG(found == expected, pattern.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    for (std::string const& name : names)
+    {
+        HPX_TEST(hpx::agas::register_name(
+            hpx::launch::sync, name, hpx::find_here()));
+    }
+
+    // patterns of the form 'prefix*'
+    check("/find_symbols/a/*",
+        {"/find_symbols/a/x", "/find_symbols/a/y", "/find_symbols/a/xy"});
+    check("/find_symbols/a*",
+        {"/find_symbols/a/x", "/find_symbols/a/y", "/find_symbols/a/xy",
+            "/find_symbols/ab/x", "/find_symbols/a.b", "/find_symbols/a\\b"});
+    check("/find_symbols/*", std::set<std::string>(names.begin(), names.end()));
+    check("/find_symbols/c*", {});
+
+    // wildcards in the middle of the pattern
+    check("/find_symbols/*/x",
+        {"/find_symbols/a/x", "/find_symbols/ab/x", "/find_symbols/b/x"});
+    check("/find_symbols/a/?", {"/find_symbols/a/x", "/find_symbols/a/y"});
+    check("/find_symbols/a/x?", {"/find_symbols/a/xy"});
+    check("/find_symbols/?/x", {"/find_symbols/a/x", "/find_symbols/b/x"});
+    check("/find_symbols/[ab]/x", {"/find_symbols/a/x", "/find_symbols/b/x"});
+    check("/find_symbols/a[!/]/x", {"/find_symbols/ab/x"});
+    check("/find_symbols/a?b", {"/find_symbols/a.b", "/find_symbols/a\\b"});
+
+    // names without wildcards are looked up exactly, the regex special
+    // characters and backslashes of the name are not interpreted
+    check("/find_symbols/a/x", {"/find_symbols/a/x"});
+    check("/find_symbols/a", {});
+    check("/find_symbols/a.b", {"/find_symbols/a.b"});
+    check("/find_symbols/a\\b", {"/find_symbols/a\\b"});
+
+    // the index doesn't report names which have been unregistered
+    HPX_TEST_EQ(hpx::agas::unregister_name(
+                    hpx::launch::sync, "/find_symbols/a/y"),
+        hpx::find_here());
+    check("/find_symbols/a/*", {"/find_symbols/a/x", "/find_symbols/a/xy"});
+    check("/find_symbols/a/?", {"/find_symbols/a/x"});
+
+    for (std::string const& name : names)
+    {
+        hpx::agas::unregister_name(hpx::launch::sync, name);
+    }
+    check("/find_symbols/*", {});
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,132 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that destroying local components releases the lock of the primary
+// namespace shard their ids belong to, thus destroying a second component
+// whose id falls into the same shard does not block.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/agas_base/server/primary_namespace.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> destroyed(0);
+
+struct test_server : hpx::components::component_base<test_server>
+{
+    ~test_server()
+    {
+        ++destroyed;
+    }
+
+    hpx::id_type call() const
+    {
+        return hpx::find_here();
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call)
+};
+
+using server_type = hpx::components::component<test_server>;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+using call_action = test_server::call_action;
+HPX_REGISTER_ACTION(call_action)
+
+constexpr std::size_t num_objects =
+    2 * hpx::agas::server::primary_namespace::num_shards;
+
+///////////////////////////////////////////////////////////////////////////////
+// mirrors the assignment of GIDs to the shards of the primary namespace
+std::size_t shard_index(hpx::id_type const& id)
+{
+    using primary_namespace = hpx::agas::server::primary_namespace;
+
+    hpx::naming::gid_type const gid =
+        hpx::naming::detail::get_stripped_gid(id.get_gid());
+    return static_cast<std::size_t>(
+        ((gid.get_lsb() >> primary_namespace::gid_block_bits) ^
+            gid.get_msb()) %
+        primary_namespace::num_shards);
+}
+
+void wait_for_destroyed(std::size_t expected)
+{
+    auto const deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (destroyed.load() < expected &&
+        std::chrono::steady_clock::now() < deadline)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    HPX_TEST_EQ(destroyed.load(), expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<hpx::id_type> ids;
+    ids.reserve(num_objects);
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        ids.push_back(hpx::new_<test_server>(hpx::find_here()).get());
+    }
+
+    // there are more objects than shards, find two of them sharing a shard
+    std::map<std::size_t, std::size_t> first_in_shard;
+    std::pair<std::size_t, std::size_t> same_shard(0, 0);
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        auto const p = first_in_shard.emplace(shard_index(ids[i]), i);
+        if (!p.second)
+        {
+            same_shard = std::make_pair(p.first->second, i);
+            break;
+        }
+    }
+    HPX_TEST_NEQ(same_shard.first, same_shard.second);
+
+    hpx::id_type first = ids[same_shard.first];
+    hpx::id_type second = ids[same_shard.second];
+    ids.erase(ids.begin() + same_shard.second);
+    ids.erase(ids.begin() + same_shard.first);
+
+    HPX_TEST_EQ(hpx::async<call_action>(first).get(), hpx::find_here());
+    HPX_TEST_EQ(hpx::async<call_action>(second).get(), hpx::find_here());
+
+    // destroy both objects, one after the other
+    first = hpx::invalid_id;
+    wait_for_destroyed(1);
+
+    second = hpx::invalid_id;
+    wait_for_destroyed(2);
+
+    // the remaining objects are still accessible and can be destroyed
+    for (hpx::id_type const& id : ids)
+    {
+        HPX_TEST_EQ(hpx::async<call_action>(id).get(), hpx::find_here());
+    }
+
+    ids.clear();
+    wait_for_destroyed(num_objects);
+
+    return hpx::util::report_errors();
+}
+#endif
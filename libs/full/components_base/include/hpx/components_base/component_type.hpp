@@ -166,6 +166,11 @@ namespace hpx::components {
         hpx::naming::gid_type const&, hpx::naming::address const&);
     HPX_EXPORT component_deleter_type& deleter(component_type type);
 
+    // whether other localities may derive the address of the instances of
+    // the given component type from their ids (see
+    // traits::component_supports_direct_addressing)
+    HPX_EXPORT bool& supports_direct_addressing(component_type type);
+
     HPX_EXPORT bool enumerate_instance_counts(
         hpx::move_only_function<bool(component_type)> const& f);
 
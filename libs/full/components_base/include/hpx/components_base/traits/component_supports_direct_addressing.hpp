@@ -0,0 +1,60 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/type_support/detail/wrap_int.hpp>
+
+namespace hpx::traits {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Customization point for component capabilities
+    //
+    // The ids of non-migratable components encode the local address of the
+    // referenced object. Components supporting direct addressing allow other
+    // localities to derive the address of their instances from those ids
+    // instead of resolving them through AGAS. Note that the global reference
+    // count of such an id is still maintained by the owning locality, as it
+    // controls the lifetime of the referenced object.
+    namespace detail {
+
+        struct supports_direct_addressing_helper
+        {
+            // by default, we return 'false' (ids of the component are
+            // resolved through AGAS on other localities)
+            template <typename Component>
+            static constexpr bool call(wrap_int) noexcept
+            {
+                return false;
+            }
+
+            // forward the call if the component implements the function
+            template <typename Component>
+            static constexpr auto call(int) noexcept
+                -> decltype(Component::supports_direct_addressing())
+            {
+                return Component::supports_direct_addressing();
+            }
+        };
+
+        template <typename Component>
+        constexpr bool call_supports_direct_addressing() noexcept
+        {
+            return supports_direct_addressing_helper::template call<Component>(
+                0);
+        }
+    }    // namespace detail
+
+    template <typename Component, typename Enable = void>
+    struct component_supports_direct_addressing
+    {
+        // returns whether the ids of the component may be resolved directly
+        static constexpr bool call() noexcept
+        {
+            return detail::call_supports_direct_addressing<Component>();
+        }
+    };
+}    // namespace hpx::traits
@@ -31,6 +31,7 @@ namespace hpx::components {
             {
                 component_entry() noexcept
                   : enabled_(false)
+                  , supports_direct_addressing_(false)
                   , instance_count_(0)
                   , deleter_(nullptr)
                 {
@@ -41,6 +42,7 @@ namespace hpx::components {
                 // saves us a dynamic allocation
                 component_entry(component_entry&&) noexcept
                   : enabled_(false)
+                  , supports_direct_addressing_(false)
                   , instance_count_(0)
                   , deleter_(nullptr)
                 {
@@ -49,6 +51,7 @@ namespace hpx::components {
                 component_entry& operator=(component_entry&&) noexcept = delete;
 
                 bool enabled_;
+                bool supports_direct_addressing_;
                 util::atomic_count instance_count_;
                 component_deleter_type deleter_;
             };
@@ -125,6 +128,12 @@ namespace hpx::components {
         return detail::component_database::get_entry(type).deleter_;
     }
 
+    bool& supports_direct_addressing(component_type type)
+    {
+        return detail::component_database::get_entry(type)
+            .supports_direct_addressing_;
+    }
+
     bool enumerate_instance_counts(
         hpx::move_only_function<bool(component_type)> const& f)
     {
@@ -449,6 +449,13 @@ namespace hpx::naming {
         return !(gid.get_msb() & gid_type::dynamically_assigned);
     }
 
+    // Return whether the given id encodes the address of the (non-migratable)
+    // object it refers to, such ids can be resolved without consulting AGAS
+    constexpr bool is_lva_encoded(gid_type const& gid) noexcept
+    {
+        return refers_to_local_lva(gid) && !refers_to_virtual_memory(gid);
+    }
+
     inline gid_type replace_component_type(
         gid_type const& gid, std::uint32_t type) noexcept
     {
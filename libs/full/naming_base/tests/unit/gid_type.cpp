@@ -639,5 +639,26 @@ int main()
             bool(gid), true, "'lsb == true' and 'msb == false' case failed");
     }
 
+    {    // ids encoding the address of the referenced object
+        gid_type const locality = hpx::naming::get_gid_from_locality_id(1);
+
+        // locality ids do not encode an address
+        HPX_TEST(!hpx::naming::is_lva_encoded(locality));
+
+        // ids of non-migratable components carry their component type
+        gid_type const lva = hpx::naming::replace_component_type(
+            gid_type(locality.get_msb(), 0xdeadbeefULL), 42);
+        HPX_TEST(hpx::naming::is_lva_encoded(lva));
+        HPX_TEST_EQ(hpx::naming::get_locality_id_from_gid(lva), 1u);
+        HPX_TEST_EQ(
+            hpx::naming::detail::get_component_type_from_gid(lva.get_msb()),
+            42u);
+
+        // ids assigned by AGAS are marked as being dynamically assigned
+        gid_type const dynamic(
+            locality.get_msb() | gid_type::dynamically_assigned, 0x1000ULL);
+        HPX_TEST(!hpx::naming::is_lva_encoded(dynamic));
+    }
+
     return hpx::util::report_errors();
 }
@@ -75,7 +75,7 @@ namespace hpx::parcelset::policies::lci {
                         (char*) request.data.mbuffer.address + consumed,
                         buffer);
                     handle_received_parcels(
-                        decode_parcels(*pp_, HPX_MOVE(buffer)));
+                        *pp_, decode_parcels(*pp_, HPX_MOVE(buffer)));
                 }
                 HPX_ASSERT(consumed == request.data.mbuffer.length);
             }
@@ -85,7 +85,8 @@ namespace hpx::parcelset::policies::lci {
                 HPX_ASSERT(request.type == LCI_IOVEC);
                 buffer_type buffer;
                 decode_iovec(request.data.iovec, buffer);
-                handle_received_parcels(decode_parcels(*pp_, HPX_MOVE(buffer)));
+                handle_received_parcels(
+                    *pp_, decode_parcels(*pp_, HPX_MOVE(buffer)));
             }
         }
 
@@ -377,7 +377,8 @@ namespace hpx::parcelset::policies::lci {
             // decode and handle received data
             HPX_ASSERT(buffer.num_chunks_.first == 0 ||
                 !pp_->allow_zero_copy_receive_optimizations());
-            handle_received_parcels(decode_parcels(*pp_, HPX_MOVE(buffer)));
+            handle_received_parcels(
+                *pp_, decode_parcels(*pp_, HPX_MOVE(buffer)));
             chunk_buffers_.clear();
         }
         else
@@ -385,7 +386,7 @@ namespace hpx::parcelset::policies::lci {
             // handle the received zero-copy parcels.
             HPX_ASSERT(buffer.num_chunks_.first != 0 &&
                 pp_->allow_zero_copy_receive_optimizations());
-            handle_received_parcels(HPX_MOVE(parcels_));
+            handle_received_parcels(*pp_, HPX_MOVE(parcels_));
         }
         util::lci_environment::pcounter_add(
             util::lci_environment::handle_parcels,
@@ -34,6 +34,7 @@ namespace hpx::parcelset {
         using do_background_work = std::true_type;
         using send_immediate_parcels = std::true_type;
         using is_connectionless = std::false_type;
+        using stripe_zero_copy_chunks = std::false_type;
 
         static constexpr const char* type() noexcept
         {
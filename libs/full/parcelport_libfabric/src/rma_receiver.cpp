@@ -149,7 +149,7 @@ namespace hpx::parcelset::policies::libfabric {
         std::size_t num_thread = hpx::get_worker_thread_num();
         std::vector<parcelset::parcel> parcels = decode_message_with_chunks(
             *pp_, HPX_MOVE(buffer), 0, chunks_, num_thread);
-        handle_received_parcels(HPX_MOVE(parcels), num_thread);
+        handle_received_parcels(*pp_, HPX_MOVE(parcels), num_thread);
 
         LOG_DEBUG_MSG("receiver "
             << hexpointer(this)
@@ -486,7 +486,7 @@ namespace hpx::parcelset::policies::libfabric {
         std::size_t num_thread = hpx::get_worker_thread_num();
         std::vector<parcelset::parcel> parcels = decode_message_with_chunks(
             *pp_, HPX_MOVE(buffer), 0, chunks_, num_thread);
-        handle_received_parcels(HPX_MOVE(parcels), num_thread);
+        handle_received_parcels(*pp_, HPX_MOVE(parcels), num_thread);
 
         LOG_DEBUG_MSG("receiver "
             << hexpointer(this)
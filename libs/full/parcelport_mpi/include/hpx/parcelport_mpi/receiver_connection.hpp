@@ -320,7 +320,7 @@ namespace hpx::parcelset::policies::mpi {
                 // decode and handle received data
                 HPX_ASSERT(buffer_.num_chunks_.first == 0 ||
                     !pp_.allow_zero_copy_receive_optimizations());
-                handle_received_parcels(
+                handle_received_parcels(pp_,
                     decode_parcels(pp_, HPX_MOVE(buffer_), num_thread),
                     num_thread);
                 chunk_buffers_.clear();
@@ -330,7 +330,7 @@ namespace hpx::parcelset::policies::mpi {
                 // handle the received zero-copy parcels.
                 HPX_ASSERT(buffer_.num_chunks_.first != 0 &&
                     pp_.allow_zero_copy_receive_optimizations());
-                handle_received_parcels(HPX_MOVE(parcels_));
+                handle_received_parcels(pp_, HPX_MOVE(parcels_));
                 buffer_ = buffer_type{};
             }
             return true;
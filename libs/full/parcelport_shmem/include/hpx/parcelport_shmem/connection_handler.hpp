@@ -0,0 +1,172 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/synchronization.hpp>
+
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <asio/io_context.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shmem {
+
+        class HPX_EXPORT connection_handler;
+    }    // namespace policies::shmem
+
+    template <>
+    struct connection_handler_traits<policies::shmem::connection_handler>
+    {
+        using connection_type = policies::shmem::sender;
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+        using is_connectionless = std::false_type;
+        using stripe_zero_copy_chunks = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies::shmem {
+
+        class HPX_EXPORT connection_handler
+          : public parcelport_impl<connection_handler>
+        {
+            using base_type = parcelport_impl<connection_handler>;
+
+        public:
+            static std::vector<std::string> runtime_configuration()
+            {
+                std::vector<std::string> lines;
+                return lines;
+            }
+
+            connection_handler(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier);
+
+            ~connection_handler();
+
+            // Start the handling of connections.
+            bool do_run();
+
+            // Stop the handling of connections.
+            void do_stop();
+
+            // Return the name of this locality
+            std::string get_locality_name() const override;
+
+            std::shared_ptr<sender> create_connection(
+                parcelset::locality const& l, error_code& ec);
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const& ini) const override;
+
+            parcelset::locality create_locality() const override;
+
+            // This parcelport is used for all localities running on the same
+            // host, independently of whether alternative parcelports are
+            // enabled.
+            bool can_connect(parcelset::locality const& dest,
+                bool use_alternative_parcelport) override;
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode);
+
+            // The size of the ring buffer of each connection
+            std::size_t ring_size() const noexcept
+            {
+                return ring_size_;
+            }
+
+            // The size of the payload pool of each connection
+            std::size_t pool_size() const noexcept
+            {
+                return pool_size_;
+            }
+
+            // Messages up to this size are copied into the ring buffer
+            std::size_t inline_threshold() const noexcept
+            {
+                return inline_threshold_;
+            }
+
+            // Return a new sequence number used to name a connection
+            std::uint64_t next_connection_sequence() noexcept
+            {
+                return ++connection_sequence_;
+            }
+
+            // Register a connection whose current message did not fit into
+            // its ring buffer, the message is written by the background work
+            void add_blocked_sender(std::shared_ptr<sender> s);
+
+        private:
+            bool accept_and_receive(std::size_t num_thread);
+            bool retry_blocked_senders();
+            void io_service_work();
+
+            std::atomic<bool> stopped_;
+
+            std::size_t ring_size_;
+            std::size_t pool_size_;
+            std::size_t inline_threshold_;
+            std::atomic<std::uint64_t> connection_sequence_;
+
+            // the segment other localities announce new connections in
+            mapped_memory inbox_memory_;
+            inbox inbox_;
+
+            hpx::spinlock receivers_mtx_;
+            std::vector<std::unique_ptr<receiver>> receivers_;
+
+            hpx::spinlock blocked_mtx_;
+            std::vector<std::shared_ptr<sender>> blocked_;
+
+            // cache of whether localities are reachable through shared memory
+            hpx::spinlock reachable_mtx_;
+            std::map<locality, bool> reachable_;
+        };
+    }    // namespace policies::shmem
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,77 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+#include <hpx/parcelset_base/parcel_interface.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::policies::shmem {
+
+    class HPX_EXPORT connection_handler;
+
+    // The receiving end of a connection, reads the messages from the ring
+    // buffer created by the sending locality. The payload pool following the
+    // ring buffer is mapped together with it.
+    class HPX_EXPORT receiver
+    {
+        using parcel_buffer_type = parcel_buffer<std::vector<char>>;
+
+    public:
+        explicit receiver(mapped_memory segment) noexcept;
+
+        // Decode up to max_messages messages, the decoded parcels are
+        // appended to the given list. Returns false if no message was
+        // available.
+        bool poll(connection_handler& parcelport,
+            std::vector<std::vector<parcelset::parcel>>& parcels,
+            std::size_t max_messages, std::size_t num_thread);
+
+        // The sender has closed the connection and all messages have been
+        // received.
+        bool is_closed() const noexcept
+        {
+            return ring_.is_closed();
+        }
+
+    private:
+        std::vector<parcelset::parcel> decode(connection_handler& parcelport,
+            message_header const& header, char const* payload,
+            std::size_t num_thread);
+        std::vector<parcelset::parcel> decode(connection_handler& parcelport,
+            message_header const& header, char const* transmission_chunks,
+            char const* data, char const* zero_copy_chunks,
+            std::size_t num_thread);
+
+        mapped_memory segment_;
+        message_ring ring_;
+        char const* pool_;
+
+        // the header and the payload received so far of the current
+        // fragmented message
+        message_header fragmented_;
+        std::vector<char> fragments_;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+#endif
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,151 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+
+#include <asio/io_context.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::policies::shmem {
+
+    class HPX_EXPORT connection_handler;
+
+    // A connection owns a shared memory segment holding a ring buffer the
+    // receiving locality reads the messages from, followed by a pool the
+    // payload of larger messages is stored in. Small messages are copied into
+    // the ring. Larger messages are serialized directly into the pool, only
+    // their zero-copy chunks are copied. Messages which do not fit into the
+    // pool are copied into the ring in several fragments.
+    class HPX_EXPORT sender
+      : public parcelset::parcelport_connection<sender,
+            std::vector<char, payload_allocator<char>>>
+    {
+        using postprocess_handler_type =
+            hpx::move_only_function<void(std::error_code const&)>;
+
+    public:
+        sender(connection_handler& parcelport, asio::io_context& io_service,
+            parcelset::locality const& locality_id);
+
+        ~sender();
+
+        // Create the shared memory segment of this connection and announce
+        // it to the receiving locality.
+        void connect(std::error_code& ec);
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        void verify_(
+            [[maybe_unused]] parcelset::locality const& parcel_locality_id)
+            const
+        {
+            HPX_ASSERT(parcel_locality_id == there_);
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(
+            Handler&& handler, ParcelPostprocess&& parcel_postprocess)
+        {
+            HPX_ASSERT(!buffer_.data_.empty());
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+
+            handler_ = HPX_FORWARD(Handler, handler);
+            postprocess_handler_ =
+                HPX_FORWARD(ParcelPostprocess, parcel_postprocess);
+            HPX_ASSERT(handler_);
+            HPX_ASSERT(postprocess_handler_);
+
+            /// Increment sends and begin timer.
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+#endif
+            send();
+        }
+
+        // Retry writing the current message after it did not fit into the
+        // ring buffer, returns false if it still does not fit.
+        bool retry();
+
+    private:
+        void send();
+        bool try_write();
+        bool write_fragments(message_header const& header);
+        void copy_payload(
+            char* dest, std::size_t offset, std::size_t size) const noexcept;
+        void detach_data() noexcept;
+
+        void complete(std::error_code const& e);
+        void handle_write(std::error_code const& e);
+
+        static void reset_handler(postprocess_handler_type handler)
+        {
+            handler.reset();
+        }
+
+        connection_handler& parcelport_;
+        asio::io_context& io_service_;
+
+        // the other (receiving) end of this connection
+        parcelset::locality there_;
+
+        // the shared memory segment holding the ring buffer and the payload
+        // pool
+        std::string name_;
+        mapped_memory segment_;
+        message_ring ring_;
+        payload_pool pool_;
+
+        // the number of bytes of the payload of the current message which
+        // have been written as fragments
+        bool fragmenting_;
+        std::size_t fragment_offset_;
+
+        // completions triggered while a completion is being handled are
+        // deferred to the io_context to avoid unbounded recursion
+        std::atomic<bool> in_completion_;
+
+        // Counters and their data containers.
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+#endif
+
+        postprocess_handler_type handler_;
+        hpx::move_only_function<void(std::error_code const&,
+            parcelset::locality const&, std::shared_ptr<sender>)>
+            postprocess_handler_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,414 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/parcelport_shmem/locality.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::policies::shmem {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A named POSIX shared memory object mapped into this process
+    class HPX_EXPORT mapped_memory
+    {
+    public:
+        mapped_memory() noexcept = default;
+
+        mapped_memory(mapped_memory&& rhs) noexcept;
+        mapped_memory& operator=(mapped_memory&& rhs) noexcept;
+
+        mapped_memory(mapped_memory const&) = delete;
+        mapped_memory& operator=(mapped_memory const&) = delete;
+
+        ~mapped_memory();
+
+        // Create and map a new named shared memory object
+        static mapped_memory create(
+            std::string const& name, std::size_t size, std::error_code& ec);
+
+        // Map an existing named shared memory object
+        static mapped_memory open(std::string const& name, std::error_code& ec);
+
+        // Remove the name of a shared memory object, the memory stays mapped
+        static void unlink(std::string const& name) noexcept;
+
+        void* data() const noexcept
+        {
+            return data_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return data_ != nullptr;
+        }
+
+    private:
+        void reset() noexcept;
+
+        void* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The kinds of records stored in the ring buffer of a connection
+    enum class record_type : std::uint32_t
+    {
+        // the payload follows the header
+        message = 0,
+
+        // the transmission chunks follow the header, the non-zero-copy data
+        // and the zero-copy chunks are stored in the payload pool
+        pooled_message = 1,
+
+        // the payload follows in the next fragment records
+        fragmented_message = 2,
+
+        // part of the payload of the last fragmented message, the bytes
+        // follow the header
+        fragment = 3
+    };
+
+    // Every record is prefixed by this header. The payload of a message
+    // consists of the transmission chunks, the non-zero-copy data and the
+    // zero-copy chunks, each padded to 8 bytes.
+    struct message_header
+    {
+        record_type type;
+        std::uint32_t num_zero_copy_chunks;
+        std::uint32_t num_non_zero_copy_chunks;
+        std::uint32_t reserved;
+        std::uint64_t size;
+        std::uint64_t data_size;
+
+        // the size of the whole payload, for fragments the number of bytes
+        // carried by the record
+        std::uint64_t payload_size;
+
+        // pooled messages only: the offsets of the non-zero-copy data and of
+        // the zero-copy chunks in the payload pool
+        std::uint64_t data_offset;
+        std::uint64_t chunks_offset;
+    };
+
+    constexpr std::size_t payload_alignment = 8;
+
+    constexpr std::size_t align_payload(std::size_t size) noexcept
+    {
+        return (size + payload_alignment - 1) & ~(payload_alignment - 1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Lock-free single-producer/single-consumer ring buffer of variable sized
+    // records placed at the beginning of a shared memory segment. Records are
+    // always contiguous, a record which does not fit before the end of the
+    // buffer is preceded by a wrap marker.
+    class HPX_EXPORT message_ring
+    {
+    public:
+        struct header;
+
+        message_ring() noexcept = default;
+
+        // Initialize a new ring in the given (zero-initialized) memory
+        static void initialize(
+            void* memory, std::size_t size, std::int32_t producer_pid) noexcept;
+
+        // Return the size of the memory needed for a ring of the given
+        // capacity
+        static std::size_t memory_size(std::size_t capacity) noexcept;
+
+        explicit message_ring(void* memory) noexcept;
+
+        // Producer: reserve space for a record of the given size, returns
+        // nullptr if there is currently not enough space. The record is made
+        // visible to the consumer by commit().
+        [[nodiscard]] void* try_reserve(std::size_t size) noexcept;
+        void commit() noexcept;
+
+        // Producer: position after the last committed record
+        [[nodiscard]] std::uint64_t committed() const noexcept;
+
+        // Producer: the ring will not receive any more records
+        void close() noexcept;
+
+        // Consumer: access the next record, if any
+        [[nodiscard]] std::pair<void const*, std::size_t> try_peek() noexcept;
+        void release() noexcept;
+
+        // Position up to which all records have been released
+        [[nodiscard]] std::uint64_t released() const noexcept;
+
+        // Consumer: the producer has closed the ring and all records have
+        // been released
+        [[nodiscard]] bool is_closed() const noexcept;
+
+        [[nodiscard]] std::size_t capacity() const noexcept;
+        [[nodiscard]] std::int32_t producer_pid() const noexcept;
+
+    private:
+        header* header_ = nullptr;
+        char* data_ = nullptr;
+        std::uint64_t pending_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The shared memory segment of a connection holds the ring buffer
+    // followed by the payload pool, the receiver maps both when it accepts
+    // the connection.
+    HPX_EXPORT std::size_t segment_size(
+        std::size_t ring_capacity, std::size_t pool_size) noexcept;
+
+    // Return the offset of the payload pool in the segment of a connection
+    HPX_EXPORT std::size_t payload_pool_offset(
+        std::size_t ring_capacity) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Manages the payload pool of a connection on the sending side. Blocks
+    // are allocated in FIFO order, the memory of a block is reused once the
+    // block and all blocks allocated before it have been released. A block
+    // referenced by a message is released as soon as the receiver has
+    // released the message from the given ring buffer. The pool is not
+    // thread-safe, it is used by the connection owning it only.
+    class HPX_EXPORT payload_pool
+    {
+    public:
+        payload_pool() noexcept = default;
+        payload_pool(
+            void* memory, std::size_t size, message_ring const& ring) noexcept;
+
+        // Allocate a contiguous block of the given size, returns nullptr if
+        // there is currently not enough room
+        [[nodiscard]] void* allocate(std::size_t size) noexcept;
+
+        // The block starting at the given address is not used anymore, does
+        // nothing if the block is referenced by a message
+        void deallocate(void* p) noexcept;
+
+        // The block starting at the given address is referenced by the
+        // message stored before the given ring position
+        void commit(void const* p, std::uint64_t position) noexcept;
+
+        // Reuse the blocks of the messages the receiver has released
+        void release() noexcept;
+
+        [[nodiscard]] bool contains(void const* p) const noexcept
+        {
+            return data_ != nullptr && static_cast<char const*>(p) >= data_ &&
+                static_cast<char const*>(p) < data_ + capacity_;
+        }
+
+        // Offset of the given address in the pool
+        [[nodiscard]] std::uint64_t offset(void const* p) const noexcept
+        {
+            return static_cast<std::uint64_t>(
+                static_cast<char const*>(p) - data_);
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        // The number of blocks which have not been released yet
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return blocks_.size();
+        }
+
+    private:
+        enum class block_state
+        {
+            allocated,
+            committed,
+            released
+        };
+
+        struct block
+        {
+            std::uint64_t begin;
+            std::uint64_t end;
+            std::uint64_t position;
+            block_state state;
+        };
+
+        block* find(void const* p) noexcept;
+
+        char* data_ = nullptr;
+        std::size_t capacity_ = 0;
+        message_ring ring_;
+
+        // the positions (in bytes since the pool was last empty) of the
+        // first byte in use and of the first free byte
+        std::uint64_t head_ = 0;
+        std::uint64_t tail_ = 0;
+        std::deque<block> blocks_;
+    };
+
+    // Allocates the buffers parcels are serialized into from the payload
+    // pool of a connection, this allows to pass the serialized data to the
+    // receiver without copying it. Buffers up to the given size and buffers
+    // which do not fit into the pool are allocated on the heap.
+    template <typename T>
+    class payload_allocator
+    {
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        payload_allocator() noexcept = default;
+
+        payload_allocator(payload_pool* pool, std::size_t threshold) noexcept
+          : pool_(pool)
+          , threshold_(threshold)
+        {
+        }
+
+        template <typename U>
+        payload_allocator(payload_allocator<U> const& rhs) noexcept
+          : pool_(rhs.pool())
+          , threshold_(rhs.threshold())
+        {
+        }
+
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            std::size_t const size = n * sizeof(T);
+            if (pool_ != nullptr && size > threshold_ &&
+                size <= pool_->capacity() / 2)
+            {
+                if (void* p = pool_->allocate(size))
+                {
+                    return static_cast<T*>(p);
+                }
+            }
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            if (pool_ != nullptr && pool_->contains(p))
+            {
+                pool_->deallocate(p);
+                return;
+            }
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        payload_pool* pool() const noexcept
+        {
+            return pool_;
+        }
+
+        std::size_t threshold() const noexcept
+        {
+            return threshold_;
+        }
+
+        friend bool operator==(
+            payload_allocator const& lhs, payload_allocator const& rhs) noexcept
+        {
+            return lhs.pool_ == rhs.pool_;
+        }
+
+        friend bool operator!=(
+            payload_allocator const& lhs, payload_allocator const& rhs) noexcept
+        {
+            return lhs.pool_ != rhs.pool_;
+        }
+
+    private:
+        payload_pool* pool_ = nullptr;
+        std::size_t threshold_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Each locality creates a shared memory segment (its inbox) other
+    // localities use to announce new connections. A connection is announced
+    // by storing the name of its shared memory segment in a free slot.
+    class HPX_EXPORT inbox
+    {
+    public:
+        struct header;
+
+        static constexpr std::size_t num_slots = 256;
+        static constexpr std::size_t max_name_length = 59;
+
+        inbox() noexcept = default;
+
+        // Initialize a new inbox in the given (zero-initialized) memory
+        static void initialize(void* memory) noexcept;
+
+        static std::size_t memory_size() noexcept;
+
+        explicit inbox(void* memory) noexcept;
+
+        // Announce a new connection, returns false if no slot is available
+        bool announce(std::string const& name) noexcept;
+
+        // Invoke f for all connections announced since the last call
+        template <typename F>
+        void accept(F&& f);
+
+    private:
+        std::uint64_t announcements() const noexcept;
+        bool take(std::size_t slot, std::string& name) noexcept;
+
+        header* header_ = nullptr;
+        std::uint64_t seen_ = 0;
+    };
+
+    template <typename F>
+    void inbox::accept(F&& f)
+    {
+        std::uint64_t const announced = announcements();
+        if (announced == seen_)
+        {
+            return;
+        }
+        seen_ = announced;
+
+        std::string name;
+        for (std::size_t i = 0; i != num_slots; ++i)
+        {
+            if (take(i, name))
+            {
+                f(name);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Names of the shared memory objects used by the parcelport
+    HPX_EXPORT std::string inbox_name(locality const& l);
+    HPX_EXPORT std::string connection_name(
+        locality const& here, std::uint64_t sequence);
+}    // namespace hpx::parcelset::policies::shmem
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,364 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <asio/io_context.hpp>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        // the maximal number of messages received from a connection during
+        // one invocation of the background work
+        constexpr std::size_t max_messages_per_poll = 16;
+
+        parcelset::locality make_here()
+        {
+            std::random_device rd;
+            std::uint64_t const token =
+                (static_cast<std::uint64_t>(rd()) << 32) | rd();
+
+            return parcelset::locality(locality(host_identifier(),
+                static_cast<std::int32_t>(::getpid()), token));
+        }
+    }    // namespace
+
+    connection_handler::connection_handler(
+        util::runtime_configuration const& ini,
+        threads::policies::callback_notifier const& notifier)
+      : base_type(ini, make_here(), notifier)
+      , stopped_(false)
+      , ring_size_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.shmem.ring_size", 1048576))
+      , pool_size_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.shmem.pool_size", 16777216))
+      , inline_threshold_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.shmem.inline_threshold", 65536))
+      , connection_sequence_(0)
+    {
+        if (here_.type() != std::string("shmem"))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::parcelport::parcelport",
+                "this parcelport was instantiated to represent an unexpected "
+                "locality type: {}",
+                here_.type());
+        }
+
+        if (ring_size_ < 4096)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "shmem::parcelport::parcelport",
+                "the value of hpx.parcel.shmem.ring_size is too small: {} "
+                "(expected at least 4096)",
+                ring_size_);
+        }
+
+        // make sure a message which is copied into the ring buffer leaves
+        // room for other messages
+        inline_threshold_ = (std::min)(inline_threshold_, ring_size_ / 4);
+
+        // The inbox is created right away, other localities may try to
+        // connect as soon as the endpoints of this locality are known.
+        std::error_code ec;
+        inbox_memory_ = mapped_memory::create(
+            inbox_name(here_.get<locality>()), inbox::memory_size(), ec);
+        if (ec)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::parcelport::parcelport",
+                "failed to create shared memory inbox: {}", ec.message());
+        }
+
+        inbox::initialize(inbox_memory_.data());
+        inbox_ = inbox(inbox_memory_.data());
+    }
+
+    connection_handler::~connection_handler()
+    {
+        // the connections refer to this object while being destroyed
+        priority_connection_cache_.clear();
+        connection_cache_.clear();
+
+        if (inbox_memory_)
+        {
+            mapped_memory::unlink(inbox_name(here_.get<locality>()));
+        }
+    }
+
+    bool connection_handler::do_run()
+    {
+        // We execute the background work on the I/O service while HPX is
+        // starting, the parcels sent during startup rely on this.
+        for (std::size_t i = 0; i != io_service_pool_.size(); ++i)
+        {
+            io_service_pool_.get_io_service(static_cast<int>(i))
+                .post(hpx::bind(&connection_handler::io_service_work, this));
+        }
+        return true;
+    }
+
+    void connection_handler::do_stop()
+    {
+        while (background_work(0, parcelport_background_mode::all))
+        {
+            if (threads::get_self_ptr())
+            {
+                hpx::this_thread::suspend(
+                    hpx::threads::thread_schedule_state::pending,
+                    "shmem::parcelport::do_stop");
+            }
+        }
+
+        bool expected = false;
+        if (stopped_.compare_exchange_strong(expected, true))
+        {
+            {
+                std::lock_guard l(blocked_mtx_);
+                blocked_.clear();
+            }
+
+            // no new connections can be announced from now on
+            mapped_memory::unlink(inbox_name(here_.get<locality>()));
+
+            std::lock_guard l(receivers_mtx_);
+            receivers_.clear();
+            inbox_memory_ = mapped_memory();
+        }
+    }
+
+    std::string connection_handler::get_locality_name() const
+    {
+        char hostname[256] = {};
+        if (::gethostname(hostname, sizeof(hostname) - 1) != 0)
+        {
+            return "<unknown>";
+        }
+        return hostname;
+    }
+
+    parcelset::locality connection_handler::agas_locality(
+        util::runtime_configuration const&) const
+    {
+        // this parcelport can't be used for bootstrapping
+        return parcelset::locality(locality());
+    }
+
+    parcelset::locality connection_handler::create_locality() const
+    {
+        return parcelset::locality(locality());
+    }
+
+    bool connection_handler::can_connect(
+        parcelset::locality const& dest, bool /* use_alternative_parcelport */)
+    {
+        locality const& there = dest.get<locality>();
+        if (!there || there.host() != here_.get<locality>().host())
+        {
+            return false;
+        }
+
+        {
+            std::lock_guard l(reachable_mtx_);
+            auto const it = reachable_.find(there);
+            if (it != reachable_.end())
+            {
+                return it->second;
+            }
+        }
+
+        // the destination could be running in a different (container)
+        // namespace, make sure its inbox is visible to this locality
+        std::error_code ec;
+        bool const reachable =
+            static_cast<bool>(mapped_memory::open(inbox_name(there), ec));
+
+        std::lock_guard l(reachable_mtx_);
+        reachable_.emplace(there, reachable);
+        return reachable;
+    }
+
+    std::shared_ptr<sender> connection_handler::create_connection(
+        parcelset::locality const& l, error_code& ec)
+    {
+        auto sender_connection = std::make_shared<sender>(
+            *this, io_service_pool_.get_io_service(), l);
+
+        std::error_code error;
+        sender_connection->connect(error);
+        if (error)
+        {
+            sender_connection.reset();
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::connection_handler::get_connection",
+                "{} (while trying to connect to: {})", error.message(), l);
+        }
+        return sender_connection;
+    }
+
+    void connection_handler::add_blocked_sender(std::shared_ptr<sender> s)
+    {
+        std::lock_guard l(blocked_mtx_);
+        blocked_.push_back(HPX_MOVE(s));
+    }
+
+    bool connection_handler::retry_blocked_senders()
+    {
+        std::vector<std::shared_ptr<sender>> blocked;
+        {
+            std::lock_guard l(blocked_mtx_);
+            if (blocked_.empty())
+            {
+                return false;
+            }
+            std::swap(blocked, blocked_);
+        }
+
+        auto const it = std::remove_if(blocked.begin(), blocked.end(),
+            [](std::shared_ptr<sender> const& s) { return s->retry(); });
+        blocked.erase(it, blocked.end());
+
+        if (!blocked.empty())
+        {
+            std::lock_guard l(blocked_mtx_);
+            blocked_.insert(blocked_.end(),
+                std::make_move_iterator(blocked.begin()),
+                std::make_move_iterator(blocked.end()));
+        }
+        return true;
+    }
+
+    bool connection_handler::accept_and_receive(std::size_t num_thread)
+    {
+        std::vector<std::vector<parcelset::parcel>> parcels;
+        bool has_work = false;
+        {
+            std::unique_lock l(receivers_mtx_, std::try_to_lock);
+            if (!l.owns_lock() || !inbox_memory_)
+            {
+                return false;
+            }
+
+            inbox_.accept([this](std::string const& name) {
+                std::error_code ec;
+                mapped_memory segment = mapped_memory::open(name, ec);
+
+                // the name is not needed anymore once the segment is mapped
+                mapped_memory::unlink(name);
+                if (ec)
+                {
+                    LPT_(error).format("shmem::connection_handler::accept: "
+                                       "failed to open {}: {}",
+                        name, ec.message());
+                    return;
+                }
+                receivers_.push_back(
+                    std::make_unique<receiver>(HPX_MOVE(segment)));
+            });
+
+            for (auto it = receivers_.begin(); it != receivers_.end();)
+            {
+                has_work = (*it)->poll(*this, parcels, max_messages_per_poll,
+                               num_thread) ||
+                    has_work;
+
+                if ((*it)->is_closed())
+                {
+                    it = receivers_.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        // the received parcels are scheduled without holding the lock, the
+        // first parcel of each message may be executed directly
+        for (auto& p : parcels)
+        {
+            handle_received_parcels(*this, HPX_MOVE(p), num_thread);
+        }
+        return has_work;
+    }
+
+    bool connection_handler::background_work(
+        std::size_t num_thread, parcelport_background_mode mode)
+    {
+        if (stopped_.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        bool has_work = false;
+        if (mode & parcelport_background_mode::send)
+        {
+            has_work = retry_blocked_senders();
+        }
+        if (mode & parcelport_background_mode::receive)
+        {
+            has_work = accept_and_receive(num_thread) || has_work;
+        }
+        return has_work;
+    }
+
+    void connection_handler::io_service_work()
+    {
+        std::size_t k = 0;
+
+        // We only execute work on the IO service while HPX is starting
+        while (hpx::is_starting())
+        {
+            if (background_work(0, parcelport_background_mode::all))
+            {
+                k = 0;
+            }
+            else
+            {
+                ++k;
+                util::detail::yield_k(k,
+                    "hpx::parcelset::policies::shmem::connection_handler::"
+                    "io_service_work");
+            }
+        }
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,64 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelport_shmem/locality.hpp>
+
+#include <unistd.h>
+
+#include <fstream>
+#include <ostream>
+#include <string>
+
+namespace hpx::parcelset::policies::shmem {
+
+    void locality::save(serialization::output_archive& ar) const
+    {
+        ar << host_;
+        ar << pid_;
+        ar << token_;
+    }
+
+    void locality::load(serialization::input_archive& ar)
+    {
+        ar >> host_;
+        ar >> pid_;
+        ar >> token_;
+    }
+
+    std::ostream& operator<<(std::ostream& os, locality const& loc) noexcept
+    {
+        hpx::util::ios_flags_saver ifs(os);
+        os << loc.host_ << ":" << loc.pid_ << ":" << std::hex << loc.token_;
+        return os;
+    }
+
+    std::string host_identifier()
+    {
+        // the boot id distinguishes hosts which happen to have the same name
+        std::string boot_id;
+        std::ifstream in("/proc/sys/kernel/random/boot_id");
+        if (in)
+        {
+            std::getline(in, boot_id);
+        }
+
+        char hostname[256] = {};
+        if (::gethostname(hostname, sizeof(hostname) - 1) != 0)
+        {
+            hostname[0] = '\0';
+        }
+
+        return std::string(hostname) + "/" + boot_id;
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,60 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+// Inject additional configuration data into the factory registry for this type.
+// This information ends up in the system wide configuration database under the
+// plugin specific section:
+//
+//      [hpx.parcel.shmem]
+//      ...
+//      priority = 2000
+//      ring_size = 1048576
+//      inline_threshold = 65536
+//
+// The priority is higher than the one of all other parcelports (including the
+// one selected by hpxrun.py) as this parcelport is used for localities running
+// on the same host only, all other localities are reached through the next
+// parcelport.
+template <>
+struct hpx::traits::plugin_config_data<
+    hpx::parcelset::policies::shmem::connection_handler>
+{
+    static constexpr char const* priority() noexcept
+    {
+        return "2000";
+    }
+
+    static constexpr void init(int* /* argc */, char*** /* argv */,
+        util::command_line_handling& /* cfg */) noexcept
+    {
+    }
+
+    // by default no additional initialization using the resource
+    // partitioner is required
+    static constexpr void init(hpx::resource::partitioner&) noexcept {}
+
+    static constexpr void destroy() noexcept {}
+
+    static constexpr char const* call() noexcept
+    {
+        return "ring_size = ${HPX_PARCEL_SHMEM_RING_SIZE:1048576}\n"
+               "pool_size = ${HPX_PARCEL_SHMEM_POOL_SIZE:16777216}\n"
+               "inline_threshold = ${HPX_PARCEL_SHMEM_INLINE_THRESHOLD:65536}";
+    }
+};    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(
+    hpx::parcelset::policies::shmem::connection_handler, shmem)
+
+#endif
@@ -0,0 +1,238 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    receiver::receiver(mapped_memory segment) noexcept
+      : segment_(HPX_MOVE(segment))
+      , ring_(segment_.data())
+      , pool_(static_cast<char const*>(segment_.data()) +
+            payload_pool_offset(ring_.capacity()))
+      , fragmented_()
+    {
+        HPX_ASSERT(segment_.size() >= payload_pool_offset(ring_.capacity()));
+    }
+
+    bool receiver::poll(connection_handler& parcelport,
+        std::vector<std::vector<parcelset::parcel>>& parcels,
+        std::size_t max_messages, std::size_t num_thread)
+    {
+        bool has_work = false;
+        for (std::size_t i = 0; i != max_messages; ++i)
+        {
+            auto const [record, size] = ring_.try_peek();
+            if (record == nullptr)
+            {
+                break;
+            }
+
+            HPX_ASSERT(size >= sizeof(message_header));
+
+            message_header header;
+            std::memcpy(&header, record, sizeof(message_header));
+
+            char const* payload =
+                static_cast<char const*>(record) + sizeof(message_header);
+            switch (header.type)
+            {
+            case record_type::message:
+                HPX_ASSERT(
+                    size == sizeof(message_header) + header.payload_size);
+                parcels.emplace_back(
+                    decode(parcelport, header, payload, num_thread));
+                break;
+
+            case record_type::pooled_message:
+            {
+                // the record holds the transmission chunks, the blocks of
+                // the payload pool stay valid until the record is released
+                HPX_ASSERT(header.data_offset < segment_.size() &&
+                    header.chunks_offset < segment_.size());
+                char const* data =
+                    pool_ + static_cast<std::size_t>(header.data_offset);
+                char const* zero_copy_chunks =
+                    pool_ + static_cast<std::size_t>(header.chunks_offset);
+                parcels.emplace_back(decode(parcelport, header, payload, data,
+                    zero_copy_chunks, num_thread));
+                break;
+            }
+
+            case record_type::fragmented_message:
+                fragmented_ = header;
+                fragments_.clear();
+                fragments_.reserve(
+                    static_cast<std::size_t>(header.payload_size));
+                break;
+
+            case record_type::fragment:
+                HPX_ASSERT(fragments_.size() + header.payload_size <=
+                    fragmented_.payload_size);
+                fragments_.insert(
+                    fragments_.end(), payload, payload + header.payload_size);
+
+                if (fragments_.size() == fragmented_.payload_size)
+                {
+                    parcels.emplace_back(decode(
+                        parcelport, fragmented_, fragments_.data(), num_thread));
+
+                    // don't keep the memory of large messages alive
+                    std::vector<char>().swap(fragments_);
+                }
+                break;
+
+            default:
+                HPX_ASSERT_MSG(false, "unexpected shared memory record");
+                break;
+            }
+
+            // all data has been copied out of the shared memory at this point
+            ring_.release();
+            has_work = true;
+        }
+        return has_work;
+    }
+
+    std::vector<parcelset::parcel> receiver::decode(
+        connection_handler& parcelport, message_header const& header,
+        char const* payload, std::size_t num_thread)
+    {
+        // the parts of the payload follow each other
+        std::size_t const num_chunks =
+            static_cast<std::size_t>(header.num_zero_copy_chunks) +
+            static_cast<std::size_t>(header.num_non_zero_copy_chunks);
+        char const* data = payload +
+            num_chunks * sizeof(parcel_buffer_type::transmission_chunk_type);
+        char const* zero_copy_chunks =
+            data + align_payload(static_cast<std::size_t>(header.size));
+
+        return decode(
+            parcelport, header, payload, data, zero_copy_chunks, num_thread);
+    }
+
+    std::vector<parcelset::parcel> receiver::decode(
+        connection_handler& parcelport, message_header const& header,
+        char const* transmission_chunks, char const* data,
+        char const* zero_copy_chunks, std::size_t num_thread)
+    {
+        parcel_buffer_type buffer;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        buffer.data_point_.time_ = timer_.elapsed_nanoseconds();
+        buffer.data_point_.bytes_ = static_cast<std::size_t>(header.size);
+#endif
+
+        buffer.num_chunks_.first = header.num_zero_copy_chunks;
+        buffer.num_chunks_.second = header.num_non_zero_copy_chunks;
+        buffer.size_ = header.size;
+        buffer.data_size_ = header.data_size;
+
+        auto const num_zero_copy_chunks =
+            static_cast<std::size_t>(header.num_zero_copy_chunks);
+        std::size_t const num_chunks = num_zero_copy_chunks +
+            static_cast<std::size_t>(header.num_non_zero_copy_chunks);
+        if (num_chunks != 0)
+        {
+            using transmission_chunk_type =
+                parcel_buffer_type::transmission_chunk_type;
+
+            buffer.transmission_chunks_.resize(num_chunks);
+            std::memcpy(buffer.transmission_chunks_.data(),
+                transmission_chunks,
+                num_chunks * sizeof(transmission_chunk_type));
+        }
+
+        auto const size = static_cast<std::size_t>(header.size);
+        buffer.data_.assign(data, data + size);
+
+        char const* payload = zero_copy_chunks;
+
+        if (num_zero_copy_chunks == 0)
+        {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer.data_point_.time_ =
+                timer_.elapsed_nanoseconds() - buffer.data_point_.time_;
+#endif
+            return decode_parcels(parcelport, HPX_MOVE(buffer), num_thread);
+        }
+
+        buffer.chunks_.resize(num_zero_copy_chunks);
+
+        if (parcelport.allow_zero_copy_receive_optimizations())
+        {
+            // De-serialize the parcels such that all data but the zero-copy
+            // chunks are in place. The de-serialization allocates the
+            // zero-copy chunk buffers, the data is copied into those
+            // directly.
+            for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+            {
+                auto const chunk_size = static_cast<std::size_t>(
+                    buffer.transmission_chunks_[i].second);
+                buffer.chunks_[i] =
+                    serialization::create_pointer_chunk(nullptr, chunk_size);
+            }
+
+            std::vector<parcelset::parcel> parcels =
+                decode_parcels_zero_copy(parcelport, buffer, num_thread);
+
+            std::size_t zero_copy_chunks = 0;
+            for (auto& c : buffer.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type::chunk_type_index)
+                {
+                    continue;    // skip non-zero-copy chunks
+                }
+
+                auto const chunk_size = static_cast<std::size_t>(
+                    buffer.transmission_chunks_[zero_copy_chunks++].second);
+
+                HPX_ASSERT_MSG(c.data() != nullptr && c.size() == chunk_size,
+                    "zero-copy chunk buffers should have been initialized "
+                    "during de-serialization");
+
+                std::memcpy(c.data(), payload, chunk_size);
+                payload += align_payload(chunk_size);
+            }
+            HPX_ASSERT(zero_copy_chunks == num_zero_copy_chunks);
+
+            return parcels;
+        }
+
+        // the zero-copy chunks are de-serialized directly from the shared
+        // memory, the data is copied into the de-serialized objects
+        for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+        {
+            auto const chunk_size = static_cast<std::size_t>(
+                buffer.transmission_chunks_[i].second);
+            buffer.chunks_[i] = serialization::create_pointer_chunk(
+                const_cast<char*>(payload), chunk_size);
+            payload += align_payload(chunk_size);
+        }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        buffer.data_point_.time_ =
+            timer_.elapsed_nanoseconds() - buffer.data_point_.time_;
+#endif
+        return decode_parcels(parcelport, HPX_MOVE(buffer), num_thread);
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,444 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <asio/io_context.hpp>
+#include <asio/post.hpp>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        // the number of attempts made to announce a connection in a full
+        // inbox of the receiving locality
+        constexpr std::size_t max_announce_attempts = 1000;
+    }    // namespace
+
+    sender::sender(connection_handler& parcelport,
+        asio::io_context& io_service, parcelset::locality const& locality_id)
+      : parcelport_connection(payload_allocator<char>(
+            &pool_, parcelport.inline_threshold()))
+      , parcelport_(parcelport)
+      , io_service_(io_service)
+      , there_(locality_id)
+      , fragmenting_(false)
+      , fragment_offset_(0)
+      , in_completion_(false)
+    {
+    }
+
+    sender::~sender()
+    {
+        // the serialized data may still be stored in the payload pool, which
+        // is destroyed before the buffer
+        buffer_type(payload_allocator<char>()).swap(buffer_.data_);
+
+        if (segment_)
+        {
+            // Let the receiver know that no more messages will arrive, the
+            // receiver unmaps the segment once it has seen all messages. The
+            // receiver has mapped the payload pool as well, thus the messages
+            // stored in it stay valid.
+            ring_.close();
+            mapped_memory::unlink(name_);
+        }
+    }
+
+    void sender::connect(std::error_code& ec)
+    {
+        locality const& here = parcelport_.here().get<locality>();
+        locality const& there = there_.get<locality>();
+
+        std::size_t const ring_size =
+            message_ring::memory_size(parcelport_.ring_size());
+
+        name_ = connection_name(here, parcelport_.next_connection_sequence());
+        segment_ = mapped_memory::create(name_,
+            segment_size(parcelport_.ring_size(), parcelport_.pool_size()), ec);
+        if (ec)
+        {
+            return;
+        }
+
+        message_ring::initialize(
+            segment_.data(), ring_size, static_cast<std::int32_t>(::getpid()));
+        ring_ = message_ring(segment_.data());
+
+        // the receiver maps the payload pool together with the ring buffer
+        std::size_t const offset = payload_pool_offset(ring_.capacity());
+        pool_ = payload_pool(static_cast<char*>(segment_.data()) + offset,
+            segment_.size() - offset, ring_);
+
+        mapped_memory peer = mapped_memory::open(inbox_name(there), ec);
+        if (ec)
+        {
+            return;
+        }
+
+        // the inbox of the receiving locality might be full for a short
+        // period of time if many connections are being created concurrently
+        inbox peer_inbox(peer.data());
+        for (std::size_t k = 0; !peer_inbox.announce(name_); ++k)
+        {
+            if (k == max_announce_attempts)
+            {
+                ec = std::make_error_code(
+                    std::errc::resource_unavailable_try_again);
+                return;
+            }
+            util::detail::yield_k(
+                k, "hpx::parcelset::policies::shmem::sender::connect");
+        }
+    }
+
+    // copy the given range of the payload of the current message, the
+    // payload consists of the transmission chunks, the non-zero-copy data
+    // and the zero-copy chunks, each padded to 8 bytes
+    void sender::copy_payload(
+        char* dest, std::size_t offset, std::size_t size) const noexcept
+    {
+        auto const copy = [&](void const* src, std::size_t length) {
+            std::size_t const padded = align_payload(length);
+            if (offset >= padded)
+            {
+                offset -= padded;
+                return;
+            }
+
+            // the padding bytes are left alone
+            std::size_t const count = (std::min)(padded - offset, size);
+            if (offset < length)
+            {
+                std::memcpy(dest, static_cast<char const*>(src) + offset,
+                    (std::min)(count, length - offset));
+            }
+
+            dest += count;
+            size -= count;
+            offset = 0;
+        };
+
+        auto const& chunks = buffer_.transmission_chunks_;
+        if (chunks.empty())
+        {
+            copy(buffer_.data_.data(), buffer_.data_.size());
+            return;
+        }
+
+        copy(chunks.data(),
+            chunks.size() *
+                sizeof(parcel_buffer_type::transmission_chunk_type));
+        copy(buffer_.data_.data(), buffer_.data_.size());
+
+        for (serialization::serialization_chunk const& c : buffer_.chunks_)
+        {
+            if (size == 0)
+            {
+                break;
+            }
+            if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+            {
+                copy(c.data_.cpos_, c.size_);
+            }
+        }
+    }
+
+    // give back the storage of the serialized data once it is not needed
+    // anymore, a block of the payload pool referenced by a message is reused
+    // once the receiver has released the message
+    void sender::detach_data() noexcept
+    {
+        if (pool_.contains(buffer_.data_.data()))
+        {
+            buffer_type(buffer_.data_.get_allocator()).swap(buffer_.data_);
+        }
+    }
+
+    bool sender::try_write()
+    {
+        pool_.release();
+
+        auto const& chunks = buffer_.transmission_chunks_;
+        std::size_t const chunks_size =
+            chunks.size() * sizeof(parcel_buffer_type::transmission_chunk_type);
+        std::size_t const data_size = align_payload(buffer_.data_.size());
+
+        message_header header = {};
+        header.type = record_type::message;
+        header.num_zero_copy_chunks = buffer_.num_chunks_.first;
+        header.num_non_zero_copy_chunks = buffer_.num_chunks_.second;
+        header.size = buffer_.data_.size();
+        header.data_size = buffer_.data_size_;
+        header.payload_size = chunks_size + data_size;
+
+        if (!chunks.empty())
+        {
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+                {
+                    header.payload_size += align_payload(c.size_);
+                }
+            }
+        }
+
+        auto const payload_size =
+            static_cast<std::size_t>(header.payload_size);
+
+        // small messages are copied into the ring buffer directly
+        if (!fragmenting_ &&
+            sizeof(message_header) + payload_size <=
+                parcelport_.inline_threshold())
+        {
+            auto* dest = static_cast<char*>(
+                ring_.try_reserve(sizeof(message_header) + payload_size));
+            if (dest == nullptr)
+            {
+                return false;
+            }
+
+            std::memcpy(dest, &header, sizeof(message_header));
+            copy_payload(dest + sizeof(message_header), 0, payload_size);
+            ring_.commit();
+
+            detach_data();
+            return true;
+        }
+
+        // The payload of larger messages is stored in the payload pool, only
+        // the transmission chunks are copied into the ring buffer. The data
+        // has usually been serialized into the pool already, the zero-copy
+        // chunks are copied into a separate block.
+        bool const pooled_data = pool_.contains(buffer_.data_.data());
+        std::size_t const block_offset =
+            chunks_size + (pooled_data ? data_size : 0);
+        std::size_t const block_size = payload_size - block_offset;
+
+        if (fragmenting_ || block_size > pool_.capacity() / 2 ||
+            sizeof(message_header) + chunks_size >
+                parcelport_.inline_threshold())
+        {
+            return write_fragments(header);
+        }
+
+        // the record is not visible to the receiver before it is committed
+        auto* dest = static_cast<char*>(
+            ring_.try_reserve(sizeof(message_header) + chunks_size));
+        if (dest == nullptr)
+        {
+            return false;
+        }
+
+        char* block = nullptr;
+        if (block_size != 0)
+        {
+            block = static_cast<char*>(pool_.allocate(block_size));
+            if (block == nullptr)
+            {
+                return false;
+            }
+            copy_payload(block, block_offset, block_size);
+        }
+
+        header.type = record_type::pooled_message;
+        if (pooled_data)
+        {
+            header.data_offset = pool_.offset(buffer_.data_.data());
+            header.chunks_offset = block != nullptr ? pool_.offset(block) : 0;
+        }
+        else
+        {
+            header.data_offset = pool_.offset(block);
+            header.chunks_offset = header.data_offset + data_size;
+        }
+
+        std::memcpy(dest, &header, sizeof(message_header));
+        copy_payload(dest + sizeof(message_header), 0, chunks_size);
+        ring_.commit();
+
+        // the blocks are released once the receiver has released the record
+        std::uint64_t const position = ring_.committed();
+        if (pooled_data)
+        {
+            pool_.commit(buffer_.data_.data(), position);
+        }
+        if (block != nullptr)
+        {
+            pool_.commit(block, position);
+        }
+
+        detach_data();
+        return true;
+    }
+
+    // Write the payload of a message which does not fit into the payload pool
+    // in fragments through the ring buffer, returns false if the ring buffer
+    // is full. The next call continues with the first fragment not written.
+    bool sender::write_fragments(message_header const& header)
+    {
+        auto const payload_size =
+            static_cast<std::size_t>(header.payload_size);
+
+        if (!fragmenting_)
+        {
+            void* dest = ring_.try_reserve(sizeof(message_header));
+            if (dest == nullptr)
+            {
+                return false;
+            }
+
+            message_header h = header;
+            h.type = record_type::fragmented_message;
+            std::memcpy(dest, &h, sizeof(message_header));
+            ring_.commit();
+
+            fragmenting_ = true;
+            fragment_offset_ = 0;
+        }
+
+        // leave room for other records in the ring buffer
+        std::size_t const max_fragment_size =
+            ring_.capacity() / 4 - sizeof(message_header);
+
+        while (fragment_offset_ != payload_size)
+        {
+            std::size_t const size =
+                (std::min)(max_fragment_size, payload_size - fragment_offset_);
+
+            auto* dest = static_cast<char*>(
+                ring_.try_reserve(sizeof(message_header) + size));
+            if (dest == nullptr)
+            {
+                return false;
+            }
+
+            message_header fragment = {};
+            fragment.type = record_type::fragment;
+            fragment.payload_size = size;
+
+            std::memcpy(dest, &fragment, sizeof(message_header));
+            copy_payload(dest + sizeof(message_header), fragment_offset_, size);
+            ring_.commit();
+
+            fragment_offset_ += size;
+        }
+
+        fragmenting_ = false;
+        fragment_offset_ = 0;
+
+        detach_data();
+        return true;
+    }
+
+    void sender::send()
+    {
+        if (!try_write())
+        {
+            // the background work will retry once the receiver has made
+            // some room
+            parcelport_.add_blocked_sender(shared_from_this());
+            return;
+        }
+        complete(std::error_code());
+    }
+
+    bool sender::retry()
+    {
+        if (!try_write())
+        {
+            return false;
+        }
+        complete(std::error_code());
+        return true;
+    }
+
+    void sender::complete(std::error_code const& e)
+    {
+        // The post-processing handler may immediately reuse this connection
+        // to write the next message, which might complete right away as well.
+        if (in_completion_.exchange(true))
+        {
+            void (sender::*f)(std::error_code const&) = &sender::handle_write;
+            asio::post(io_service_, hpx::bind(f, shared_from_this(), e));
+            return;
+        }
+
+        handle_write(e);
+        in_completion_.store(false);
+    }
+
+    void sender::handle_write(std::error_code const& e)
+    {
+        // complete data point and push back onto gatherer
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        if (!e)
+        {
+            buffer_.data_point_.time_ =
+                timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+            parcelport_.add_sent_data(buffer_.data_point_);
+        }
+#endif
+
+        // just call initial handler
+        handler_(e);
+
+        postprocess_handler_type handler;
+        std::swap(handler, handler_);
+
+        if (threads::threadmanager_is(hpx::state::running))
+        {
+            // the handler needs to be reset on an HPX thread (it destroys
+            // the parcel, which in turn might invoke HPX functions)
+            threads::thread_init_data data(
+                threads::make_thread_function_nullary(util::deferred_call(
+                    &sender::reset_handler, HPX_MOVE(handler))),
+                "sender::reset_handler");
+            threads::register_thread(data);
+        }
+        else
+        {
+            reset_handler(HPX_MOVE(handler));
+        }
+
+        buffer_.clear();
+
+        // Call post-processing handler, which will send remaining pending
+        // parcels. Pass along the connection so it can be reused if more
+        // parcels have to be sent.
+        hpx::move_only_function<void(std::error_code const&,
+            parcelset::locality const&, std::shared_ptr<sender>)>
+            postprocess_handler;
+        std::swap(postprocess_handler, postprocess_handler_);
+        postprocess_handler(e, there_, shared_from_this());
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,533 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        std::error_code last_error() noexcept
+        {
+            return {errno, std::system_category()};
+        }
+
+        void* map(int fd, std::size_t size, int prot, std::error_code& ec)
+        {
+            void* data = ::mmap(nullptr, size, prot, MAP_SHARED, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                ec = last_error();
+                return nullptr;
+            }
+            return data;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    mapped_memory::mapped_memory(mapped_memory&& rhs) noexcept
+      : data_(std::exchange(rhs.data_, nullptr))
+      , size_(std::exchange(rhs.size_, 0))
+    {
+    }
+
+    mapped_memory& mapped_memory::operator=(mapped_memory&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            reset();
+            data_ = std::exchange(rhs.data_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+        }
+        return *this;
+    }
+
+    mapped_memory::~mapped_memory()
+    {
+        reset();
+    }
+
+    void mapped_memory::reset() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    mapped_memory mapped_memory::create(
+        std::string const& name, std::size_t size, std::error_code& ec)
+    {
+        int const fd = ::shm_open(
+            name.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+        if (fd == -1)
+        {
+            ec = last_error();
+            return {};
+        }
+
+        mapped_memory result;
+        if (::ftruncate(fd, static_cast<off_t>(size)) == 0)
+        {
+            result.data_ = map(fd, size, PROT_READ | PROT_WRITE, ec);
+            result.size_ = size;
+        }
+        else
+        {
+            ec = last_error();
+        }
+
+        ::close(fd);
+        if (!result)
+        {
+            ::shm_unlink(name.c_str());
+        }
+        return result;
+    }
+
+    mapped_memory mapped_memory::open(
+        std::string const& name, std::error_code& ec)
+    {
+        int const fd = ::shm_open(name.c_str(), O_RDWR | O_CLOEXEC, 0);
+        if (fd == -1)
+        {
+            ec = last_error();
+            return {};
+        }
+
+        mapped_memory result;
+        struct stat st = {};
+        if (::fstat(fd, &st) != 0)
+        {
+            ec = last_error();
+        }
+        else if (st.st_size == 0)
+        {
+            // the creator of the object has not set its size yet
+            ec = std::make_error_code(
+                std::errc::resource_unavailable_try_again);
+        }
+        else
+        {
+            result.size_ = static_cast<std::size_t>(st.st_size);
+            result.data_ = map(fd, result.size_, PROT_READ | PROT_WRITE, ec);
+        }
+
+        ::close(fd);
+        return result;
+    }
+
+    void mapped_memory::unlink(std::string const& name) noexcept
+    {
+        ::shm_unlink(name.c_str());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+        "the shared memory parcelport requires lock-free 64 bit atomics");
+
+    namespace {
+
+        // marks the remainder of the buffer as unused
+        constexpr std::uint64_t wrap_marker = ~static_cast<std::uint64_t>(0);
+    }    // namespace
+
+    struct message_ring::header
+    {
+        // the consumer and the producer positions (in bytes since the ring
+        // was created) are kept on separate cache lines
+        alignas(64) std::atomic<std::uint64_t> head;
+        alignas(64) std::atomic<std::uint64_t> tail;
+        alignas(64) std::atomic<std::uint32_t> closed;
+        std::int32_t producer_pid;
+        std::uint64_t capacity;
+    };
+
+    std::size_t message_ring::memory_size(std::size_t capacity) noexcept
+    {
+        return sizeof(header) + align_payload(capacity);
+    }
+
+    void message_ring::initialize(
+        void* memory, std::size_t size, std::int32_t producer_pid) noexcept
+    {
+        HPX_ASSERT(size > sizeof(header));
+
+        auto* h = new (memory) header;
+        h->head.store(0, std::memory_order_relaxed);
+        h->tail.store(0, std::memory_order_relaxed);
+        h->closed.store(0, std::memory_order_relaxed);
+        h->producer_pid = producer_pid;
+        h->capacity = (size - sizeof(header)) & ~(payload_alignment - 1);
+
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    message_ring::message_ring(void* memory) noexcept
+      : header_(static_cast<header*>(memory))
+      , data_(static_cast<char*>(memory) + sizeof(header))
+    {
+    }
+
+    void* message_ring::try_reserve(std::size_t size) noexcept
+    {
+        std::size_t const capacity = header_->capacity;
+        std::size_t const record = sizeof(std::uint64_t) + align_payload(size);
+        HPX_ASSERT(record <= capacity);
+
+        std::uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+        std::uint64_t const head =
+            header_->head.load(std::memory_order_acquire);
+
+        std::size_t offset = tail % capacity;
+        std::size_t const contiguous = capacity - offset;
+        std::size_t const needed =
+            contiguous < record ? contiguous + record : record;
+
+        if (capacity - (tail - head) < needed)
+        {
+            return nullptr;
+        }
+
+        if (contiguous < record)
+        {
+            // skip the remainder of the buffer, the marker becomes visible
+            // together with the record
+            std::memcpy(data_ + offset, &wrap_marker, sizeof(wrap_marker));
+            tail += contiguous;
+            offset = 0;
+        }
+
+        auto const length = static_cast<std::uint64_t>(size);
+        std::memcpy(data_ + offset, &length, sizeof(length));
+
+        pending_ = tail + record;
+        return data_ + offset + sizeof(std::uint64_t);
+    }
+
+    void message_ring::commit() noexcept
+    {
+        header_->tail.store(pending_, std::memory_order_release);
+    }
+
+    std::uint64_t message_ring::committed() const noexcept
+    {
+        return header_->tail.load(std::memory_order_relaxed);
+    }
+
+    void message_ring::close() noexcept
+    {
+        header_->closed.store(1, std::memory_order_release);
+    }
+
+    std::pair<void const*, std::size_t> message_ring::try_peek() noexcept
+    {
+        std::uint64_t head = header_->head.load(std::memory_order_relaxed);
+        std::uint64_t const tail =
+            header_->tail.load(std::memory_order_acquire);
+        if (head == tail)
+        {
+            return {nullptr, 0};
+        }
+
+        std::size_t const capacity = header_->capacity;
+        std::size_t offset = head % capacity;
+
+        std::uint64_t length = 0;
+        std::memcpy(&length, data_ + offset, sizeof(length));
+        if (length == wrap_marker)
+        {
+            head += capacity - offset;
+            offset = 0;
+            std::memcpy(&length, data_, sizeof(length));
+        }
+        HPX_ASSERT(head != tail);
+
+        pending_ = head + sizeof(std::uint64_t) +
+            align_payload(static_cast<std::size_t>(length));
+        return {data_ + offset + sizeof(std::uint64_t),
+            static_cast<std::size_t>(length)};
+    }
+
+    void message_ring::release() noexcept
+    {
+        header_->head.store(pending_, std::memory_order_release);
+    }
+
+    std::uint64_t message_ring::released() const noexcept
+    {
+        return header_->head.load(std::memory_order_acquire);
+    }
+
+    bool message_ring::is_closed() const noexcept
+    {
+        return header_->closed.load(std::memory_order_acquire) != 0 &&
+            header_->head.load(std::memory_order_relaxed) ==
+            header_->tail.load(std::memory_order_acquire);
+    }
+
+    std::size_t message_ring::capacity() const noexcept
+    {
+        return header_->capacity;
+    }
+
+    std::int32_t message_ring::producer_pid() const noexcept
+    {
+        return header_->producer_pid;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t payload_pool_offset(std::size_t ring_capacity) noexcept
+    {
+        // the pool starts on a separate cache line
+        constexpr std::size_t cache_line = 64;
+        return (message_ring::memory_size(ring_capacity) + cache_line - 1) &
+            ~(cache_line - 1);
+    }
+
+    std::size_t segment_size(
+        std::size_t ring_capacity, std::size_t pool_size) noexcept
+    {
+        return payload_pool_offset(ring_capacity) + align_payload(pool_size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    payload_pool::payload_pool(
+        void* memory, std::size_t size, message_ring const& ring) noexcept
+      : data_(static_cast<char*>(memory))
+      , capacity_(size & ~(payload_alignment - 1))
+      , ring_(ring)
+    {
+    }
+
+    void* payload_pool::allocate(std::size_t size) noexcept
+    {
+        std::size_t const block_size = align_payload(size);
+        if (block_size == 0 || block_size > capacity_)
+        {
+            return nullptr;
+        }
+
+        release();
+
+        // blocks are contiguous, a block which does not fit before the end
+        // of the pool starts at its beginning
+        std::uint64_t begin = tail_;
+        std::size_t const offset = tail_ % capacity_;
+        if (capacity_ - offset < block_size)
+        {
+            begin += capacity_ - offset;
+        }
+
+        std::uint64_t const end = begin + block_size;
+        if (end - head_ > capacity_)
+        {
+            return nullptr;
+        }
+
+        blocks_.push_back(block{begin, end, 0, block_state::allocated});
+        tail_ = end;
+        return data_ + begin % capacity_;
+    }
+
+    payload_pool::block* payload_pool::find(void const* p) noexcept
+    {
+        // the block searched for is usually one of the last ones allocated
+        std::uint64_t const offset = this->offset(p);
+        for (auto it = blocks_.rbegin(); it != blocks_.rend(); ++it)
+        {
+            if (it->state != block_state::released &&
+                it->begin % capacity_ == offset)
+            {
+                return &*it;
+            }
+        }
+        return nullptr;
+    }
+
+    void payload_pool::deallocate(void* p) noexcept
+    {
+        block* b = find(p);
+        HPX_ASSERT(b != nullptr);
+        if (b != nullptr && b->state == block_state::allocated)
+        {
+            b->state = block_state::released;
+            release();
+        }
+    }
+
+    void payload_pool::commit(void const* p, std::uint64_t position) noexcept
+    {
+        block* b = find(p);
+        HPX_ASSERT(b != nullptr && b->state == block_state::allocated);
+        b->state = block_state::committed;
+        b->position = position;
+    }
+
+    void payload_pool::release() noexcept
+    {
+        if (blocks_.empty())
+        {
+            return;
+        }
+
+        std::uint64_t const released = ring_.released();
+        while (!blocks_.empty())
+        {
+            block const& b = blocks_.front();
+            if (b.state == block_state::allocated ||
+                (b.state == block_state::committed && b.position > released))
+            {
+                break;
+            }
+            head_ = b.end;
+            blocks_.pop_front();
+        }
+
+        // start over at the beginning of the pool once it is empty, this
+        // leaves the most room for large blocks
+        if (blocks_.empty())
+        {
+            head_ = tail_ = 0;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        enum slot_state : std::uint32_t
+        {
+            slot_free = 0,
+            slot_claimed = 1,
+            slot_ready = 2
+        };
+
+        struct inbox_slot
+        {
+            std::atomic<std::uint32_t> state;
+            char name[inbox::max_name_length + 1];
+        };
+
+        static_assert(sizeof(inbox_slot) == 64);
+    }    // namespace
+
+    struct inbox::header
+    {
+        alignas(64) std::atomic<std::uint64_t> announcements;
+        alignas(64) inbox_slot slots[num_slots];
+    };
+
+    std::size_t inbox::memory_size() noexcept
+    {
+        return sizeof(header);
+    }
+
+    void inbox::initialize(void* memory) noexcept
+    {
+        auto* h = new (memory) header;
+        h->announcements.store(0, std::memory_order_relaxed);
+        for (inbox_slot& slot : h->slots)
+        {
+            slot.state.store(slot_free, std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    inbox::inbox(void* memory) noexcept
+      : header_(static_cast<header*>(memory))
+    {
+    }
+
+    bool inbox::announce(std::string const& name) noexcept
+    {
+        HPX_ASSERT(name.size() <= max_name_length);
+
+        for (inbox_slot& slot : header_->slots)
+        {
+            std::uint32_t expected = slot_free;
+            if (slot.state.compare_exchange_strong(expected, slot_claimed,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                std::memset(slot.name, 0, sizeof(slot.name));
+                std::memcpy(slot.name, name.data(), name.size());
+                slot.state.store(slot_ready, std::memory_order_release);
+
+                header_->announcements.fetch_add(1, std::memory_order_release);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::uint64_t inbox::announcements() const noexcept
+    {
+        return header_->announcements.load(std::memory_order_acquire);
+    }
+
+    bool inbox::take(std::size_t slot, std::string& name) noexcept
+    {
+        inbox_slot& s = header_->slots[slot];
+        if (s.state.load(std::memory_order_acquire) != slot_ready)
+        {
+            return false;
+        }
+
+        name.assign(s.name, ::strnlen(s.name, sizeof(s.name)));
+        s.state.store(slot_free, std::memory_order_release);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        std::string to_hex(std::uint64_t value)
+        {
+            char buffer[17] = {};
+            constexpr char digits[] = "0123456789abcdef";
+            for (int i = 15; i >= 0; --i, value >>= 4)
+            {
+                buffer[i] = digits[value & 0xf];
+            }
+            return buffer;
+        }
+    }    // namespace
+
+    std::string inbox_name(locality const& l)
+    {
+        return "/hpx-shm-" + std::to_string(l.pid()) + "-" + to_hex(l.token());
+    }
+
+    std::string connection_name(locality const& here, std::uint64_t sequence)
+    {
+        return inbox_name(here) + "-" + to_hex(sequence);
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
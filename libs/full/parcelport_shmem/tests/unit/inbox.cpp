@@ -0,0 +1,191 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstddef>
+#include <set>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using hpx::parcelset::policies::shmem::inbox;
+using hpx::parcelset::policies::shmem::mapped_memory;
+
+///////////////////////////////////////////////////////////////////////////////
+mapped_memory create_inbox()
+{
+    std::string const name =
+        "/hpx-shm-inbox-test-" + std::to_string(::getpid());
+
+    std::error_code ec;
+    mapped_memory memory =
+        mapped_memory::create(name, inbox::memory_size(), ec);
+    HPX_TEST(!ec);
+
+    // the memory stays mapped
+    mapped_memory::unlink(name);
+
+    inbox::initialize(memory.data());
+    return memory;
+}
+
+std::string connection(std::size_t producer, std::size_t sequence)
+{
+    return "/connection-" + std::to_string(producer) + "-" +
+        std::to_string(sequence);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_announce()
+{
+    mapped_memory memory = create_inbox();
+    inbox receiver(memory.data());
+    inbox sender(memory.data());
+
+    std::vector<std::string> accepted;
+    auto const accept = [&](std::string const& name) {
+        accepted.push_back(name);
+    };
+
+    // nothing has been announced yet
+    receiver.accept(accept);
+    HPX_TEST(accepted.empty());
+
+    HPX_TEST(sender.announce(connection(0, 0)));
+    HPX_TEST(sender.announce(connection(0, 1)));
+
+    receiver.accept(accept);
+    HPX_TEST_EQ(accepted.size(), std::size_t(2));
+    HPX_TEST(std::set<std::string>(accepted.begin(), accepted.end()) ==
+        (std::set<std::string>{connection(0, 0), connection(0, 1)}));
+
+    // a connection is accepted only once
+    accepted.clear();
+    receiver.accept(accept);
+    HPX_TEST(accepted.empty());
+
+    // names of the maximal length are passed completely
+    std::string const name(inbox::max_name_length, 'x');
+    HPX_TEST(sender.announce(name));
+
+    receiver.accept(accept);
+    HPX_TEST_EQ(accepted.size(), std::size_t(1));
+    HPX_TEST_EQ(accepted.front(), name);
+}
+
+void test_full_inbox()
+{
+    mapped_memory memory = create_inbox();
+    inbox receiver(memory.data());
+    inbox sender(memory.data());
+
+    for (std::size_t i = 0; i != inbox::num_slots; ++i)
+    {
+        HPX_TEST(sender.announce(connection(0, i)));
+    }
+
+    // all slots are in use until the connections have been accepted
+    HPX_TEST(!sender.announce(connection(0, inbox::num_slots)));
+
+    std::set<std::string> accepted;
+    receiver.accept(
+        [&](std::string const& name) { accepted.insert(name); });
+    HPX_TEST_EQ(accepted.size(), inbox::num_slots);
+
+    // the slots are reused
+    HPX_TEST(sender.announce(connection(0, inbox::num_slots)));
+
+    accepted.clear();
+    receiver.accept(
+        [&](std::string const& name) { accepted.insert(name); });
+    HPX_TEST_EQ(accepted.size(), std::size_t(1));
+    HPX_TEST(accepted.count(connection(0, inbox::num_slots)) == 1);
+}
+
+void test_concurrent_announcements()
+{
+    // more connections than slots are announced concurrently
+    constexpr std::size_t num_producers = 4;
+    constexpr std::size_t num_connections = 1000;
+
+    mapped_memory memory = create_inbox();
+
+    std::atomic<std::size_t> running(num_producers);
+    std::vector<std::thread> producers;
+    for (std::size_t p = 0; p != num_producers; ++p)
+    {
+        producers.emplace_back([&, p]() {
+            inbox sender(memory.data());
+            for (std::size_t i = 0; i != num_connections; ++i)
+            {
+                while (!sender.announce(connection(p, i)))
+                {
+                    std::this_thread::yield();
+                }
+            }
+            --running;
+        });
+    }
+
+    inbox receiver(memory.data());
+
+    std::set<std::string> accepted;
+    std::size_t duplicates = 0;
+    auto const accept = [&](std::string const& name) {
+        if (!accepted.insert(name).second)
+        {
+            ++duplicates;
+        }
+    };
+
+    while (running.load() != 0)
+    {
+        receiver.accept(accept);
+        std::this_thread::yield();
+    }
+
+    for (std::thread& t : producers)
+    {
+        t.join();
+    }
+
+    // pick up the connections announced last
+    receiver.accept(accept);
+
+    HPX_TEST_EQ(duplicates, std::size_t(0));
+    HPX_TEST_EQ(accepted.size(), num_producers * num_connections);
+    for (std::size_t p = 0; p != num_producers; ++p)
+    {
+        for (std::size_t i = 0; i != num_connections; ++i)
+        {
+            HPX_TEST(accepted.count(connection(p, i)) == 1);
+        }
+    }
+}
+
+int main()
+{
+    test_announce();
+    test_full_inbox();
+    test_concurrent_announcements();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
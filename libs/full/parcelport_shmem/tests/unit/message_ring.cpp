@@ -0,0 +1,330 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <thread>
+
+using hpx::parcelset::policies::shmem::align_payload;
+using hpx::parcelset::policies::shmem::mapped_memory;
+using hpx::parcelset::policies::shmem::message_ring;
+
+///////////////////////////////////////////////////////////////////////////////
+// create a new (zero-initialized) ring of the given capacity
+mapped_memory create_ring(std::size_t capacity)
+{
+    std::string const name =
+        "/hpx-shm-message-ring-test-" + std::to_string(::getpid());
+
+    std::error_code ec;
+    mapped_memory memory = mapped_memory::create(
+        name, message_ring::memory_size(capacity), ec);
+    HPX_TEST(!ec);
+
+    // the memory stays mapped
+    mapped_memory::unlink(name);
+
+    message_ring::initialize(memory.data(),
+        message_ring::memory_size(capacity),
+        static_cast<std::int32_t>(::getpid()));
+    return memory;
+}
+
+// the contents of a record, derived from its sequence number
+void fill_record(void* record, std::size_t size, std::uint64_t sequence)
+{
+    auto* data = static_cast<unsigned char*>(record);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        data[i] = static_cast<unsigned char>(sequence + i);
+    }
+}
+
+bool check_record(void const* record, std::size_t size, std::uint64_t sequence)
+{
+    auto const* data = static_cast<unsigned char const*>(record);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        if (data[i] != static_cast<unsigned char>(sequence + i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// the record sizes vary, which makes the records end at different offsets
+std::size_t record_size(std::uint64_t sequence)
+{
+    return 1 + static_cast<std::size_t>(sequence * 7 % 100);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_empty_ring()
+{
+    mapped_memory memory = create_ring(1024);
+    message_ring ring(memory.data());
+
+    HPX_TEST_EQ(ring.capacity(), std::size_t(1024));
+    HPX_TEST_EQ(ring.producer_pid(), static_cast<std::int32_t>(::getpid()));
+    HPX_TEST(ring.try_peek().first == nullptr);
+    HPX_TEST(!ring.is_closed());
+
+    // a reserved record is not visible before it has been committed
+    void* record = ring.try_reserve(16);
+    HPX_TEST(record != nullptr);
+    HPX_TEST(ring.try_peek().first == nullptr);
+
+    fill_record(record, 16, 0);
+    ring.commit();
+
+    auto const [data, size] = ring.try_peek();
+    HPX_TEST(data != nullptr);
+    HPX_TEST_EQ(size, std::size_t(16));
+    HPX_TEST(check_record(data, size, 0));
+
+    ring.release();
+    HPX_TEST(ring.try_peek().first == nullptr);
+    HPX_TEST_EQ(ring.released(), ring.committed());
+}
+
+void test_wrap_around()
+{
+    // a small ring makes the records wrap around many times
+    mapped_memory memory = create_ring(256);
+    message_ring producer(memory.data());
+    message_ring consumer(memory.data());
+
+    for (std::uint64_t sequence = 0; sequence != 1000; ++sequence)
+    {
+        std::size_t const size = record_size(sequence);
+
+        void* record = producer.try_reserve(size);
+        HPX_TEST(record != nullptr);
+        if (record == nullptr)
+        {
+            return;
+        }
+
+        // records are always contiguous
+        HPX_TEST(static_cast<char*>(record) + size <=
+            static_cast<char*>(memory.data()) +
+                message_ring::memory_size(256));
+
+        fill_record(record, size, sequence);
+        producer.commit();
+
+        auto const [data, received] = consumer.try_peek();
+        HPX_TEST(data != nullptr);
+        HPX_TEST_EQ(received, size);
+        HPX_TEST(check_record(data, received, sequence));
+        consumer.release();
+    }
+
+    HPX_TEST(consumer.try_peek().first == nullptr);
+
+    // the positions count all bytes since the ring was created
+    HPX_TEST_EQ(consumer.released(), producer.committed());
+    HPX_TEST(producer.committed() > 10 * producer.capacity());
+}
+
+void test_full_ring()
+{
+    mapped_memory memory = create_ring(1024);
+    message_ring producer(memory.data());
+    message_ring consumer(memory.data());
+
+    // each record takes up 64 bytes including its length
+    constexpr std::size_t size = 56;
+    std::size_t const record = sizeof(std::uint64_t) + align_payload(size);
+
+    std::uint64_t written = 0;
+    while (void* data = producer.try_reserve(size))
+    {
+        fill_record(data, size, written++);
+        producer.commit();
+    }
+    HPX_TEST_EQ(written, producer.capacity() / record);
+
+    // the ring stays full until the consumer releases a record
+    HPX_TEST(producer.try_reserve(size) == nullptr);
+
+    std::uint64_t read = 0;
+    {
+        auto const [data, received] = consumer.try_peek();
+        HPX_TEST(data != nullptr);
+        HPX_TEST(check_record(data, received, read++));
+    }
+    HPX_TEST(producer.try_reserve(size) == nullptr);
+
+    consumer.release();
+
+    void* data = producer.try_reserve(size);
+    HPX_TEST(data != nullptr);
+    fill_record(data, size, written++);
+    producer.commit();
+
+    // the ring is full again
+    HPX_TEST(producer.try_reserve(2 * size) == nullptr);
+
+    // all records are received in order
+    while (true)
+    {
+        auto const [record_data, received] = consumer.try_peek();
+        if (record_data == nullptr)
+        {
+            break;
+        }
+        HPX_TEST_EQ(received, size);
+        HPX_TEST(check_record(record_data, received, read++));
+        consumer.release();
+    }
+    HPX_TEST_EQ(read, written);
+
+    HPX_TEST(producer.try_reserve(2 * size) != nullptr);
+}
+
+void test_wrap_marker()
+{
+    mapped_memory memory = create_ring(1024);
+    message_ring producer(memory.data());
+    message_ring consumer(memory.data());
+
+    // leave 64 bytes before the end of the buffer
+    void* first = nullptr;
+    for (std::uint64_t sequence = 0; sequence != 15; ++sequence)
+    {
+        void* data = producer.try_reserve(56);
+        HPX_TEST(data != nullptr);
+        if (sequence == 0)
+        {
+            first = data;
+        }
+        producer.commit();
+
+        HPX_TEST(consumer.try_peek().first != nullptr);
+        consumer.release();
+    }
+
+    // the record is placed at the beginning of the buffer, the consumer
+    // skips the remainder of the buffer
+    void* data = producer.try_reserve(120);
+    HPX_TEST_EQ(data, first);
+    fill_record(data, 120, 42);
+    producer.commit();
+
+    auto const [record, size] = consumer.try_peek();
+    HPX_TEST_EQ(record, static_cast<void const*>(data));
+    HPX_TEST_EQ(size, std::size_t(120));
+    HPX_TEST(check_record(record, size, 42));
+    consumer.release();
+
+    // the skipped bytes count as used
+    HPX_TEST_EQ(consumer.released(), std::uint64_t(1024 + 128));
+}
+
+void test_close()
+{
+    mapped_memory memory = create_ring(1024);
+    message_ring producer(memory.data());
+    message_ring consumer(memory.data());
+
+    void* data = producer.try_reserve(8);
+    HPX_TEST(data != nullptr);
+    fill_record(data, 8, 0);
+    producer.commit();
+    producer.close();
+
+    // the ring is closed once all records have been received
+    HPX_TEST(!consumer.is_closed());
+
+    auto const [record, size] = consumer.try_peek();
+    HPX_TEST(record != nullptr);
+    HPX_TEST(check_record(record, size, 0));
+    consumer.release();
+
+    HPX_TEST(consumer.is_closed());
+}
+
+void test_concurrent_producer_consumer()
+{
+    constexpr std::uint64_t num_records = 100000;
+
+    mapped_memory memory = create_ring(4096);
+
+    std::thread producer_thread([&]() {
+        message_ring producer(memory.data());
+        for (std::uint64_t sequence = 0; sequence != num_records; ++sequence)
+        {
+            std::size_t const size = record_size(sequence);
+
+            void* record = nullptr;
+            while ((record = producer.try_reserve(size)) == nullptr)
+            {
+                std::this_thread::yield();
+            }
+
+            fill_record(record, size, sequence);
+            producer.commit();
+        }
+        producer.close();
+    });
+
+    message_ring consumer(memory.data());
+
+    std::uint64_t sequence = 0;
+    std::size_t errors = 0;
+    while (!consumer.is_closed())
+    {
+        auto const [record, size] = consumer.try_peek();
+        if (record == nullptr)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        if (size != record_size(sequence) ||
+            !check_record(record, size, sequence))
+        {
+            ++errors;
+        }
+        ++sequence;
+        consumer.release();
+    }
+
+    producer_thread.join();
+
+    HPX_TEST_EQ(sequence, num_records);
+    HPX_TEST_EQ(errors, std::size_t(0));
+}
+
+int main()
+{
+    test_empty_ring();
+    test_wrap_around();
+    test_full_ring();
+    test_wrap_marker();
+    test_close();
+    test_concurrent_producer_consumer();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,242 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using hpx::parcelset::policies::shmem::mapped_memory;
+using hpx::parcelset::policies::shmem::message_ring;
+using hpx::parcelset::policies::shmem::payload_allocator;
+using hpx::parcelset::policies::shmem::payload_pool;
+using hpx::parcelset::policies::shmem::payload_pool_offset;
+using hpx::parcelset::policies::shmem::segment_size;
+
+constexpr std::size_t ring_capacity = 4096;
+constexpr std::size_t pool_size = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+// the segment of a connection, holding the ring buffer and the payload pool
+struct connection_segment
+{
+    connection_segment()
+    {
+        std::string const name =
+            "/hpx-shm-payload-pool-test-" + std::to_string(::getpid());
+
+        std::error_code ec;
+        memory = mapped_memory::create(
+            name, segment_size(ring_capacity, pool_size), ec);
+        HPX_TEST(!ec);
+
+        // the memory stays mapped
+        mapped_memory::unlink(name);
+
+        message_ring::initialize(memory.data(),
+            message_ring::memory_size(ring_capacity),
+            static_cast<std::int32_t>(::getpid()));
+        producer = message_ring(memory.data());
+        consumer = message_ring(memory.data());
+
+        std::size_t const offset = payload_pool_offset(ring_capacity);
+        pool = payload_pool(static_cast<char*>(memory.data()) + offset,
+            memory.size() - offset, producer);
+    }
+
+    // write a message referencing the given block
+    void send(void* block)
+    {
+        HPX_TEST(producer.try_reserve(8) != nullptr);
+        producer.commit();
+        pool.commit(block, producer.committed());
+    }
+
+    // receive the next message
+    void receive()
+    {
+        HPX_TEST(consumer.try_peek().first != nullptr);
+        consumer.release();
+    }
+
+    mapped_memory memory;
+    message_ring producer;
+    message_ring consumer;
+    payload_pool pool;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_allocate()
+{
+    connection_segment segment;
+    payload_pool& pool = segment.pool;
+
+    HPX_TEST_EQ(pool.capacity(), pool_size);
+
+    char* pool_begin =
+        static_cast<char*>(segment.memory.data()) +
+        payload_pool_offset(ring_capacity);
+
+    // the blocks are placed one after the other
+    void* b1 = pool.allocate(1000);
+    void* b2 = pool.allocate(1000);
+    HPX_TEST_EQ(b1, static_cast<void*>(pool_begin));
+    HPX_TEST_EQ(b2, static_cast<void*>(pool_begin + 1000));
+    HPX_TEST(pool.contains(b1) && pool.contains(b2));
+    HPX_TEST_EQ(pool.offset(b2), std::uint64_t(1000));
+    HPX_TEST_EQ(pool.size(), std::size_t(2));
+
+    // blocks which do not fit are not allocated
+    HPX_TEST(pool.allocate(pool_size + 1) == nullptr);
+    HPX_TEST(pool.allocate(2500) == nullptr);
+    HPX_TEST(pool.size() == 2);
+
+    // the pool starts over once all blocks have been released
+    pool.deallocate(b1);
+    pool.deallocate(b2);
+    HPX_TEST_EQ(pool.size(), std::size_t(0));
+    HPX_TEST_EQ(pool.allocate(pool_size), static_cast<void*>(pool_begin));
+}
+
+void test_fifo_release()
+{
+    connection_segment segment;
+    payload_pool& pool = segment.pool;
+
+    void* b1 = pool.allocate(1024);
+    void* b2 = pool.allocate(1024);
+    void* b3 = pool.allocate(1024);
+    HPX_TEST(b1 != nullptr && b2 != nullptr && b3 != nullptr);
+
+    // the memory of a block is reused only once all blocks allocated before
+    // it have been released as well
+    pool.deallocate(b2);
+    HPX_TEST_EQ(pool.size(), std::size_t(3));
+    HPX_TEST(pool.allocate(2048) == nullptr);
+
+    pool.deallocate(b1);
+    HPX_TEST_EQ(pool.size(), std::size_t(1));
+
+    // the block does not fit before the end of the pool, thus it starts at
+    // the beginning
+    void* b4 = pool.allocate(2048);
+    HPX_TEST_EQ(b4, b1);
+
+    pool.deallocate(b3);
+    pool.deallocate(b4);
+    HPX_TEST_EQ(pool.size(), std::size_t(0));
+}
+
+void test_committed_blocks()
+{
+    connection_segment segment;
+    payload_pool& pool = segment.pool;
+
+    void* b1 = pool.allocate(2048);
+    void* b2 = pool.allocate(2048);
+    segment.send(b1);
+    segment.send(b2);
+
+    // the blocks referenced by messages are kept until the receiver has
+    // released the messages
+    pool.deallocate(b1);
+    pool.release();
+    HPX_TEST_EQ(pool.size(), std::size_t(2));
+    HPX_TEST(pool.allocate(1) == nullptr);
+
+    segment.receive();
+    pool.release();
+    HPX_TEST_EQ(pool.size(), std::size_t(1));
+
+    void* b3 = pool.allocate(2048);
+    HPX_TEST_EQ(b3, b1);
+
+    // blocks are released when allocating as well
+    segment.send(b3);
+    segment.receive();
+    segment.receive();
+    HPX_TEST(pool.allocate(2048) != nullptr);
+    HPX_TEST_EQ(pool.size(), std::size_t(1));
+}
+
+void test_allocator()
+{
+    connection_segment segment;
+    payload_pool& pool = segment.pool;
+
+    using buffer_type = std::vector<char, payload_allocator<char>>;
+
+    // small buffers are allocated on the heap
+    buffer_type small(payload_allocator<char>(&pool, 256));
+    small.resize(256);
+    HPX_TEST(!pool.contains(small.data()));
+
+    // larger buffers are allocated from the pool
+    buffer_type large(payload_allocator<char>(&pool, 256));
+    large.reserve(1024);
+    HPX_TEST(pool.contains(large.data()));
+    HPX_TEST_EQ(pool.size(), std::size_t(1));
+
+    // the buffer is moved when it grows, buffers exceeding half of the pool
+    // are allocated on the heap
+    large.resize(1024, 'a');
+    large.resize(pool_size, 'b');
+    HPX_TEST(!pool.contains(large.data()));
+    HPX_TEST_EQ(large[1023], 'a');
+    HPX_TEST_EQ(large[1024], 'b');
+    HPX_TEST_EQ(pool.size(), std::size_t(0));
+
+    // the storage is handed back to the pool when the buffer is destroyed
+    {
+        buffer_type buffer(payload_allocator<char>(&pool, 256));
+        buffer.reserve(1024);
+        HPX_TEST(pool.contains(buffer.data()));
+        HPX_TEST_EQ(pool.size(), std::size_t(1));
+    }
+    HPX_TEST_EQ(pool.size(), std::size_t(0));
+
+    // the storage of a buffer referenced by a message is kept
+    {
+        buffer_type buffer(payload_allocator<char>(&pool, 256));
+        buffer.reserve(1024);
+        segment.send(buffer.data());
+    }
+    HPX_TEST_EQ(pool.size(), std::size_t(1));
+
+    segment.receive();
+    pool.release();
+    HPX_TEST_EQ(pool.size(), std::size_t(0));
+
+    // buffers without a pool are allocated on the heap
+    buffer_type buffer;
+    buffer.resize(pool_size);
+    HPX_TEST(!pool.contains(buffer.data()));
+}
+
+int main()
+{
+    test_allocate();
+    test_fifo_release();
+    test_committed_blocks();
+    test_allocator();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
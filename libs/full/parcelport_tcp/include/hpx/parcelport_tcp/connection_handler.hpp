@@ -13,8 +13,10 @@
 #include <hpx/config.hpp>
 
 #if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP)
+#include <hpx/parcelport_tcp/io_uring_service.hpp>
 #include <hpx/parcelport_tcp/locality.hpp>
 #include <hpx/parcelport_tcp/sender.hpp>
+#include <hpx/parcelport_tcp/stripe.hpp>
 #include <hpx/parcelset/parcelport_impl.hpp>
 #include <hpx/parcelset_base/locality.hpp>
 
@@ -24,7 +26,9 @@
 #include <asio/ip/host_name.hpp>
 #include <asio/ip/tcp.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <set>
 #include <string>
@@ -50,6 +54,7 @@ namespace hpx::parcelset {
         using do_background_work = std::false_type;
         using send_immediate_parcels = std::false_type;
         using is_connectionless = std::false_type;
+        using stripe_zero_copy_chunks = std::true_type;
 
         static constexpr const char* type() noexcept
         {
@@ -109,6 +114,27 @@ namespace hpx::parcelset {
 
             parcelset::locality create_locality() const override;
 
+            // Return the maximal number of messages that may be in flight on
+            // a connection without having been acknowledged (zero if
+            // streaming is disabled)
+            std::uint32_t streaming_window() const noexcept
+            {
+                return streaming_window_;
+            }
+
+            // Create the header of a new striped message, the message itself
+            // carries the first size bytes of its zero-copy data
+            stripe_header create_stripe_header(std::uint64_t size) noexcept
+            {
+                return stripe_header{stripe_source_, ++next_stripe_id_, 0, size};
+            }
+
+            // The striped messages being received by this locality
+            stripe_registry& stripes() noexcept
+            {
+                return stripes_;
+            }
+
         private:
             void handle_accept(std::error_code const& e,
                 std::shared_ptr<receiver> receiver_conn);
@@ -118,6 +144,21 @@ namespace hpx::parcelset {
             /// Acceptor used to listen for incoming connections.
             asio::ip::tcp::acceptor* acceptor_;
 
+            /// The streaming window configured for this locality
+            std::uint32_t streaming_window_;
+
+            /// The I/O backend used for writing parcels ("asio" or "io_uring"),
+            /// parcels are always read using asio
+            std::string backend_;
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            std::unique_ptr<io_uring_service> io_uring_;
+#endif
+
+            /// Identifies the striped messages sent by this locality
+            std::uint64_t const stripe_source_;
+            std::atomic<std::uint64_t> next_stripe_id_;
+            stripe_registry stripes_;
+
             /// The list of accepted connections
             mutable hpx::spinlock connections_mtx_;
 
@@ -0,0 +1,69 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP) &&        \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/modules/functional.hpp>
+
+#include <asio/buffer.hpp>
+#include <asio/io_context.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <system_error>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::policies::tcp {
+
+    // Performs gather-write operations on TCP sockets through an io_uring
+    // instance (Linux only). Write operations started while a submission is
+    // pending are handed to the kernel with a single system call. Completions
+    // are signaled through an eventfd that is watched by the given io_context,
+    // the completion handlers are invoked from the threads running it. Only
+    // the send path is covered, reading parcels and acknowledgments is left
+    // to asio.
+    class HPX_EXPORT io_uring_service
+    {
+    public:
+        using handler_type =
+            hpx::move_only_function<void(std::error_code const&, std::size_t)>;
+
+        // Throws std::system_error if io_uring is not supported by the system
+        explicit io_uring_service(
+            asio::io_context& io_service, unsigned entries = 256);
+        ~io_uring_service();
+
+        io_uring_service(io_uring_service const&) = delete;
+        io_uring_service(io_uring_service&&) = delete;
+        io_uring_service& operator=(io_uring_service const&) = delete;
+        io_uring_service& operator=(io_uring_service&&) = delete;
+
+        // Write all of the given buffers to the socket, the buffers have to
+        // stay valid until the handler has been invoked.
+        void async_write(int fd, std::vector<asio::const_buffer> const& buffers,
+            handler_type handler);
+
+        // Cancel all pending operations and stop watching for completions.
+        // The handlers of all operations which have not completed are
+        // invoked with operation_aborted once the kernel has released their
+        // buffers.
+        void stop();
+
+    private:
+        struct impl;
+        std::shared_ptr<impl> impl_;
+    };
+}    // namespace hpx::parcelset::policies::tcp
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
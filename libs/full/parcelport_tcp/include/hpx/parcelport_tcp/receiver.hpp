@@ -21,8 +21,10 @@
 #include <hpx/modules/timing.hpp>
 
 #include <hpx/parcelport_tcp/connection_handler.hpp>
+#include <hpx/parcelport_tcp/stripe.hpp>
 #include <hpx/parcelset/decode_parcels.hpp>
 #include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset/receive_buffer_pool.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 
 #if defined(WIN32) || defined(_WIN32) || defined(__WIN32__)
@@ -41,6 +43,7 @@
 #undef VT1
 #undef VT2
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -63,8 +66,16 @@ namespace hpx::parcelset::policies::tcp {
           : socket_(io_service)
           , max_inbound_size_(max_inbound_size)
           , ack_(false)
+          , window_(0)
+          , sequence_(0)
+          , received_sequence_(0)
+          , ack_sequence_(0)
+          , writing_ack_(false)
+          , message_type_(static_cast<std::uint32_t>(message_type::parcels))
           , parcelport_(parcelport)
           , operation_in_flight_(0)
+          , acks_in_flight_(0)
+          , pool_(&parcelport)
         {
         }
 
@@ -84,6 +95,32 @@ namespace hpx::parcelset::policies::tcp {
             return socket_;
         }
 
+        // Asynchronously negotiate the streaming window with the sending end
+        // (see sender::negotiate_streaming_window) and start reading messages
+        // afterwards.
+        template <typename Handler>
+        void async_negotiate_streaming_window(Handler handler)
+        {
+            std::unique_lock lk(mtx_);
+            if (!socket_.is_open())
+            {
+                lk.unlock();
+
+                // report this problem back to the handler
+                handler(
+                    asio::error::make_error_code(asio::error::not_connected));
+                return;
+            }
+
+            void (receiver::*f)(std::error_code const&, Handler) =
+                &receiver::handle_read_streaming_window<Handler>;
+
+            asio::async_read(socket_, asio::buffer(&window_, sizeof(window_)),
+                hpx::bind(f, shared_from_this(),
+                    placeholders::_1,    // error
+                    util::protect(handler)));
+        }
+
         // Asynchronously read a data structure from the socket.
         template <typename Handler>
         void async_read(Handler handler)
@@ -104,6 +141,11 @@ namespace hpx::parcelset::policies::tcp {
             // Issue a read operation to read the message size.
             using asio::buffer;
             std::vector<asio::mutable_buffer> buffers;
+            if (window_ != 0)
+            {
+                buffers.emplace_back(&sequence_, sizeof(sequence_));
+            }
+            buffers.emplace_back(&message_type_, sizeof(message_type_));
             buffers.emplace_back(&buffer_.size_, sizeof(buffer_.size_));
             buffers.emplace_back(
                 &buffer_.data_size_, sizeof(buffer_.data_size_));
@@ -140,24 +182,77 @@ namespace hpx::parcelset::policies::tcp {
 
         void shutdown()
         {
-            std::lock_guard lk(mtx_);
-
-            // gracefully and portably shutdown the socket
-            if (socket_.is_open())
             {
-                std::error_code ec;
-                socket_.shutdown(asio::ip::tcp::socket::shutdown_both, ec);
+                std::lock_guard lk(mtx_);
+
+                // gracefully and portably shutdown the socket
+                if (socket_.is_open())
+                {
+                    std::error_code ec;
+                    socket_.shutdown(asio::ip::tcp::socket::shutdown_both, ec);
 
-                // close the socket to give it back to the OS
-                socket_.close(ec);
+                    // close the socket to give it back to the OS
+                    socket_.close(ec);
+                }
             }
 
+            // pending operations will complete with an error now, their
+            // handlers may need to acquire the lock
             hpx::util::yield_while(
-                [this]() { return operation_in_flight_ != 0; },
+                [this]() {
+                    return operation_in_flight_ != 0 || acks_in_flight_ != 0;
+                },
                 "tcp::receiver::shutdown");
         }
 
     private:
+        template <typename Handler>
+        void handle_read_streaming_window(
+            std::error_code const& e, Handler handler)
+        {
+            if (e)
+            {
+                handler(e);
+                return;
+            }
+
+            // accept at most the locally configured window
+            window_ = (std::min)(window_, parcelport_.streaming_window());
+
+            void (receiver::*f)(std::error_code const&, Handler) =
+                &receiver::handle_write_streaming_window<Handler>;
+
+            std::unique_lock lk(mtx_);
+            if (!socket_.is_open())
+            {
+                lk.unlock();
+
+                // report this problem back to the handler
+                handler(
+                    asio::error::make_error_code(asio::error::not_connected));
+                return;
+            }
+
+            asio::async_write(socket_, asio::buffer(&window_, sizeof(window_)),
+                hpx::bind(f, shared_from_this(),
+                    placeholders::_1,    // error
+                    util::protect(handler)));
+        }
+
+        template <typename Handler>
+        void handle_write_streaming_window(
+            std::error_code const& e, Handler handler)
+        {
+            if (e)
+            {
+                handler(e);
+                return;
+            }
+
+            // start reading messages
+            async_read(handler);
+        }
+
         // Handle a completed read of the message size from the message header.
         template <typename Handler>
         void handle_read_header(std::error_code const& e,
@@ -170,6 +265,34 @@ namespace hpx::parcelset::policies::tcp {
             }
             else
             {
+                // streaming messages have to arrive in sequence
+                if (window_ != 0 && sequence_ != received_sequence_ + 1)
+                {
+                    handler(asio::error::make_error_code(
+                        asio::error::invalid_argument));
+                    return;
+                }
+
+                // striped messages carry zero-copy data, fragments only
+                // carry (part of) the zero-copy data of a striped message
+                bool const striped = message_type_ ==
+                    static_cast<std::uint32_t>(message_type::striped_parcels);
+                bool const fragment = message_type_ ==
+                    static_cast<std::uint32_t>(message_type::fragment);
+                if ((!striped && !fragment &&
+                        message_type_ !=
+                            static_cast<std::uint32_t>(
+                                message_type::parcels)) ||
+                    (striped && buffer_.num_chunks_.first == 0) ||
+                    (fragment &&
+                        (buffer_.num_chunks_.first != 0 ||
+                            buffer_.num_chunks_.second != 0)))
+                {
+                    handler(asio::error::make_error_code(
+                        asio::error::invalid_argument));
+                    return;
+                }
+
                 ++operation_in_flight_;
 
                 // Determine the length of the serialized data.
@@ -198,11 +321,28 @@ namespace hpx::parcelset::policies::tcp {
 
                 void (receiver::*f)(std::error_code const&, Handler);
 
-                if (num_zero_copy_chunks != 0)
+                if (fragment)
+                {
+                    buffers.emplace_back(&stripe_, sizeof(stripe_));
+
+                    // the fragment is copied into the buffers of its message
+                    buffer_.data_ =
+                        pool_.acquire(static_cast<std::size_t>(inbound_size));
+                    buffers.emplace_back(asio::buffer(buffer_.data_));
+
+                    // Start an asynchronous call to receive the fragment.
+                    f = &receiver::handle_read_fragment<Handler>;
+                }
+                else if (num_zero_copy_chunks != 0)
                 {
                     using transmission_chunk_type =
                         parcel_buffer_type::transmission_chunk_type;
 
+                    if (striped)
+                    {
+                        buffers.emplace_back(&stripe_, sizeof(stripe_));
+                    }
+
                     std::vector<transmission_chunk_type>& chunks =
                         buffer_.transmission_chunks_;
 
@@ -213,8 +353,8 @@ namespace hpx::parcelset::policies::tcp {
                         chunks.size() * sizeof(transmission_chunk_type));
 
                     // add main buffer holding data that was serialized normally
-                    buffer_.data_.resize(
-                        static_cast<std::size_t>(inbound_size));
+                    buffer_.data_ =
+                        pool_.acquire(static_cast<std::size_t>(inbound_size));
                     buffers.emplace_back(asio::buffer(buffer_.data_));
 
                     // Start an asynchronous call to receive the data.
@@ -223,8 +363,8 @@ namespace hpx::parcelset::policies::tcp {
                 else
                 {
                     // add main buffer holding data that was serialized normally
-                    buffer_.data_.resize(
-                        static_cast<std::size_t>(inbound_size));
+                    buffer_.data_ =
+                        pool_.acquire(static_cast<std::size_t>(inbound_size));
                     buffers.emplace_back(asio::buffer(buffer_.data_));
 
                     // Start an asynchronous call to receive the data.
@@ -265,8 +405,7 @@ namespace hpx::parcelset::policies::tcp {
             {
                 handler(e);
                 --operation_in_flight_;
-                buffer_ = parcel_buffer_type();
-                parcels_.clear();
+                recycle_buffers();
             }
             else
             {
@@ -338,7 +477,7 @@ namespace hpx::parcelset::policies::tcp {
                         auto const chunk_size = static_cast<std::size_t>(
                             buffer_.transmission_chunks_[i].second);
 
-                        chunk_buffers_[i].resize(chunk_size);
+                        chunk_buffers_[i] = pool_.acquire(chunk_size);
                         buffers.emplace_back(
                             chunk_buffers_[i].data(), chunk_size);
 
@@ -348,16 +487,54 @@ namespace hpx::parcelset::policies::tcp {
                     }
                 }
 
-                // Start an asynchronous call to receive the zero-copy data.
+                void (receiver::*f)(std::error_code const&, Handler) =
+                    &receiver::handle_read_data<Handler>;
+
+                bool const striped = message_type_ ==
+                    static_cast<std::uint32_t>(message_type::striped_parcels);
+                if (striped)
                 {
-                    void (receiver::*f)(std::error_code const&, Handler) =
-                        &receiver::handle_read_data<Handler>;
+                    // all of the zero-copy buffers receive the fragments sent
+                    // over other connections, only the first part of the data
+                    // is read from this connection
+                    stripe_registry::buffers_type targets;
+                    targets.reserve(buffers.size());
+
+                    std::vector<asio::mutable_buffer> local_buffers;
+                    std::size_t local_size =
+                        static_cast<std::size_t>(stripe_.size);
+                    for (asio::mutable_buffer const& b : buffers)
+                    {
+                        targets.emplace_back(
+                            static_cast<char*>(b.data()), b.size());
+                        if (local_size != 0)
+                        {
+                            std::size_t const count =
+                                (std::min)(local_size, b.size());
+                            local_buffers.emplace_back(b.data(), count);
+                            local_size -= count;
+                        }
+                    }
+
+                    parcelport_.stripes().add_message(
+                        stripe_, HPX_MOVE(targets));
+
+                    buffers = HPX_MOVE(local_buffers);
+                    f = &receiver::handle_read_striped_data<Handler>;
+                }
 
+                // Start an asynchronous call to receive the zero-copy data.
+                {
                     std::unique_lock lk(mtx_);
                     if (!socket_.is_open())
                     {
                         lk.unlock();
 
+                        if (striped)
+                        {
+                            parcelport_.stripes().remove_message(stripe_);
+                        }
+
                         // report this problem back to the handler
                         handler(asio::error::make_error_code(
                             asio::error::not_connected));
@@ -378,6 +555,38 @@ namespace hpx::parcelset::policies::tcp {
             }
         }
 
+        // Handle a completed read of the first part of the zero-copy data of
+        // a striped message, the message is handled as soon as all of its
+        // fragments have been received as well.
+        template <typename Handler>
+        void handle_read_striped_data(std::error_code const& e, Handler handler)
+        {
+            if (e)
+            {
+                parcelport_.stripes().remove_message(stripe_);
+                handle_read_data(e, handler);
+                return;
+            }
+
+            parcelport_.stripes().message_received(stripe_,
+                [this_ = shared_from_this(), handler](
+                    std::error_code const& ec) {
+                    this_->handle_read_data(ec, handler);
+                });
+        }
+
+        // Handle a completed read of a fragment of a striped message.
+        template <typename Handler>
+        void handle_read_fragment(std::error_code const& e, Handler handler)
+        {
+            if (!e)
+            {
+                parcelport_.stripes().add_fragment(
+                    stripe_, buffer_.data_.data());
+            }
+            handle_read_data(e, handler);
+        }
+
         // Handle a completed read of message data.
         template <typename Handler>
         void handle_read_data(std::error_code const& e, Handler handler)
@@ -386,9 +595,7 @@ namespace hpx::parcelset::policies::tcp {
             {
                 handler(e);
                 --operation_in_flight_;
-                buffer_ = parcel_buffer_type();
-                parcels_.clear();
-                chunk_buffers_.clear();
+                recycle_buffers();
             }
             else
             {
@@ -401,20 +608,40 @@ namespace hpx::parcelset::policies::tcp {
                 void (receiver::*f)(std::error_code const&, Handler) =
                     &receiver::handle_write_ack<Handler>;
 
-                if (parcels_.empty())
+                if (message_type_ ==
+                    static_cast<std::uint32_t>(message_type::fragment))
+                {
+                    // the fragment has been handed to its message already
+                }
+                else if (parcels_.empty())
                 {
-                    // decode and handle received data
+                    // decode and handle received data, the decoding reuses
+                    // the storage for the chunks and parcels of this
+                    // connection
                     HPX_ASSERT(buffer_.num_chunks_.first == 0 ||
                         !parcelport_.allow_zero_copy_receive_optimizations());
-                    handle_received_parcels(
-                        decode_parcels(parcelport_, HPX_MOVE(buffer_)));
+                    decode_parcels(parcelport_, buffer_, chunks_, parcels_);
+                    handle_received_parcels(parcelport_, parcels_);
                 }
                 else
                 {
                     // handle the received zero-copy parcels.
                     HPX_ASSERT(buffer_.num_chunks_.first != 0 &&
                         parcelport_.allow_zero_copy_receive_optimizations());
-                    handle_received_parcels(HPX_MOVE(parcels_));
+                    handle_received_parcels(parcelport_, parcels_);
+                }
+
+                if (window_ != 0)
+                {
+                    // acknowledge the message without waiting for the write
+                    // to complete and continue reading right away
+                    --operation_in_flight_;
+
+                    recycle_buffers();
+
+                    async_write_ack(handler);
+                    async_read(handler);
+                    return;
                 }
 
                 ack_ = true;
@@ -448,9 +675,7 @@ namespace hpx::parcelset::policies::tcp {
             handler(e);
             --operation_in_flight_;
 
-            buffer_ = parcel_buffer_type();
-            parcels_.clear();
-            chunk_buffers_.clear();
+            recycle_buffers();
 
             // Issue a read operation to read the next parcel.
             if (!e)
@@ -459,6 +684,82 @@ namespace hpx::parcelset::policies::tcp {
             }
         }
 
+        // Hand the buffers of the message received last back to the pool.
+        // All other containers keep their storage for the next message.
+        void recycle_buffers() noexcept
+        {
+            pool_.release(buffer_.data_);
+            for (auto& b : chunk_buffers_)
+            {
+                pool_.release(b);
+            }
+            chunk_buffers_.clear();
+            parcels_.clear();
+            buffer_.clear();
+        }
+
+        // Acknowledgments in streaming mode are cumulative, at most one is
+        // being written at any time. Messages received while an acknowledgment
+        // is being written are acknowledged once the write has completed.
+        template <typename Handler>
+        void async_write_ack(Handler handler)
+        {
+            std::unique_lock lk(mtx_);
+            received_sequence_ = sequence_;
+
+            if (writing_ack_ || !socket_.is_open())
+            {
+                return;
+            }
+
+            writing_ack_ = true;
+            ++acks_in_flight_;
+
+            ack_sequence_ = received_sequence_;
+
+            void (receiver::*f)(std::error_code const&, Handler) =
+                &receiver::handle_write_streaming_ack<Handler>;
+
+            asio::async_write(socket_,
+                asio::buffer(&ack_sequence_, sizeof(ack_sequence_)),
+                hpx::bind(f, shared_from_this(),
+                    placeholders::_1,    // error,
+                    util::protect(handler)));
+        }
+
+        template <typename Handler>
+        void handle_write_streaming_ack(
+            std::error_code const& e, Handler handler)
+        {
+            HPX_ASSERT(acks_in_flight_ != 0);
+            if (e)
+            {
+                handler(e);
+                --acks_in_flight_;
+                return;
+            }
+
+            std::unique_lock lk(mtx_);
+            if (ack_sequence_ != received_sequence_ && socket_.is_open())
+            {
+                // acknowledge the messages received in the meantime
+                ack_sequence_ = received_sequence_;
+
+                void (receiver::*f)(std::error_code const&, Handler) =
+                    &receiver::handle_write_streaming_ack<Handler>;
+
+                asio::async_write(socket_,
+                    asio::buffer(&ack_sequence_, sizeof(ack_sequence_)),
+                    hpx::bind(f, shared_from_this(),
+                        placeholders::_1,    // error,
+                        util::protect(handler)));
+                return;
+            }
+
+            writing_ack_ = false;
+            --acks_in_flight_;
+        }
+
         // Socket for the parcelport_connection.
         asio::ip::tcp::socket socket_;
 
@@ -466,6 +767,21 @@ namespace hpx::parcelset::policies::tcp {
 
         bool ack_;
 
+        // streaming support: negotiated window (zero if disabled), sequence
+        // number of the message being received, of the last one received
+        // completely, and of the last one acknowledged
+        std::uint32_t window_;
+        std::uint64_t sequence_;
+        std::uint64_t received_sequence_;
+        std::uint64_t ack_sequence_;
+        bool writing_ack_;
+
+        // the kind of the message being received (see message_type) and,
+        // for striped messages and fragments, the part of the zero-copy data
+        // carried by it
+        std::uint32_t message_type_;
+        stripe_header stripe_;
+
         // The handler used to process the incoming request.
         connection_handler& parcelport_;
 
@@ -475,9 +791,14 @@ namespace hpx::parcelset::policies::tcp {
 #endif
         hpx::spinlock mtx_;
         hpx::util::atomic_count operation_in_flight_;
+        hpx::util::atomic_count acks_in_flight_;
 
         std::vector<parcelset::parcel> parcels_;
         std::vector<std::vector<char>> chunk_buffers_;
+        std::vector<serialization::serialization_chunk> chunks_;
+
+        // recycled buffers for the received message data
+        receive_buffer_pool<std::vector<char>> pool_;
     };
 }    // namespace hpx::parcelset::policies::tcp
 
@@ -16,10 +16,13 @@
 #include <hpx/modules/asio.hpp>
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/synchronization.hpp>
 #include <hpx/modules/threading_base.hpp>
 #include <hpx/modules/timing.hpp>
 
+#include <hpx/parcelport_tcp/io_uring_service.hpp>
 #include <hpx/parcelport_tcp/locality.hpp>
+#include <hpx/parcelport_tcp/stripe.hpp>
 #include <hpx/parcelset/parcelport_connection.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/gatherer.hpp>
@@ -42,8 +45,14 @@
 #undef VT1
 #undef VT2
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <system_error>
 #include <utility>
 #include <vector>
@@ -63,6 +72,18 @@ namespace hpx::parcelset::policies::tcp {
             [[maybe_unused]] parcelset::parcelport* pp)
           : socket_(io_service)
           , ack_(false)
+          , window_(0)
+          , sequence_(0)
+          , acked_sequence_(0)
+          , ack_sequence_(0)
+          , reading_acks_(false)
+          , window_exhausted_(false)
+          , outstanding_bytes_(0)
+          , message_bytes_(0)
+          , message_type_(static_cast<std::uint32_t>(message_type::parcels))
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+          , io_uring_(nullptr)
+#endif
           , there_(locality_id)
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
           , pp_(pp)
@@ -94,6 +115,64 @@ namespace hpx::parcelset::policies::tcp {
             return there_;
         }
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // Perform all writes of parcel data through the given io_uring
+        // instance instead of the asio reactor
+        void set_io_uring_service(io_uring_service* service) noexcept
+        {
+            io_uring_ = service;
+        }
+#endif
+
+        // Agree with the receiving end on the number of messages that may be
+        // in flight without having been acknowledged. A window of zero selects
+        // the stop-and-wait protocol (each message is acknowledged before the
+        // connection is reused). This is performed synchronously right after
+        // the connection has been established.
+        void negotiate_streaming_window(
+            std::uint32_t window, std::error_code& ec)
+        {
+            window_ = window;
+            asio::write(socket_, asio::buffer(&window_, sizeof(window_)), ec);
+            if (!ec)
+            {
+                asio::read(
+                    socket_, asio::buffer(&window_, sizeof(window_)), ec);
+            }
+            if (ec)
+            {
+                window_ = 0;
+            }
+        }
+
+        std::uint32_t streaming_window() const noexcept
+        {
+            return window_;
+        }
+
+        // The number of bytes written over this connection which have not
+        // been acknowledged by the receiving end yet. In streaming mode this
+        // includes the messages written after the connection has been handed
+        // back to the connection cache.
+        std::size_t outstanding_bytes() const noexcept
+        {
+            return outstanding_bytes_.load(std::memory_order_relaxed);
+        }
+
+        // Send only the first header.size bytes of the zero-copy data of the
+        // next message, the remaining bytes are sent as fragments over other
+        // connections (see async_write_fragment). The handlers of the parcels
+        // are invoked once all num_parts parts have been written.
+        void set_stripe(stripe_header const& header, std::size_t num_parts)
+        {
+            HPX_ASSERT(num_parts > 1 && !stripe_state_);
+
+            message_type_ =
+                static_cast<std::uint32_t>(message_type::striped_parcels);
+            stripe_ = header;
+            stripe_state_ = std::make_shared<stripe_state>(num_parts);
+        }
+
         void verify_(parcelset::locality const& parcel_locality_id) const
         {
 #if defined(HPX_DEBUG)
@@ -129,7 +208,20 @@ namespace hpx::parcelset::policies::tcp {
             HPX_ASSERT(!handler_);
             HPX_ASSERT(!postprocess_handler_);
 
-            handler_ = HPX_FORWARD(Handler, handler);
+            if (stripe_state_)
+            {
+                // the parcels (which own the zero-copy data) are released
+                // only after all parts of the message have been written
+                stripe_state_->set_handler(HPX_FORWARD(Handler, handler));
+                handler_ = [state = HPX_MOVE(stripe_state_)](
+                               std::error_code const& e) {
+                    state->part_written(e);
+                };
+            }
+            else
+            {
+                handler_ = HPX_FORWARD(Handler, handler);
+            }
             postprocess_handler_ =
                 HPX_FORWARD(ParcelPostprocess, parcel_postprocess);
             HPX_ASSERT(handler_);
@@ -144,19 +236,21 @@ namespace hpx::parcelset::policies::tcp {
 #endif
             // Write the serialized data to the socket. We use "gather-write"
             // to send both the header and the data in a single write operation.
-            std::vector<asio::const_buffer> buffers;
-            buffers.emplace_back(&buffer_.size_, sizeof(buffer_.size_));
-            buffers.emplace_back(
-                &buffer_.data_size_, sizeof(buffer_.data_size_));
+            bool const striped = message_type_ ==
+                static_cast<std::uint32_t>(message_type::striped_parcels);
 
-            // add chunk description
-            buffers.emplace_back(
-                &buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+            std::vector<asio::const_buffer> buffers;
+            add_message_header(buffers);
 
             std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
                 buffer_.transmission_chunks_;
             if (!chunks.empty())
             {
+                if (striped)
+                {
+                    buffers.emplace_back(&stripe_, sizeof(stripe_));
+                }
+
                 buffers.emplace_back(chunks.data(),
                     chunks.size() *
                         sizeof(parcel_buffer_type::transmission_chunk_type));
@@ -164,32 +258,174 @@ namespace hpx::parcelset::policies::tcp {
                 // add main buffer holding data which was serialized normally
                 buffers.emplace_back(asio::buffer(buffer_.data_));
 
-                // now add chunks themselves, those hold zero-copy serialized chunks
-                for (serialization::serialization_chunk& c : buffer_.chunks_)
-                {
-                    if (c.type_ ==
-                        serialization::chunk_type::chunk_type_pointer)
-                        buffers.emplace_back(c.data_.cpos_, c.size_);
-                }
+                // now add chunks themselves, those hold zero-copy serialized
+                // chunks (only the first part for striped messages)
+                std::size_t const zero_copy_size = striped ?
+                    static_cast<std::size_t>(stripe_.size) :
+                    (std::numeric_limits<std::size_t>::max)();
+                add_zero_copy_buffers(buffers, 0, zero_copy_size);
             }
             else
             {
+                HPX_ASSERT(!striped);
+
                 // add main buffer holding data which was serialized normally
                 buffers.emplace_back(asio::buffer(buffer_.data_));
             }
 
+            start_write(buffers);
+        }
+
+        // Write the bytes [offset, offset + size) of the zero-copy data of
+        // the given striped message. This has to be called after set_stripe
+        // but before async_write for the message. The receiving end copies
+        // the fragment into the buffers of the message.
+        template <typename ParcelPostprocess>
+        void async_write_fragment(sender const& message, std::size_t offset,
+            std::size_t size, ParcelPostprocess&& parcel_postprocess)
+        {
+            HPX_ASSERT(message.stripe_state_ && size != 0);
+            HPX_ASSERT(buffer_.data_.empty());
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+
+            // the data is owned by the parcels of the message
+            handler_ = [state = message.stripe_state_](
+                           std::error_code const& e) {
+                state->part_written(e);
+            };
+            postprocess_handler_ =
+                HPX_FORWARD(ParcelPostprocess, parcel_postprocess);
+
+            message_type_ = static_cast<std::uint32_t>(message_type::fragment);
+            stripe_ = message.stripe_;
+            stripe_.offset = offset;
+            stripe_.size = size;
+
+            buffer_.size_ = size;
+            buffer_.data_size_ = size;
+            buffer_.num_chunks_ = parcel_buffer_type::count_chunks_type(0, 0);
+
+            std::vector<asio::const_buffer> buffers;
+            add_message_header(buffers);
+            buffers.emplace_back(&stripe_, sizeof(stripe_));
+            message.add_zero_copy_buffers(buffers, offset, size);
+
+            start_write(buffers);
+        }
+
+    private:
+        // the part of the message header which is common to all messages
+        void add_message_header(std::vector<asio::const_buffer>& buffers)
+        {
+            message_bytes_ = buffers_size();
+            outstanding_bytes_ += message_bytes_;
+
+            if (window_ != 0)
+            {
+                // streaming messages carry their sequence number
+                {
+                    std::lock_guard l(mtx_);
+                    ++sequence_;
+                    unacked_bytes_.emplace_back(sequence_, message_bytes_);
+                }
+                buffers.emplace_back(&sequence_, sizeof(sequence_));
+            }
+            buffers.emplace_back(&message_type_, sizeof(message_type_));
+            buffers.emplace_back(&buffer_.size_, sizeof(buffer_.size_));
+            buffers.emplace_back(
+                &buffer_.data_size_, sizeof(buffer_.data_size_));
+
+            // add chunk description
+            buffers.emplace_back(
+                &buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+        }
+
+        // the number of bytes of the message about to be written
+        std::size_t buffers_size() const noexcept
+        {
+            if (message_type_ ==
+                static_cast<std::uint32_t>(message_type::fragment))
+            {
+                return static_cast<std::size_t>(stripe_.size);
+            }
+
+            std::size_t size = buffer_.data_.size();
+            if (message_type_ ==
+                static_cast<std::uint32_t>(message_type::striped_parcels))
+            {
+                return size + static_cast<std::size_t>(stripe_.size);
+            }
+            for (std::size_t i = 0; i != buffer_.num_chunks_.first; ++i)
+            {
+                size += static_cast<std::size_t>(
+                    buffer_.transmission_chunks_[i].second);
+            }
+            return size;
+        }
+
+        // Add the bytes [offset, offset + size) of the zero-copy chunks of
+        // this message, the chunks are treated as one contiguous range.
+        void add_zero_copy_buffers(std::vector<asio::const_buffer>& buffers,
+            std::size_t offset, std::size_t size) const
+        {
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (size == 0)
+                {
+                    break;
+                }
+                if (c.type_ != serialization::chunk_type::chunk_type_pointer)
+                {
+                    continue;
+                }
+                if (offset >= c.size_)
+                {
+                    offset -= c.size_;
+                    continue;
+                }
+
+                std::size_t const count = (std::min)(size, c.size_ - offset);
+                buffers.emplace_back(
+                    static_cast<char const*>(c.data_.cpos_) + offset, count);
+
+                size -= count;
+                offset = 0;
+            }
+        }
+
+        void start_write(std::vector<asio::const_buffer> const& buffers)
+        {
             // this additional wrapping of the handler into a bind object is
             // needed to keep  this parcelport_connection object alive for the
             // whole write operation
             void (sender::*f)(std::error_code const&, std::size_t) =
                 &sender::handle_write;
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (io_uring_ != nullptr)
+            {
+                io_uring_->async_write(socket_.native_handle(), buffers,
+                    hpx::bind(f, shared_from_this(), hpx::placeholders::_1,
+                        hpx::placeholders::_2));
+                return;
+            }
+#endif
             asio::async_write(socket_, buffers,
                 hpx::bind(f, shared_from_this(), hpx::placeholders::_1,
                     hpx::placeholders::_2));
         }
 
-    private:
+        // the written messages will not be acknowledged anymore
+        void release_outstanding_bytes() noexcept
+        {
+            {
+                std::lock_guard l(mtx_);
+                unacked_bytes_.clear();
+            }
+            outstanding_bytes_.store(0, std::memory_order_relaxed);
+        }
+
         static void reset_handler(postprocess_handler_type handler)
         {
             handler.reset();
@@ -201,6 +437,10 @@ namespace hpx::parcelset::policies::tcp {
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             state_ = state_handle_write;
 #endif
+            bool const fragment = message_type_ ==
+                static_cast<std::uint32_t>(message_type::fragment);
+            message_type_ = static_cast<std::uint32_t>(message_type::parcels);
+
             // just call initial handler
             handler_(e);
 
@@ -224,6 +464,8 @@ namespace hpx::parcelset::policies::tcp {
 
             if (e)
             {
+                release_outstanding_bytes();
+
                 // inform post-processing handler of error as well
                 hpx::move_only_function<void(std::error_code const&,
                     parcelset::locality const&, std::shared_ptr<sender>)>
@@ -233,13 +475,25 @@ namespace hpx::parcelset::policies::tcp {
                 return;
             }
 
-            // complete data point and push back onto gatherer
+            // complete data point and push back onto gatherer, fragments are
+            // accounted for by the message they belong to
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
-            buffer_.data_point_.time_ =
-                timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
-            pp_->add_sent_data(buffer_.data_point_);
+            if (!fragment)
+            {
+                buffer_.data_point_.time_ =
+                    timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+                pp_->add_sent_data(buffer_.data_point_);
+            }
+#else
+            HPX_UNUSED(fragment);
 #endif
 
+            if (window_ != 0)
+            {
+                handle_write_streaming();
+                return;
+            }
+
             // now handle the acknowledgment byte which is sent by the receiver
 #if defined(__linux) || defined(linux) || defined(__linux__)
             asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_QUICKACK>
@@ -261,6 +515,15 @@ namespace hpx::parcelset::policies::tcp {
 #endif
             buffer_.clear();
 
+            if (e)
+            {
+                release_outstanding_bytes();
+            }
+            else
+            {
+                outstanding_bytes_ -= message_bytes_;
+            }
+
             // Call post-processing handler, which will send remaining pending
             // parcels. Pass along the connection so it can be reused if more
             // parcels have to be sent.
@@ -271,11 +534,147 @@ namespace hpx::parcelset::policies::tcp {
             postprocess_handler(e, there_, shared_from_this());
         }
 
+        // In streaming mode the connection is handed back as soon as the
+        // message has been written, unless the window of unacknowledged
+        // messages is exhausted. In this case the hand-back is deferred until
+        // the receiver has acknowledged enough messages.
+        void handle_write_streaming()
+        {
+            buffer_.clear();
+
+            bool start_reading_acks = false;
+            bool window_exhausted = false;
+            {
+                std::lock_guard l(mtx_);
+                if (!reading_acks_)
+                {
+                    reading_acks_ = true;
+                    start_reading_acks = true;
+                }
+                if (sequence_ - acked_sequence_ >= window_)
+                {
+                    window_exhausted_ = true;
+                    window_exhausted = true;
+                }
+            }
+
+            if (start_reading_acks)
+            {
+                async_read_acks();
+            }
+
+            if (!window_exhausted)
+            {
+                hpx::move_only_function<void(std::error_code const&,
+                    parcelset::locality const&, std::shared_ptr<sender>)>
+                    postprocess_handler;
+                std::swap(postprocess_handler, postprocess_handler_);
+                postprocess_handler(std::error_code(), there_,
+                    shared_from_this());
+            }
+        }
+
+        // Acknowledgments are read only while there are unacknowledged
+        // messages, this avoids keeping idle connections alive.
+        void async_read_acks()
+        {
+            void (sender::*f)(std::error_code const&) =
+                &sender::handle_read_acks;
+
+            asio::async_read(socket_,
+                asio::buffer(&ack_sequence_, sizeof(ack_sequence_)),
+                hpx::bind(f, shared_from_this(), placeholders::_1));
+        }
+
+        // Acknowledgments are cumulative, each carries the sequence number of
+        // the last message handled by the receiver.
+        void handle_read_acks(std::error_code const& e)
+        {
+            bool continue_reading = false;
+            bool window_reopened = false;
+            {
+                std::lock_guard l(mtx_);
+                if (!e)
+                {
+                    HPX_ASSERT(ack_sequence_ <= sequence_);
+                    acked_sequence_ = ack_sequence_;
+                    continue_reading = acked_sequence_ != sequence_;
+
+                    std::size_t acked_bytes = 0;
+                    while (!unacked_bytes_.empty() &&
+                        unacked_bytes_.front().first <= acked_sequence_)
+                    {
+                        acked_bytes += unacked_bytes_.front().second;
+                        unacked_bytes_.pop_front();
+                    }
+                    outstanding_bytes_ -= acked_bytes;
+                }
+                else
+                {
+                    unacked_bytes_.clear();
+                    outstanding_bytes_.store(0, std::memory_order_relaxed);
+                }
+
+                if (window_exhausted_ &&
+                    (e || sequence_ - acked_sequence_ < window_))
+                {
+                    window_exhausted_ = false;
+                    window_reopened = true;
+                }
+                reading_acks_ = continue_reading;
+            }
+
+            if (continue_reading)
+            {
+                async_read_acks();
+            }
+
+            // hand back the connection if it was waiting for the window to
+            // reopen, errors are reported only in this case (otherwise the
+            // next write operation will fail)
+            if (window_reopened)
+            {
+                hpx::move_only_function<void(std::error_code const&,
+                    parcelset::locality const&, std::shared_ptr<sender>)>
+                    postprocess_handler;
+                std::swap(postprocess_handler, postprocess_handler_);
+                postprocess_handler(e, there_, shared_from_this());
+            }
+        }
+
         // Socket for the parcelport_connection.
         asio::ip::tcp::socket socket_;
 
         bool ack_;
 
+        // streaming support: negotiated window (zero if disabled), sequence
+        // number of the last message sent, and of the last acknowledged one
+        std::uint32_t window_;
+        std::uint64_t sequence_;
+        std::uint64_t acked_sequence_;
+        std::uint64_t ack_sequence_;
+        bool reading_acks_;
+        bool window_exhausted_;
+        hpx::spinlock mtx_;
+
+        // the bytes written but not acknowledged yet, the size of the message
+        // written last, and (streaming only) the size of each unacknowledged
+        // message
+        std::atomic<std::size_t> outstanding_bytes_;
+        std::size_t message_bytes_;
+        std::deque<std::pair<std::uint64_t, std::size_t>> unacked_bytes_;
+
+        // the kind of the message written last (see message_type) and, for
+        // striped messages and fragments, the part of the zero-copy data
+        // carried by it
+        std::uint32_t message_type_;
+        stripe_header stripe_;
+        std::shared_ptr<stripe_state> stripe_state_;
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        io_uring_service* io_uring_;
+#endif
+
         // the other (receiving) end of this connection
         parcelset::locality there_;
 
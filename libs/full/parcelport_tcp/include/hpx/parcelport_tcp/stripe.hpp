@@ -0,0 +1,172 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP)
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::policies::tcp {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The kinds of messages sent over a connection, the kind is sent right
+    // after the sequence number of the message (if any).
+    enum class message_type : std::uint32_t
+    {
+        // encoded parcels
+        parcels = 0,
+
+        // encoded parcels, part of their zero-copy data is sent over other
+        // connections to the same destination
+        striped_parcels = 1,
+
+        // part of the zero-copy data of a striped message
+        fragment = 2
+    };
+
+    // Identifies the part of the zero-copy data of a striped message which
+    // is carried by a message. The zero-copy chunks of a message are treated
+    // as one contiguous range of bytes.
+    struct stripe_header
+    {
+        std::uint64_t source = 0;    // random id of the sending process
+        std::uint64_t id = 0;        // id of the striped message
+        std::uint64_t offset = 0;    // offset into the zero-copy data
+        std::uint64_t size = 0;      // number of bytes carried
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Shared by the connections sending the parts of a striped message. The
+    // zero-copy data is owned by the parcels of the message, thus their
+    // handlers are invoked only once all parts have been written.
+    class stripe_state
+    {
+    public:
+        using handler_type =
+            hpx::move_only_function<void(std::error_code const&)>;
+
+        explicit stripe_state(std::size_t num_parts) noexcept
+          : pending_(num_parts)
+        {
+        }
+
+        // set the handler of the parcels of the message before any of the
+        // parts written by the connection holding the parcels has completed
+        void set_handler(handler_type&& handler)
+        {
+            handler_ = HPX_MOVE(handler);
+        }
+
+        // one of the parts of the message has been written, the first error
+        // is reported to the handler
+        void part_written(std::error_code const& e)
+        {
+            {
+                std::lock_guard l(mtx_);
+                if (e && !error_)
+                {
+                    error_ = e;
+                }
+                if (--pending_ != 0)
+                {
+                    return;
+                }
+            }
+            handler_(error_);
+        }
+
+    private:
+        hpx::spinlock mtx_;
+        std::size_t pending_;
+        std::error_code error_;
+        handler_type handler_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reassembles the zero-copy data of striped messages received over
+    // several connections. The fragments may arrive before the message they
+    // belong to, those are kept until the message has been registered.
+    class HPX_EXPORT stripe_registry
+    {
+    public:
+        // the zero-copy buffers of a message, in the order they were sent
+        using buffers_type = std::vector<std::pair<char*, std::size_t>>;
+        using continuation_type =
+            hpx::move_only_function<void(std::error_code const&)>;
+
+        // Register the zero-copy buffers of a striped message. The bytes
+        // which are not carried by the message itself are expected to arrive
+        // as fragments.
+        void add_message(stripe_header const& header, buffers_type&& buffers);
+
+        // The part of the zero-copy data carried by the message itself has
+        // been received. The continuation is invoked as soon as all fragments
+        // have been received as well (possibly right away), or with
+        // operation_aborted if the message has been discarded meanwhile.
+        void message_received(
+            stripe_header const& header, continuation_type&& continuation);
+
+        // A fragment of a striped message has been received, the data is
+        // copied into the buffers of the message.
+        void add_fragment(stripe_header const& header, char const* data);
+
+        // Receiving the message failed, its fragments are discarded.
+        void remove_message(stripe_header const& header);
+
+        // Discard all messages, the continuations of the messages waiting
+        // for fragments are invoked with operation_aborted. Messages received
+        // afterwards are aborted right away.
+        void stop();
+
+        // number of striped messages currently being reassembled
+        std::size_t size() const;
+
+    private:
+        using key_type = std::pair<std::uint64_t, std::uint64_t>;
+
+        struct entry
+        {
+            bool registered = false;
+            buffers_type buffers;
+            std::uint64_t expected = 0;    // bytes carried by fragments
+            std::uint64_t received = 0;    // bytes of fragments received
+
+            // fragments received before the message was registered
+            std::vector<std::pair<std::uint64_t, std::vector<char>>> early;
+
+            continuation_type continuation;
+        };
+
+        static key_type key(stripe_header const& header) noexcept
+        {
+            return key_type(header.source, header.id);
+        }
+
+        static void copy_fragment(buffers_type const& buffers,
+            std::uint64_t offset, char const* data, std::uint64_t size);
+
+        mutable hpx::spinlock mtx_;
+        std::map<key_type, entry> entries_;
+        bool stopped_ = false;
+    };
+}    // namespace hpx::parcelset::policies::tcp
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -15,10 +15,13 @@
 #include <hpx/modules/asio.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/functional.hpp>
+#include <hpx/modules/logging.hpp>
 #include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/util.hpp>
 
 #include <hpx/parcelport_tcp/connection_handler.hpp>
+#include <hpx/parcelport_tcp/io_uring_service.hpp>
 #include <hpx/parcelport_tcp/locality.hpp>
 #include <hpx/parcelport_tcp/receiver.hpp>
 #include <hpx/parcelport_tcp/sender.hpp>
@@ -36,6 +39,7 @@
 #include <exception>
 #include <memory>
 #include <mutex>
+#include <random>
 #include <string>
 #include <system_error>
 #include <thread>
@@ -67,6 +71,13 @@ namespace hpx::parcelset::policies::tcp {
         threads::policies::callback_notifier const& notifier)
       : base_type(ini, parcelport_address(ini), notifier)
       , acceptor_(nullptr)
+      , streaming_window_(hpx::util::get_entry_as<std::uint32_t>(
+            ini, "hpx.parcel.tcp.streaming_window", 0))
+      , backend_(ini.get_entry("hpx.parcel.tcp.backend", "asio"))
+      , stripe_source_((static_cast<std::uint64_t>(std::random_device()())
+                           << 32) |
+            std::random_device()())
+      , next_stripe_id_(0)
     {
         if (here_.type() != std::string("tcp"))
         {
@@ -76,6 +87,15 @@ namespace hpx::parcelset::policies::tcp {
                 "locality type: {}",
                 here_.type());
         }
+
+        if (backend_ != "asio" && backend_ != "io_uring")
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "tcp::parcelport::parcelport",
+                "unknown value for hpx.parcel.tcp.backend: '{}' (expected "
+                "'asio' or 'io_uring')",
+                backend_);
+        }
     }
 
     connection_handler::~connection_handler()
@@ -90,6 +110,38 @@ namespace hpx::parcelset::policies::tcp {
         if (nullptr == acceptor_)
             acceptor_ = new tcp::acceptor(io_service);
 
+        if (backend_ == "io_uring")
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (!io_uring_)
+            {
+                try
+                {
+                    io_uring_ = std::make_unique<io_uring_service>(io_service);
+                }
+                catch (std::system_error const& e)
+                {
+                    LPT_(warning).format("tcp::parcelport::run: io_uring is "
+                                         "not available ({}), falling back "
+                                         "to asio",
+                        e.what());
+                }
+            }
+#else
+            LPT_(warning).format("tcp::parcelport::run: io_uring support was "
+                                 "not enabled at configuration time, falling "
+                                 "back to asio");
+#endif
+        }
+
+        // make the backend which is actually used visible to the application
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        hpx::set_config_entry(
+            "hpx.parcel.tcp.active_backend", io_uring_ ? "io_uring" : "asio");
+#else
+        hpx::set_config_entry("hpx.parcel.tcp.active_backend", "asio");
+#endif
+
         // initialize network
         std::size_t tried = 0;
         exception_list errors;
@@ -130,6 +182,10 @@ namespace hpx::parcelset::policies::tcp {
 
     void connection_handler::do_stop()
     {
+        // abort the striped messages waiting for fragments which will not
+        // arrive anymore, this allows for the receivers to shut down
+        stripes_.stop();
+
         {
             // cancel all pending read operations, close those sockets
             std::lock_guard<hpx::spinlock> l(connections_mtx_);
@@ -143,6 +199,7 @@ namespace hpx::parcelset::policies::tcp {
             write_connections_.clear();
 #endif
         }
+
         if (acceptor_ != nullptr)
         {
             std::error_code ec;
@@ -150,6 +207,15 @@ namespace hpx::parcelset::policies::tcp {
             delete acceptor_;
             acceptor_ = nullptr;
         }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // the service is kept alive as connections may still refer to it,
+        // any further writes fail with operation_aborted
+        if (io_uring_)
+        {
+            io_uring_->stop();
+        }
+#endif
     }
 
     std::shared_ptr<sender> connection_handler::create_connection(
@@ -231,6 +297,28 @@ namespace hpx::parcelset::policies::tcp {
         s.set_option(asio::ip::tcp::no_delay(true));
         s.set_option(asio::socket_base::linger(true, 0));
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        sender_connection->set_io_uring_service(io_uring_.get());
+#endif
+
+        // agree on the number of unacknowledged messages with the receiver
+        sender_connection->negotiate_streaming_window(
+            streaming_window_, error);
+        if (error)
+        {
+            sender_connection->socket().close();
+            sender_connection.reset();
+
+            if (tolerate_node_faults())
+                return sender_connection;
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "tcp::connection_handler::get_connection",
+                "{} (while negotiating the connection with: {})",
+                error.message(), l);
+            return sender_connection;
+        }
+
 #if defined(HPX_HOLDON_TO_OUTGOING_CONNECTIONS)
         {
             std::lock_guard<hpx::spinlock> lock(connections_mtx_);
@@ -306,10 +394,11 @@ namespace hpx::parcelset::policies::tcp {
             s.set_option(asio::ip::tcp::no_delay(true));
             s.set_option(asio::socket_base::linger(true, 0));
 
-            // now accept the incoming connection by starting to read from the
-            // socket
-            c->async_read(hpx::bind(&connection_handler::handle_read_completion,
-                this, placeholders::_1, c));
+            // now accept the incoming connection by negotiating the streaming
+            // window and starting to read from the socket
+            c->async_negotiate_streaming_window(
+                hpx::bind(&connection_handler::handle_read_completion, this,
+                    placeholders::_1, c));
         }
         else
         {
@@ -0,0 +1,817 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP) &&        \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <hpx/parcelport_tcp/io_uring_service.hpp>
+
+#include <asio/buffer.hpp>
+#include <asio/error.hpp>
+#include <asio/io_context.hpp>
+#include <asio/post.hpp>
+#include <asio/posix/stream_descriptor.hpp>
+
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::tcp {
+
+    namespace {
+
+        // liburing is not required, the few system calls needed are invoked
+        // directly
+        int io_uring_setup(unsigned entries, io_uring_params* p) noexcept
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+        }
+
+        int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+            unsigned flags) noexcept
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, fd,
+                to_submit, min_complete, flags, nullptr, 0));
+        }
+
+        int io_uring_register(
+            int fd, unsigned opcode, void* arg, unsigned nr_args) noexcept
+        {
+            return static_cast<int>(
+                ::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+        }
+
+        [[noreturn]] void throw_last_error(char const* what)
+        {
+            throw std::system_error(errno, std::system_category(), what);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct io_uring_service::impl : std::enable_shared_from_this<impl>
+    {
+        struct operation
+        {
+            int fd = -1;
+            bool in_flight = false;
+
+            // the operation waits for the socket to become writable (after
+            // a write has failed with EAGAIN)
+            bool polling = false;
+
+            // the buffers to write, all buffers before 'first' have been
+            // written completely
+            std::vector<iovec> iov;
+            std::size_t first = 0;
+            msghdr msg = {};
+
+            std::size_t bytes_transferred = 0;
+            handler_type handler;
+
+            std::list<operation>::iterator self;
+        };
+
+        // a finished operation whose handler is invoked once mtx_ has been
+        // released
+        struct completion
+        {
+            handler_type handler;
+            std::size_t bytes_transferred;
+            int error;
+        };
+
+        impl(asio::io_context& io_service, unsigned entries);
+
+        impl(impl const&) = delete;
+        impl(impl&&) = delete;
+        impl& operator=(impl const&) = delete;
+        impl& operator=(impl&&) = delete;
+
+        ~impl();
+
+        void async_write(int fd, std::vector<asio::const_buffer> const& buffers,
+            handler_type handler);
+        void stop();
+
+    private:
+        void release() noexcept;
+        void start(operation& op);
+        void start_poll(operation& op);
+        void start_backlog();
+        bool consume(operation& op, int result) noexcept;
+        unsigned sq_space() const noexcept;
+        void push_sqe(io_uring_sqe const& sqe);
+        void submit();
+        static void invoke(std::vector<completion>& completed);
+        void wait_for_completions();
+        void handle_completions(std::error_code const& e, std::size_t);
+
+        template <typename F>
+        void reap_completions(F&& f);
+
+        template <typename F>
+        void withdraw_unsubmitted(F&& f);
+
+        asio::io_context& io_service_;
+
+        int ring_fd_ = -1;
+        unsigned sq_entries_ = 0;
+
+        void* sq_ring_ = MAP_FAILED;
+        std::size_t sq_ring_size_ = 0;
+        void* cq_ring_ = MAP_FAILED;
+        std::size_t cq_ring_size_ = 0;
+        io_uring_sqe* sqes_ = static_cast<io_uring_sqe*>(MAP_FAILED);
+        std::size_t sqes_size_ = 0;
+
+        unsigned* sq_head_ = nullptr;
+        unsigned* sq_tail_ = nullptr;
+        unsigned* sq_mask_ = nullptr;
+        unsigned* sq_array_ = nullptr;
+        unsigned* cq_head_ = nullptr;
+        unsigned* cq_tail_ = nullptr;
+        unsigned* cq_mask_ = nullptr;
+        io_uring_cqe* cqes_ = nullptr;
+
+        // completions are signaled through this eventfd
+        asio::posix::stream_descriptor event_descriptor_;
+        std::uint64_t event_count_ = 0;
+
+        hpx::spinlock mtx_;
+        bool stopped_ = false;
+        bool watching_ = false;
+        bool submit_pending_ = false;
+        unsigned to_submit_ = 0;
+
+        // no more operations than submission queue entries are in flight,
+        // this guarantees that neither queue can overflow
+        unsigned in_flight_ = 0;
+        std::list<operation> operations_;
+        std::deque<operation*> backlog_;
+    };
+
+    io_uring_service::impl::impl(asio::io_context& io_service, unsigned entries)
+      : io_service_(io_service)
+      , event_descriptor_(io_service)
+    {
+        io_uring_params params = {};
+        ring_fd_ = io_uring_setup(entries, &params);
+        if (ring_fd_ < 0)
+        {
+            throw_last_error("io_uring_setup");
+        }
+
+        // make sure all operations used are supported
+        std::vector<char> probe_buffer(
+            sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op));
+        auto* probe = reinterpret_cast<io_uring_probe*>(probe_buffer.data());
+        if (io_uring_register(ring_fd_, IORING_REGISTER_PROBE, probe, 256) < 0)
+        {
+            int const error = errno;
+            release();
+            throw std::system_error(
+                error, std::system_category(), "io_uring_register(probe)");
+        }
+
+        for (unsigned const op :
+            {IORING_OP_SENDMSG, IORING_OP_POLL_ADD, IORING_OP_ASYNC_CANCEL})
+        {
+            if (probe->last_op < op ||
+                !(probe->ops[op].flags & IO_URING_OP_SUPPORTED))
+            {
+                release();
+                throw std::system_error(ENOSYS, std::system_category(),
+                    "io_uring does not support all required operations");
+            }
+        }
+
+        sq_entries_ = params.sq_entries;
+
+        // map the rings
+        sq_ring_size_ =
+            params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_size_ =
+            params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+        bool const single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap)
+        {
+            sq_ring_size_ = cq_ring_size_ =
+                (std::max)(sq_ring_size_, cq_ring_size_);
+        }
+
+        sq_ring_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+        if (sq_ring_ == MAP_FAILED)
+        {
+            int const error = errno;
+            release();
+            throw std::system_error(error, std::system_category(), "mmap");
+        }
+
+        if (single_mmap)
+        {
+            cq_ring_ = sq_ring_;
+        }
+        else
+        {
+            cq_ring_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+            if (cq_ring_ == MAP_FAILED)
+            {
+                int const error = errno;
+                release();
+                throw std::system_error(error, std::system_category(), "mmap");
+            }
+        }
+
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe*>(
+            ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES));
+        if (sqes_ == MAP_FAILED)
+        {
+            int const error = errno;
+            release();
+            throw std::system_error(error, std::system_category(), "mmap");
+        }
+
+        auto* sq = static_cast<char*>(sq_ring_);
+        sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_mask_ = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+        auto* cq = static_cast<char*>(cq_ring_);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask_ = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        // register the eventfd used to signal completions, it is owned by the
+        // stream_descriptor from now on
+        int event_fd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (event_fd < 0 ||
+            io_uring_register(
+                ring_fd_, IORING_REGISTER_EVENTFD, &event_fd, 1) < 0)
+        {
+            int const error = errno;
+            if (event_fd >= 0)
+                ::close(event_fd);
+            release();
+            throw std::system_error(
+                error, std::system_category(), "io_uring_register(eventfd)");
+        }
+        event_descriptor_.assign(event_fd);
+    }
+
+    io_uring_service::impl::~impl()
+    {
+        release();
+    }
+
+    void io_uring_service::impl::release() noexcept
+    {
+        if (sqes_ != MAP_FAILED)
+        {
+            ::munmap(sqes_, sqes_size_);
+            sqes_ = static_cast<io_uring_sqe*>(MAP_FAILED);
+        }
+        if (cq_ring_ != MAP_FAILED && cq_ring_ != sq_ring_)
+        {
+            ::munmap(cq_ring_, cq_ring_size_);
+        }
+        cq_ring_ = MAP_FAILED;
+        if (sq_ring_ != MAP_FAILED)
+        {
+            ::munmap(sq_ring_, sq_ring_size_);
+            sq_ring_ = MAP_FAILED;
+        }
+        if (ring_fd_ >= 0)
+        {
+            ::close(ring_fd_);
+            ring_fd_ = -1;
+        }
+    }
+
+    void io_uring_service::impl::async_write(int fd,
+        std::vector<asio::const_buffer> const& buffers, handler_type handler)
+    {
+        std::unique_lock l(mtx_);
+        if (stopped_)
+        {
+            l.unlock();
+            handler(asio::error::make_error_code(
+                        asio::error::operation_aborted),
+                0);
+            return;
+        }
+
+        auto const it = operations_.emplace(operations_.end());
+        operation& op = *it;
+        op.self = it;
+        op.fd = fd;
+        op.handler = HPX_MOVE(handler);
+
+        op.iov.reserve(buffers.size());
+        for (asio::const_buffer const& b : buffers)
+        {
+            if (b.size() != 0)
+            {
+                op.iov.push_back(
+                    iovec{const_cast<void*>(b.data()), b.size()});
+            }
+        }
+
+        start(op);
+
+        // start watching for completions once the first operation is pending
+        if (!watching_)
+        {
+            watching_ = true;
+            wait_for_completions();
+        }
+    }
+
+    // queue a write of the remaining buffers of the given operation, requires
+    // mtx_ to be held
+    void io_uring_service::impl::start(operation& op)
+    {
+        if (in_flight_ == sq_entries_)
+        {
+            backlog_.push_back(&op);
+            return;
+        }
+
+        ++in_flight_;
+        op.in_flight = true;
+
+        op.msg = msghdr{};
+        op.msg.msg_iov = op.iov.data() + op.first;
+        op.msg.msg_iovlen = (std::min)(
+            op.iov.size() - op.first, static_cast<std::size_t>(IOV_MAX));
+
+        io_uring_sqe sqe = {};
+        sqe.opcode = IORING_OP_SENDMSG;
+        sqe.fd = op.fd;
+        sqe.addr = reinterpret_cast<std::uint64_t>(&op.msg);
+        sqe.len = 1;
+        sqe.msg_flags = MSG_NOSIGNAL;
+        sqe.user_data = reinterpret_cast<std::uint64_t>(&op);
+
+        push_sqe(sqe);
+
+        // defer the submission, this allows for other operations started in
+        // the meantime to be submitted with the same system call
+        if (!submit_pending_)
+        {
+            submit_pending_ = true;
+            asio::post(io_service_,
+                hpx::bind_front(&impl::submit, shared_from_this()));
+        }
+    }
+
+    // wait for the socket of the given operation to become writable before
+    // retrying the write, requires mtx_ to be held
+    void io_uring_service::impl::start_poll(operation& op)
+    {
+        // the operation was in flight up to now, thus there is a free entry
+        HPX_ASSERT(in_flight_ != sq_entries_);
+
+        ++in_flight_;
+        op.in_flight = true;
+        op.polling = true;
+
+        io_uring_sqe sqe = {};
+        sqe.opcode = IORING_OP_POLL_ADD;
+        sqe.fd = op.fd;
+#if defined(IORING_FEAT_POLL_32BITS)
+        std::uint32_t events = POLLOUT;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        // the kernel expects the two halfwords to be swapped
+        events = (events << 16) | (events >> 16);
+#endif
+        sqe.poll32_events = events;
+#else
+        sqe.poll_events = POLLOUT;
+#endif
+        sqe.user_data = reinterpret_cast<std::uint64_t>(&op);
+
+        push_sqe(sqe);
+
+        if (!submit_pending_)
+        {
+            submit_pending_ = true;
+            asio::post(io_service_,
+                hpx::bind_front(&impl::submit, shared_from_this()));
+        }
+    }
+
+    // start the operations waiting for a free entry, requires mtx_ to be held
+    void io_uring_service::impl::start_backlog()
+    {
+        while (!backlog_.empty() && in_flight_ != sq_entries_)
+        {
+            operation* op = backlog_.front();
+            backlog_.pop_front();
+            start(*op);
+        }
+    }
+
+    // account for the given number of bytes written by the operation,
+    // returns whether all buffers have been written
+    bool io_uring_service::impl::consume(operation& op, int result) noexcept
+    {
+        HPX_ASSERT(result > 0);
+
+        // skip all buffers which were written completely
+        auto n = static_cast<std::size_t>(result);
+        op.bytes_transferred += n;
+        while (n != 0 && op.first != op.iov.size())
+        {
+            iovec& v = op.iov[op.first];
+            if (n < v.iov_len)
+            {
+                v.iov_base = static_cast<char*>(v.iov_base) + n;
+                v.iov_len -= n;
+                break;
+            }
+            n -= v.iov_len;
+            ++op.first;
+        }
+        return op.first == op.iov.size();
+    }
+
+    // number of free submission queue entries, requires mtx_ to be held
+    unsigned io_uring_service::impl::sq_space() const noexcept
+    {
+        return sq_entries_ -
+            (*sq_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE));
+    }
+
+    // requires mtx_ to be held and a free entry, the submission queue can't
+    // be full while running as there are never more entries than operations
+    // in flight, stop() checks sq_space() before queuing cancellations
+    void io_uring_service::impl::push_sqe(io_uring_sqe const& sqe)
+    {
+        HPX_ASSERT(sq_space() != 0);
+        unsigned const tail = *sq_tail_;
+
+        unsigned const index = tail & *sq_mask_;
+        sqes_[index] = sqe;
+        sq_array_[index] = index;
+
+        __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+        ++to_submit_;
+    }
+
+    void io_uring_service::impl::submit()
+    {
+        std::vector<completion> failed;
+        {
+            std::lock_guard l(mtx_);
+            submit_pending_ = false;
+            if (stopped_ || to_submit_ == 0)
+            {
+                return;
+            }
+
+            int const submitted = io_uring_enter(ring_fd_, to_submit_, 0, 0);
+            if (submitted > 0)
+            {
+                to_submit_ -= static_cast<unsigned>(submitted);
+            }
+            else if (int const error = errno; submitted < 0 &&
+                error != EINTR && error != EAGAIN && error != EBUSY)
+            {
+                // the kernel refuses the entries, retrying would not make
+                // any progress, fail the operations instead
+                withdraw_unsubmitted([&](std::uint64_t user_data) {
+                    auto* op = reinterpret_cast<operation*>(user_data);
+                    HPX_ASSERT(op != nullptr && op->in_flight);
+
+                    --in_flight_;
+                    op->in_flight = false;
+                    op->polling = false;
+
+                    failed.push_back(completion{HPX_MOVE(op->handler),
+                        op->bytes_transferred, error});
+                    operations_.erase(op->self);
+                });
+
+                // the operations started now are failed by the next
+                // submission if the error persists
+                start_backlog();
+            }
+
+            // retry later if the kernel did not accept all entries
+            if (to_submit_ != 0 && !submit_pending_)
+            {
+                submit_pending_ = true;
+                asio::post(io_service_,
+                    hpx::bind_front(&impl::submit, shared_from_this()));
+            }
+        }
+
+        invoke(failed);
+    }
+
+    void io_uring_service::impl::invoke(std::vector<completion>& completed)
+    {
+        for (completion& c : completed)
+        {
+            c.handler(c.error != 0 ?
+                    std::error_code(c.error, std::system_category()) :
+                    std::error_code(),
+                c.bytes_transferred);
+        }
+    }
+
+    void io_uring_service::impl::wait_for_completions()
+    {
+        void (impl::*f)(std::error_code const&, std::size_t) =
+            &impl::handle_completions;
+
+        event_descriptor_.async_read_some(
+            asio::buffer(&event_count_, sizeof(event_count_)),
+            hpx::bind(f, shared_from_this(), hpx::placeholders::_1,
+                hpx::placeholders::_2));
+    }
+
+    // invoke f for all available completions, requires mtx_ to be held
+    template <typename F>
+    void io_uring_service::impl::reap_completions(F&& f)
+    {
+        unsigned head = *cq_head_;
+        unsigned const tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        for (/**/; head != tail; ++head)
+        {
+            io_uring_cqe const& cqe = cqes_[head & *cq_mask_];
+            f(cqe.user_data, cqe.res);
+        }
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+    }
+
+    // take back all entries which have not been submitted yet and invoke f
+    // for each of them, requires mtx_ to be held. The kernel reads the
+    // submission queue only from within io_uring_enter (no SQPOLL thread is
+    // used), thus the entries after the head can't have been seen yet.
+    template <typename F>
+    void io_uring_service::impl::withdraw_unsubmitted(F&& f)
+    {
+        unsigned const tail = *sq_tail_;
+        for (unsigned i = tail - to_submit_; i != tail; ++i)
+        {
+            f(sqes_[sq_array_[i & *sq_mask_]].user_data);
+        }
+        __atomic_store_n(sq_tail_, tail - to_submit_, __ATOMIC_RELEASE);
+        to_submit_ = 0;
+    }
+
+    void io_uring_service::impl::handle_completions(
+        std::error_code const& e, std::size_t)
+    {
+        if (e == asio::error::operation_aborted)
+        {
+            return;
+        }
+
+        std::vector<completion> completed;
+        {
+            std::lock_guard l(mtx_);
+            if (stopped_)
+            {
+                return;
+            }
+
+            reap_completions([&](std::uint64_t user_data, int result) {
+                auto* op = reinterpret_cast<operation*>(user_data);
+                HPX_ASSERT(op != nullptr && op->in_flight);
+
+                --in_flight_;
+                op->in_flight = false;
+
+                if (op->polling)
+                {
+                    // the socket is writable (or in an error state, which
+                    // the next write will report), retry
+                    op->polling = false;
+                    if (result >= 0 || result == -EINTR)
+                    {
+                        start(*op);
+                        return;
+                    }
+                }
+                else if (result == -EINTR || result == -EAGAIN)
+                {
+                    // nothing was written, EAGAIN is reported once asio has
+                    // switched the socket to non-blocking mode for its own
+                    // operations (the first writes may happen before), wait
+                    // for the socket to become writable before retrying
+                    start_poll(*op);
+                    return;
+                }
+                else if (result > 0 && !consume(*op, result))
+                {
+                    start(*op);    // short write, continue
+                    return;
+                }
+                else if (result == 0 && op->first != op->iov.size())
+                {
+                    result = -EPIPE;    // the connection has been closed
+                }
+
+                // the operation is removed while the lock is held, as stop()
+                // takes over all remaining operations
+                completed.push_back(completion{HPX_MOVE(op->handler),
+                    op->bytes_transferred, result < 0 ? -result : 0});
+                operations_.erase(op->self);
+            });
+
+            start_backlog();
+            wait_for_completions();
+        }
+
+        invoke(completed);
+    }
+
+    void io_uring_service::impl::stop()
+    {
+        std::unique_lock l(mtx_);
+        if (stopped_)
+        {
+            return;
+        }
+        stopped_ = true;
+        backlog_.clear();
+
+        std::error_code ec;
+        event_descriptor_.close(ec);
+
+        // the kernel must not access the buffers of the operations after
+        // their handlers have been invoked, thus all operations in flight are
+        // cancelled and their completions are awaited
+        unsigned cancellations = 0;
+        auto const reaped = [&](std::uint64_t user_data, int result) {
+            if (user_data == 0)
+            {
+                --cancellations;
+                return;
+            }
+
+            auto* op = reinterpret_cast<operation*>(user_data);
+            --in_flight_;
+            op->in_flight = false;
+
+            if (!op->polling && result > 0)
+            {
+                consume(*op, result);
+            }
+            op->polling = false;
+        };
+
+        // invokes io_uring_enter for the entries queued so far, returns
+        // false if the ring has become unusable
+        auto const enter = [&](unsigned min_complete) {
+            int const result = io_uring_enter(ring_fd_, to_submit_,
+                min_complete, min_complete != 0 ? IORING_ENTER_GETEVENTS : 0);
+            if (result < 0)
+            {
+                return errno == EINTR || errno == EAGAIN || errno == EBUSY;
+            }
+            to_submit_ -=
+                (std::min)(to_submit_, static_cast<unsigned>(result));
+            return true;
+        };
+
+        // hand the entries queued so far to the kernel first, the
+        // cancellations would not find their operations otherwise
+        bool usable = true;
+        while (usable && to_submit_ != 0)
+        {
+            usable = enter(0);
+            reap_completions(reaped);
+        }
+
+        // there may be more operations in flight than free entries, queue the
+        // cancellations in batches as entries become available
+        std::vector<operation*> pending;
+        for (operation& op : operations_)
+        {
+            if (op.in_flight)
+            {
+                pending.push_back(&op);
+            }
+        }
+
+        auto next = pending.begin();
+        while (usable)
+        {
+            for (/**/; next != pending.end() && sq_space() != 0; ++next)
+            {
+                // skip the operations which have completed meanwhile
+                if ((*next)->in_flight)
+                {
+                    io_uring_sqe sqe = {};
+                    sqe.opcode = IORING_OP_ASYNC_CANCEL;
+                    sqe.fd = -1;
+                    sqe.addr = reinterpret_cast<std::uint64_t>(*next);
+                    sqe.user_data = 0;
+                    push_sqe(sqe);
+                    ++cancellations;
+                }
+            }
+
+            if (in_flight_ == 0 && cancellations == 0)
+            {
+                break;
+            }
+
+            usable = enter(1);
+            reap_completions(reaped);
+        }
+
+        if (!usable)
+        {
+            // the ring is unusable, the kernel won't touch any buffers
+            // anymore, the entries which were not submitted are dropped
+            withdraw_unsubmitted([&](std::uint64_t user_data) {
+                if (user_data == 0)
+                {
+                    --cancellations;
+                    return;
+                }
+
+                auto* op = reinterpret_cast<operation*>(user_data);
+                --in_flight_;
+                op->in_flight = false;
+                op->polling = false;
+            });
+        }
+
+        // invoke the handlers of all operations, operations which have not
+        // written all of their data are reported as aborted
+        std::list<operation> operations = HPX_MOVE(operations_);
+        l.unlock();
+
+        for (operation& op : operations)
+        {
+            op.handler(op.first == op.iov.size() ?
+                    std::error_code() :
+                    asio::error::make_error_code(
+                        asio::error::operation_aborted),
+                op.bytes_transferred);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    io_uring_service::io_uring_service(
+        asio::io_context& io_service, unsigned entries)
+      : impl_(std::make_shared<impl>(io_service, entries))
+    {
+    }
+
+    io_uring_service::~io_uring_service()
+    {
+        stop();
+    }
+
+    void io_uring_service::async_write(int fd,
+        std::vector<asio::const_buffer> const& buffers, handler_type handler)
+    {
+        impl_->async_write(fd, buffers, HPX_MOVE(handler));
+    }
+
+    void io_uring_service::stop()
+    {
+        impl_->stop();
+    }
+}    // namespace hpx::parcelset::policies::tcp
+
+#endif
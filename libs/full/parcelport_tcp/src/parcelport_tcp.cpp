@@ -19,6 +19,8 @@
 //      [hpx.parcel.tcp]
 //      ...
 //      priority = 1
+//      streaming_window = 0
+//      backend = asio
 //
 template <>
 struct hpx::traits::plugin_config_data<
@@ -42,7 +44,8 @@ struct hpx::traits::plugin_config_data<
 
     static constexpr char const* call() noexcept
     {
-        return "";
+        return "streaming_window = ${HPX_PARCEL_TCP_STREAMING_WINDOW:0}\n"
+               "backend = ${HPX_PARCEL_TCP_BACKEND:asio}";
     }
 };    // namespace hpx::traits
 
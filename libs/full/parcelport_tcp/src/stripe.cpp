@@ -0,0 +1,195 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP)
+#include <hpx/assert.hpp>
+#include <hpx/parcelport_tcp/stripe.hpp>
+
+#include <asio/error.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::tcp {
+
+    void stripe_registry::copy_fragment(buffers_type const& buffers,
+        std::uint64_t offset, char const* data, std::uint64_t size)
+    {
+        for (auto const& buffer : buffers)
+        {
+            if (size == 0)
+            {
+                break;
+            }
+
+            if (offset >= buffer.second)
+            {
+                // the fragment starts in one of the next buffers
+                offset -= buffer.second;
+                continue;
+            }
+
+            auto const count = static_cast<std::size_t>(
+                (std::min) (size, buffer.second - offset));
+            std::memcpy(buffer.first + offset, data, count);
+
+            data += count;
+            size -= count;
+            offset = 0;
+        }
+        HPX_ASSERT_MSG(size == 0,
+            "the fragment exceeds the zero-copy data of its message");
+    }
+
+    void stripe_registry::add_message(
+        stripe_header const& header, buffers_type&& buffers)
+    {
+        std::lock_guard l(mtx_);
+
+        entry& e = entries_[key(header)];
+        HPX_ASSERT(!e.registered);
+
+        std::uint64_t total = 0;
+        for (auto const& buffer : buffers)
+        {
+            total += buffer.second;
+        }
+        HPX_ASSERT(header.offset == 0 && header.size <= total);
+
+        e.registered = true;
+        e.buffers = HPX_MOVE(buffers);
+        e.expected = total - header.size;
+
+        // place the fragments which have arrived early
+        for (auto const& fragment : e.early)
+        {
+            copy_fragment(e.buffers, fragment.first, fragment.second.data(),
+                fragment.second.size());
+            e.received += fragment.second.size();
+        }
+        e.early.clear();
+        e.early.shrink_to_fit();
+    }
+
+    void stripe_registry::message_received(
+        stripe_header const& header, continuation_type&& continuation)
+    {
+        std::error_code ec;
+        {
+            std::lock_guard l(mtx_);
+
+            auto const it = entries_.find(key(header));
+            if (it == entries_.end() || stopped_)
+            {
+                // the message has been discarded
+                if (it != entries_.end())
+                {
+                    entries_.erase(it);
+                }
+                ec = asio::error::make_error_code(
+                    asio::error::operation_aborted);
+            }
+            else if (it->second.received != it->second.expected)
+            {
+                // the last fragment to arrive will invoke the continuation
+                HPX_ASSERT(it->second.registered);
+                it->second.continuation = HPX_MOVE(continuation);
+                return;
+            }
+            else
+            {
+                entries_.erase(it);
+            }
+        }
+        continuation(ec);
+    }
+
+    void stripe_registry::add_fragment(
+        stripe_header const& header, char const* data)
+    {
+        continuation_type continuation;
+        {
+            std::lock_guard l(mtx_);
+            if (stopped_)
+            {
+                return;
+            }
+
+            auto const it = entries_.emplace(key(header), entry()).first;
+            entry& e = it->second;
+            if (!e.registered)
+            {
+                // the message has not arrived yet
+                e.early.emplace_back(header.offset,
+                    std::vector<char>(
+                        data, data + static_cast<std::size_t>(header.size)));
+                return;
+            }
+
+            copy_fragment(e.buffers, header.offset, data, header.size);
+
+            e.received += header.size;
+            HPX_ASSERT(e.received <= e.expected);
+
+            if (e.received != e.expected || !e.continuation)
+            {
+                return;
+            }
+
+            continuation = HPX_MOVE(e.continuation);
+            entries_.erase(it);
+        }
+        continuation(std::error_code());
+    }
+
+    void stripe_registry::remove_message(stripe_header const& header)
+    {
+        std::lock_guard l(mtx_);
+        entries_.erase(key(header));
+    }
+
+    void stripe_registry::stop()
+    {
+        std::vector<continuation_type> continuations;
+        {
+            std::lock_guard l(mtx_);
+            stopped_ = true;
+
+            for (auto& e : entries_)
+            {
+                if (e.second.continuation)
+                {
+                    continuations.push_back(HPX_MOVE(e.second.continuation));
+                }
+            }
+            entries_.clear();
+        }
+
+        // the messages waiting for their fragments will not be completed
+        std::error_code const ec =
+            asio::error::make_error_code(asio::error::operation_aborted);
+        for (auto& continuation : continuations)
+        {
+            continuation(ec);
+        }
+    }
+
+    std::size_t stripe_registry::size() const
+    {
+        std::lock_guard l(mtx_);
+        return entries_.size();
+    }
+}    // namespace hpx::parcelset::policies::tcp
+
+#endif
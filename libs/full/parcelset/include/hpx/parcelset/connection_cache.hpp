@@ -28,20 +28,59 @@
 #include <cstddef>
 #include <cstdint>
 #include <deque>
+#include <iterator>
 #include <list>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::util {
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// The load of a single connection as tracked by the connection cache.
+    struct connection_load
+    {
+        std::size_t outstanding_bytes = 0;    // bytes sent, not yet delivered
+        std::uint64_t bytes_sent = 0;         // overall bytes sent
+        std::uint64_t messages_sent = 0;      // overall messages sent
+    };
+
+    namespace detail {
+
+        // Connections which keep messages in flight after having been
+        // returned to the cache (e.g. while waiting for the acknowledgment of
+        // streamed messages) report the number of bytes not delivered yet.
+        template <typename Connection, typename Enable = void>
+        struct reports_outstanding_bytes : std::false_type
+        {
+        };
+
+        template <typename Connection>
+        struct reports_outstanding_bytes<Connection,
+            std::void_t<decltype(
+                std::declval<Connection const&>().outstanding_bytes())>>
+          : std::true_type
+        {
+        };
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     /// This class implements an LRU cache to hold connections. It includes
     /// entries checked out from the cache in its cache size.
+    ///
+    /// The cache keeps track of the load of each of the connections (see
+    /// \a add_outstanding_bytes()). A message is in flight until it has been
+    /// delivered. For connections reporting their outstanding bytes this may
+    /// be well after the connection was returned to the cache, otherwise the
+    /// bytes are outstanding until the connection is reclaimed. If several
+    /// connections to a locality are available, the least loaded one is
+    /// handed out.
     template <typename Connection, typename Key>
     class connection_cache
     {
@@ -52,11 +91,20 @@ namespace hpx::util {
         using value_type = std::deque<connection_type>;
         using key_type = Key;
         using key_tracker_type = std::list<key_type>;
+
+        // the load of a connection, along with the connection itself
+        struct tracked_load
+        {
+            std::weak_ptr<Connection> connection;
+            connection_load load;
+        };
+        using load_map_type = std::map<Connection const*, tracked_load>;
         using cache_value_type = hpx::tuple<
             value_type,     // cached (available) connections
             std::size_t,    // number of existing connections
             std::size_t,    // max number of cached connections
-            typename key_tracker_type::iterator>;    // reference into LRU list
+            typename key_tracker_type::iterator,    // reference into LRU list
+            load_map_type>;    // load of the existing connections
 
         using cache_type = std::map<key_type, cache_value_type>;
         using size_type = typename cache_type::size_type;
@@ -131,6 +179,93 @@ namespace hpx::util {
             return hpx::get<3>(entry);
         }
 
+        static load_map_type& connection_loads(cache_value_type& entry)
+        {
+            return hpx::get<4>(entry);
+        }
+        static load_map_type const& connection_loads(
+            cache_value_type const& entry)
+        {
+            return hpx::get<4>(entry);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The current load of a connection, the bytes in flight are queried
+        // from the connection if it keeps track of them.
+        static connection_load current_load(tracked_load const& tracked)
+        {
+            connection_load load = tracked.load;
+            if constexpr (detail::reports_outstanding_bytes<Connection>::value)
+            {
+                if (connection_type const conn = tracked.connection.lock())
+                {
+                    load.outstanding_bytes = conn->outstanding_bytes();
+                }
+                else
+                {
+                    load.outstanding_bytes = 0;
+                }
+            }
+            return load;
+        }
+
+        // Remove the least loaded connection from the cached connections of
+        // the given entry. Connections with less bytes in flight are
+        // preferred, ties are broken by the overall number of bytes sent. This
+        // spreads the traffic to a locality evenly over all connections.
+        static connection_type pop_least_loaded(cache_value_type& e)
+        {
+            value_type& connections = cached_connections(e);
+            load_map_type const& loads = connection_loads(e);
+
+            HPX_ASSERT(!connections.empty());
+
+            auto const load_of =
+                [&](connection_type const& conn) -> connection_load {
+                auto const it = loads.find(conn.get());
+                return it != loads.end() ? current_load(it->second) :
+                                           connection_load();
+            };
+
+            auto best = connections.begin();
+            connection_load best_load = load_of(*best);
+            for (auto it = std::next(best); it != connections.end(); ++it)
+            {
+                connection_load const load = load_of(*it);
+                if (load.outstanding_bytes < best_load.outstanding_bytes ||
+                    (load.outstanding_bytes == best_load.outstanding_bytes &&
+                        load.bytes_sent < best_load.bytes_sent))
+                {
+                    best = it;
+                    best_load = load;
+                }
+            }
+
+            connection_type result = HPX_MOVE(*best);
+            connections.erase(best);
+            return result;
+        }
+
+        // The given connection has been returned to the cache, the messages
+        // sent over connections which don't report their outstanding bytes
+        // are considered to be delivered at this point.
+        static void release_outstanding_bytes(
+            cache_value_type& e, Connection const* conn)
+        {
+            load_map_type& loads = connection_loads(e);
+            if (auto const it = loads.find(conn); it != loads.end())
+            {
+                it->second.load.outstanding_bytes = 0;
+            }
+        }
+
+        // The given connection is being destroyed.
+        static void remove_connection_load(
+            cache_value_type& e, Connection const* conn)
+        {
+            connection_loads(e).erase(conn);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Increase the per-locality and overall connection counts.
         void increment_connection_count(cache_value_type& e)
@@ -191,12 +326,10 @@ namespace hpx::util {
                     lru_reference(it->second));
 
                 // If connections to the locality are available in the cache,
-                // remove the oldest one and return it.
+                // remove the least loaded one and return it.
                 if (!cached_connections(it->second).empty())
                 {
-                    value_type& connections = cached_connections(it->second);
-                    connection_type result = connections.front();
-                    connections.pop_front();
+                    connection_type result = pop_least_loaded(it->second);
 
                     ++hits_;
                     check_invariants();
@@ -244,12 +377,10 @@ namespace hpx::util {
                     lru_reference(it->second));
 
                 // If connections to the locality are available in the cache,
-                // remove the oldest one and return it.
+                // remove the least loaded one and return it.
                 if (!cached_connections(it->second).empty())
                 {
-                    value_type& connections = cached_connections(it->second);
-                    conn = connections.front();
-                    connections.pop_front();
+                    conn = pop_least_loaded(it->second);
 
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
                     conn->set_state(Connection::state_reinitialized);
@@ -322,8 +453,8 @@ namespace hpx::util {
                 key_tracker_.insert(key_tracker_.end(), l);
 
             cache_.emplace(l,
-                hpx::make_tuple(
-                    value_type(), 1, max_connections_per_locality_, kt));
+                hpx::make_tuple(value_type(), 1, max_connections_per_locality_,
+                    kt, load_map_type()));
 
             // Make sure the input connection shared_ptr doesn't hold anything.
             conn.reset();
@@ -353,6 +484,9 @@ namespace hpx::util {
                 key_tracker_.splice(key_tracker_.end(), key_tracker_,
                     lru_reference(ct->second));
 
+                // The message sent over this connection has been delivered.
+                release_outstanding_bytes(ct->second, conn.get());
+
                 // Return the connection back to the cache only if the number
                 // of connections does not need to be shrunk.
                 if (num_existing_connections(ct->second) <=
@@ -371,6 +505,7 @@ namespace hpx::util {
                 {
                     // Adjust the number of existing connections for this key.
                     decrement_connection_count(ct->second);
+                    remove_connection_load(ct->second, conn.get());
 
                     // do the accounting
                     ++evictions_;
@@ -479,6 +614,7 @@ namespace hpx::util {
             {
                 // Adjust the number of existing connections for this key.
                 decrement_connection_count(it->second);
+                remove_connection_load(it->second, conn.get());
 
                 // do the accounting
                 ++evictions_;
@@ -494,6 +630,97 @@ namespace hpx::util {
             check_invariants();
         }
 
+        /// Account for a message of the given size which is about to be sent
+        /// over the connection \a conn to \a l. Unless the connection reports
+        /// its outstanding bytes, the bytes are outstanding until the
+        /// connection is returned to the cache.
+        void add_outstanding_bytes(key_type const& l,
+            connection_type const& conn, std::size_t bytes)
+        {
+            std::lock_guard<mutex_type> lock(mtx_);
+
+            typename cache_type::iterator const it = cache_.find(l);
+            if (it == cache_.end())
+                return;
+
+            tracked_load& tracked = connection_loads(it->second)[conn.get()];
+            if (tracked.connection.expired())
+            {
+                tracked.connection = conn;
+            }
+
+            if constexpr (!detail::reports_outstanding_bytes<
+                              Connection>::value)
+            {
+                tracked.load.outstanding_bytes += bytes;
+            }
+            tracked.load.bytes_sent += bytes;
+            ++tracked.load.messages_sent;
+        }
+
+        /// Returns the number of bytes currently in flight over all
+        /// connections to \a l.
+        std::size_t outstanding_bytes(key_type const& l) const
+        {
+            std::lock_guard<mutex_type> lock(mtx_);
+
+            typename cache_type::const_iterator const it = cache_.find(l);
+            if (it == cache_.end())
+                return 0;
+
+            std::size_t result = 0;
+            for (auto const& tracked : connection_loads(it->second))
+            {
+                result += current_load(tracked.second).outstanding_bytes;
+            }
+            return result;
+        }
+
+        /// Returns the load of all connections to \a l which have been used
+        /// for sending messages.
+        std::vector<connection_load> get_connection_loads(
+            key_type const& l) const
+        {
+            std::lock_guard<mutex_type> lock(mtx_);
+
+            std::vector<connection_load> result;
+
+            typename cache_type::const_iterator const it = cache_.find(l);
+            if (it != cache_.end())
+            {
+                result.reserve(connection_loads(it->second).size());
+                for (auto const& tracked : connection_loads(it->second))
+                {
+                    result.push_back(current_load(tracked.second));
+                }
+            }
+            return result;
+        }
+
+        /// Returns the load of all connections which have been used for
+        /// sending messages, one entry per connection. If \a reset is true,
+        /// the overall number of bytes and messages sent is reset for all
+        /// connections.
+        std::vector<connection_load> get_connection_loads(bool reset)
+        {
+            std::lock_guard<mutex_type> lock(mtx_);
+
+            std::vector<connection_load> result;
+            for (auto& e : cache_)
+            {
+                for (auto& tracked : connection_loads(e.second))
+                {
+                    result.push_back(current_load(tracked.second));
+                    if (reset)
+                    {
+                        tracked.second.load.bytes_sent = 0;
+                        tracked.second.load.messages_sent = 0;
+                    }
+                }
+            }
+            return result;
+        }
+
         // access statistics
         std::int64_t get_cache_insertions(bool reset)
         {
@@ -525,6 +752,37 @@ namespace hpx::util {
             return util::get_and_reset_value(reclaims_, reset);
         }
 
+        // number of bytes in flight over all connections
+        std::int64_t get_outstanding_bytes(bool /* reset */) const
+        {
+            std::lock_guard<mutex_type> lock(mtx_);
+
+            std::size_t result = 0;
+            for (auto const& e : cache_)
+            {
+                for (auto const& tracked : connection_loads(e.second))
+                {
+                    result += current_load(tracked.second).outstanding_bytes;
+                }
+            }
+            return static_cast<std::int64_t>(result);
+        }
+
+        // number of connections currently checked out of the cache
+        std::int64_t get_busy_connections(bool /* reset */) const
+        {
+            std::lock_guard<mutex_type> lock(mtx_);
+
+            std::size_t cached = 0;
+            for (auto const& e : cache_)
+            {
+                cached += cached_connections(e.second).size();
+            }
+
+            HPX_ASSERT(cached <= connections_);
+            return static_cast<std::int64_t>(connections_ - cached);
+        }
+
     private:
         /// Verify class invariants
         void check_invariants() const
@@ -549,6 +807,9 @@ namespace hpx::util {
                 // checked out of the cache).
                 in_cache_count += num_connections;
                 total_count += num_existing;
+
+                // Only existing connections have a load.
+                HPX_ASSERT(connection_loads(val).size() <= num_existing);
             }
 
             // Overall connection count should be larger than or equal to the
@@ -612,6 +873,8 @@ namespace hpx::util {
                 }
 
                 // Remove the oldest connection.
+                remove_connection_load(ct->second,
+                    cached_connections(ct->second).front().get());
                 cached_connections(ct->second).pop_front();
 
                 // Adjust the overall and per-locality connection count.
@@ -22,6 +22,7 @@
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/parcel_route_handler.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
 
 #if ASIO_HAS_BOOST_THROW_EXCEPTION != 0
 #include <boost/exception/exception.hpp>
@@ -37,14 +38,16 @@
 namespace hpx::parcelset {
 
     ///////////////////////////////////////////////////////////////////////////
+    // decode the chunk information into the given chunk vector, any existing
+    // storage of the vector is reused
     template <typename Buffer>
-    std::vector<serialization::serialization_chunk> decode_chunks(
-        Buffer& buffer)
+    void decode_chunks(
+        Buffer& buffer, std::vector<serialization::serialization_chunk>& chunks)
     {
         using transmission_chunk_type =
             typename Buffer::transmission_chunk_type;
 
-        std::vector<serialization::serialization_chunk> chunks;
+        chunks.clear();
 
         auto num_zero_copy_chunks = static_cast<std::size_t>(
             static_cast<std::uint32_t>(buffer.num_chunks_.first));
@@ -119,7 +122,14 @@ namespace hpx::parcelset {
             }
 #endif
         }
+    }
 
+    template <typename Buffer>
+    std::vector<serialization::serialization_chunk> decode_chunks(
+        Buffer& buffer)
+    {
+        std::vector<serialization::serialization_chunk> chunks;
+        decode_chunks(buffer, chunks);
         return chunks;
     }
 
@@ -210,64 +220,138 @@ namespace hpx::parcelset {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    inline void handle_received_parcels(
-        std::vector<parcelset::parcel>&& deferred_parcels,
-        std::size_t num_thread = -1)
-    {
-        if (HPX_LIKELY(deferred_parcels.empty()))
+    namespace detail {
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        // track the time from the decoded parcel being handed over for
+        // scheduling until its action is scheduled
+        inline void add_schedule_latency(parcelport* pp,
+            parcelset::parcel const& p, std::uint64_t handover_time)
         {
-            return;
+            if (pp == nullptr)
+            {
+                return;
+            }
+
+            auto const latency = static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now() - handover_time);
+
+            pp->add_parcel_latency(parcel_latency_phase::schedule, latency);
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+            pp->add_parcel_latency(
+                p.get_action_name(), parcel_latency_phase::schedule, latency);
+#endif
         }
+#endif
 
-        for (std::size_t i = 1; i != deferred_parcels.size(); ++i)
+        // The parcels are moved out of the given list, the list itself
+        // (and its storage) is left to the caller.
+        inline void handle_received_parcels([[maybe_unused]] parcelport* pp,
+            std::vector<parcelset::parcel>& deferred_parcels,
+            std::size_t num_thread)
         {
+            if (HPX_LIKELY(deferred_parcels.empty()))
+            {
+                return;
+            }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            std::uint64_t const handover_time =
+                hpx::chrono::high_resolution_clock::now();
+#endif
+
+            for (std::size_t i = 1; i != deferred_parcels.size(); ++i)
+            {
+                LPT_(debug).format("handle_received_parcels: received: {}",
+                    deferred_parcels[i].parcel_id());
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                auto f = [num_thread, pp, handover_time](
+                             parcelset::parcel&& p) {
+                    add_schedule_latency(pp, p, handover_time);
+#else
+                auto f = [num_thread](parcelset::parcel&& p) {
+#endif
+                    if (p.schedule_action(num_thread))
+                    {
+                        // route this parcel as the object was
+                        // migrated
+                        agas::route(HPX_MOVE(p),
+                            &parcelset::detail::parcel_route_handler,
+                            threads::thread_priority::normal);
+                    }
+                };
+
+                // schedule all but the first parcel on a new thread.
+                hpx::threads::thread_init_data init_data(
+                    hpx::threads::make_thread_function_nullary(
+                        util::deferred_call(
+                            HPX_MOVE(f), HPX_MOVE(deferred_parcels[i]))),
+                    "schedule_parcel", threads::thread_priority::boost,
+                    threads::thread_schedule_hint(
+                        static_cast<std::int16_t>(num_thread)),
+                    threads::thread_stacksize::default_,
+                    threads::thread_schedule_state::pending, true);
+                hpx::threads::register_thread(init_data);
+            }
+
+            // If we are the first deferred parcel, we don't need to spin
+            // up a new thread...
             LPT_(debug).format("handle_received_parcels: received: {}",
-                deferred_parcels[i].parcel_id());
+                deferred_parcels[0].parcel_id());
 
-            auto f = [num_thread](parcelset::parcel&& p) {
-                if (p.schedule_action(num_thread))
-                {
-                    // route this parcel as the object was
-                    // migrated
-                    agas::route(HPX_MOVE(p),
-                        &parcelset::detail::parcel_route_handler,
-                        threads::thread_priority::normal);
-                }
-            };
-
-            // schedule all but the first parcel on a new thread.
-            hpx::threads::thread_init_data init_data(
-                hpx::threads::make_thread_function_nullary(util::deferred_call(
-                    HPX_MOVE(f), HPX_MOVE(deferred_parcels[i]))),
-                "schedule_parcel", threads::thread_priority::boost,
-                threads::thread_schedule_hint(
-                    static_cast<std::int16_t>(num_thread)),
-                threads::thread_stacksize::default_,
-                threads::thread_schedule_state::pending, true);
-            hpx::threads::register_thread(init_data);
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            add_schedule_latency(pp, deferred_parcels[0], handover_time);
+#endif
+            if (deferred_parcels[0].schedule_action(num_thread))
+            {
+                // route this parcel as the object was migrated
+                agas::route(HPX_MOVE(deferred_parcels[0]),
+                    &parcelset::detail::parcel_route_handler,
+                    threads::thread_priority::normal);
+            }
         }
+    }    // namespace detail
 
-        // If we are the first deferred parcel, we don't need to spin
-        // up a new thread...
-        LPT_(debug).format("handle_received_parcels: received: {}",
-            deferred_parcels[0].parcel_id());
+    inline void handle_received_parcels(
+        std::vector<parcelset::parcel>&& deferred_parcels,
+        std::size_t num_thread = -1)
+    {
+        detail::handle_received_parcels(nullptr, deferred_parcels, num_thread);
+    }
 
-        if (deferred_parcels[0].schedule_action(num_thread))
-        {
-            // route this parcel as the object was migrated
-            agas::route(HPX_MOVE(deferred_parcels[0]),
-                &parcelset::detail::parcel_route_handler,
-                threads::thread_priority::normal);
-        }
+    // Same as above, additionally keeps track of the time needed for
+    // scheduling the received parcels.
+    inline void handle_received_parcels(parcelport& pp,
+        std::vector<parcelset::parcel>&& deferred_parcels,
+        std::size_t num_thread = -1)
+    {
+        detail::handle_received_parcels(&pp, deferred_parcels, num_thread);
+    }
+
+    // Same as above, the list of parcels is cleared afterwards but keeps its
+    // storage, which allows for reusing it for subsequent messages.
+    inline void handle_received_parcels(parcelport& pp,
+        std::vector<parcelset::parcel>& deferred_parcels,
+        std::size_t num_thread = -1)
+    {
+        detail::handle_received_parcels(&pp, deferred_parcels, num_thread);
+        deferred_parcels.clear();
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    // De-serialize the parcels from the given archive. The parcels which
+    // have to be scheduled by the caller are stored in deferred_parcels, any
+    // existing storage of the vector is reused.
     template <typename Parcelport, typename Buffer>
-    std::vector<parcelset::parcel> decode_message_with_chunks(
-        serialization::input_archive& archive, [[maybe_unused]] Parcelport& pp,
-        [[maybe_unused]] Buffer& buffer, std::size_t parcel_count,
+    void decode_message_with_chunks(serialization::input_archive& archive,
+        [[maybe_unused]] Parcelport& pp, [[maybe_unused]] Buffer& buffer,
+        std::size_t parcel_count,
+        std::vector<parcelset::parcel>& deferred_parcels,
         std::size_t num_thread = -1)
     {
+        deferred_parcels.clear();
+
         bool const allow_zero_copy_receive =
             archive.try_get_extra_data<
                 serialization::detail::allow_zero_copy_receive>() != nullptr;
@@ -283,8 +367,6 @@ namespace hpx::parcelset {
                 std::int64_t overall_add_parcel_time = 0;
                 parcelset::data_point& data = buffer.data_point_;
 #endif
-                std::vector<parcelset::parcel> deferred_parcels;
-
                 // De-serialize the parcel data
                 if (parcel_count == 0)
                 {
@@ -374,7 +456,7 @@ namespace hpx::parcelset {
                     timer.elapsed_nanoseconds() - overall_add_parcel_time;
                 pp.add_received_data(data);
 #endif
-                return deferred_parcels;
+                return;
             }
             catch (hpx::exception const& e)
             {
@@ -410,7 +492,18 @@ namespace hpx::parcelset {
             hpx::report_error(std::current_exception());
         }
 
-        return {};
+        deferred_parcels.clear();
+    }
+
+    template <typename Parcelport, typename Buffer>
+    std::vector<parcelset::parcel> decode_message_with_chunks(
+        serialization::input_archive& archive, Parcelport& pp, Buffer& buffer,
+        std::size_t parcel_count, std::size_t num_thread = -1)
+    {
+        std::vector<parcelset::parcel> deferred_parcels;
+        decode_message_with_chunks(
+            archive, pp, buffer, parcel_count, deferred_parcels, num_thread);
+        return deferred_parcels;
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -454,6 +547,26 @@ namespace hpx::parcelset {
         return decode_message(parcelport, HPX_MOVE(buffer), 0, num_thread);
     }
 
+    // De-serialize the parcels without consuming the given buffer. The chunk
+    // information and the parcels which have to be scheduled by the caller
+    // are stored in the given vectors, this allows for the receiving
+    // connection to reuse all of those for subsequent messages.
+    template <typename Parcelport, typename Buffer>
+    void decode_parcels(Parcelport& parcelport, Buffer& buffer,
+        std::vector<serialization::serialization_chunk>& chunks,
+        std::vector<parcelset::parcel>& parcels, std::size_t num_thread = -1)
+    {
+        decode_chunks(buffer, chunks);
+
+        auto const inbound_data_size = static_cast<std::size_t>(
+            static_cast<std::uint64_t>(buffer.data_size_));
+        serialization::input_archive archive(
+            buffer.data_, inbound_data_size, &chunks);
+
+        decode_message_with_chunks(
+            archive, parcelport, buffer, 0, parcels, num_thread);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     std::vector<parcelset::parcel> decode_message_with_chunks_zero_copy(
@@ -14,11 +14,16 @@
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/assert.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/async_local.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/modules/futures.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/serialization.hpp>
+#include <hpx/modules/threading_base.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/serialization/detail/pointer.hpp>
 
 #include <hpx/actions_base/basic_action.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
@@ -31,6 +36,7 @@
 #include <boost/exception/exception.hpp>
 #endif
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -146,6 +152,219 @@ namespace hpx::parcelset {
                 }
             }
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // serialize a single parcel into the given archive
+        inline void encode_parcel([[maybe_unused]] parcelport& pp,
+            serialization::output_archive& archive, parcelset::parcel const& p)
+        {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            // the time the parcel had to wait for being serialized
+            if (std::uint64_t const enqueue_time = p.enqueue_time();
+                enqueue_time != 0)
+            {
+                auto const latency = static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now() - enqueue_time);
+
+                pp.add_parcel_latency(parcel_latency_phase::enqueue, latency);
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+                pp.add_parcel_latency(p.get_action_name(),
+                    parcel_latency_phase::enqueue, latency);
+#endif
+            }
+#endif
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
+    defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+            std::size_t const archive_pos = archive.current_pos();
+            hpx::chrono::high_resolution_timer const timer;
+#endif
+            LPT_(debug) << p;
+
+            auto split_gids_map = p.move_split_gids();
+            if (!split_gids_map.empty())
+            {
+                auto& split_gids = archive.get_extra_data<
+                    serialization::detail::preprocess_gid_types>();
+                split_gids.set_split_gids(HPX_MOVE(split_gids_map));
+            }
+
+            archive << p;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
+    defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+            parcelset::data_point action_data;
+            action_data.bytes_ = archive.current_pos() - archive_pos;
+            action_data.serialization_time_ = timer.elapsed_nanoseconds();
+            action_data.num_parcels_ = 1;
+            pp.add_sent_data(p.get_action_name(), action_data);
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The minimal number of parcels encoded by one thread.
+        inline constexpr std::size_t min_parcels_per_encoding_task = 16;
+
+        // Each group of parcels encoded separately counts the written bytes
+        // starting at a different multiple of this value. The positions of
+        // tracked pointers (see serialize_pointer_tracked) are used as keys
+        // while decoding the whole message, these have to be distinct.
+        inline constexpr std::uint64_t encoded_parcels_position_stride =
+            static_cast<std::uint64_t>(1) << 40;
+
+        // The result of encoding a group of parcels into a separate archive
+        struct encoded_parcels
+        {
+            std::vector<char> data_;
+            std::vector<serialization::serialization_chunk> chunks_;
+            std::size_t header_size_ = 0;
+        };
+
+        inline void encode_parcels_group(parcelport& pp,
+            parcelset::parcel const* ps,
+            std::size_t num_parcels, int archive_flags, std::uint64_t position,
+            encoded_parcels& group)
+        {
+            std::size_t size = 0;
+            for (std::size_t i = 0; i != num_parcels; ++i)
+            {
+                size += ps[i].size();
+            }
+            group.data_.reserve(size);
+
+            serialization::output_archive archive(group.data_, archive_flags,
+                &group.chunks_, nullptr,
+                pp.get_zero_copy_serialization_threshold());
+
+            // the archive header is not part of the encoded parcels
+            group.header_size_ = archive.bytes_written();
+            archive.set_current_pos(static_cast<std::size_t>(position));
+
+            for (std::size_t i = 0; i != num_parcels; ++i)
+            {
+                encode_parcel(pp, archive, ps[i]);
+            }
+            archive.flush();
+        }
+
+        // append the data of a separately encoded group of parcels to the
+        // given archive, zero-copy chunks are referenced as before
+        inline void append_encoded_parcels(
+            serialization::output_archive& archive,
+            encoded_parcels const& group)
+        {
+            for (serialization::serialization_chunk const& c : group.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type::chunk_type_index)
+                {
+                    std::size_t begin = c.data_.index_;
+                    std::size_t end = begin + c.size_;
+
+                    // skip the archive header
+                    begin = (std::max)(begin, group.header_size_);
+                    if (begin < end)
+                    {
+                        archive.save_binary(
+                            group.data_.data() + begin, end - begin);
+                    }
+                }
+                else
+                {
+                    archive.save_binary_chunk(c.data_.cpos_, c.size_);
+                }
+            }
+        }
+
+        // Encode the given parcels using several HPX threads. Returns false
+        // if the parcels should be encoded sequentially instead.
+        inline bool encode_parcels_parallel(parcelport& pp,
+            serialization::output_archive& archive,
+            parcelset::parcel const* ps, std::size_t num_parcels,
+            int archive_flags)
+        {
+            // the groups are placed at distinct positions, this requires
+            // 64 bit positions
+            std::size_t const threshold = pp.get_parallel_encoding_threshold();
+            if (sizeof(std::size_t) < sizeof(std::uint64_t) || threshold == 0 ||
+                num_parcels < threshold || threads::get_self_ptr() == nullptr)
+            {
+                return false;
+            }
+
+            std::size_t const num_groups = (std::min)(
+                hpx::get_os_thread_count(),
+                num_parcels / min_parcels_per_encoding_task);
+            if (num_groups < 2)
+            {
+                return false;
+            }
+
+            // split the parcels into groups of similar (estimated) size
+            std::size_t total_size = 0;
+            for (std::size_t i = 0; i != num_parcels; ++i)
+            {
+                total_size += ps[i].size();
+            }
+
+            std::vector<std::size_t> bounds;
+            bounds.reserve(num_groups + 1);
+            bounds.push_back(0);
+
+            std::size_t size = 0;
+            for (std::size_t i = 0;
+                i != num_parcels - 1 && bounds.size() != num_groups; ++i)
+            {
+                size += ps[i].size();
+                if (size * num_groups >= total_size * bounds.size())
+                {
+                    bounds.push_back(i + 1);
+                }
+            }
+            bounds.push_back(num_parcels);
+
+            std::size_t const groups_count = bounds.size() - 1;
+            std::vector<encoded_parcels> groups(groups_count);
+
+            auto encode_group = [&](std::size_t g) {
+                encode_parcels_group(pp, ps + bounds[g],
+                    bounds[g + 1] - bounds[g], archive_flags,
+                    (g + 1) * encoded_parcels_position_stride, groups[g]);
+            };
+
+            std::vector<hpx::future<void>> tasks;
+            tasks.reserve(groups_count - 1);
+            for (std::size_t g = 1; g != groups_count; ++g)
+            {
+                tasks.push_back(hpx::async(encode_group, g));
+            }
+
+            // the first group is encoded by the current thread, the other
+            // tasks have to finish before an exception is propagated
+            std::exception_ptr exception;
+            try
+            {
+                encode_group(0);
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+
+            hpx::wait_all(tasks);
+            if (exception)
+            {
+                std::rethrow_exception(exception);
+            }
+            for (hpx::future<void>& f : tasks)
+            {
+                f.get();
+            }
+
+            for (encoded_parcels const& group : groups)
+            {
+                append_encoded_parcels(archive, group);
+            }
+            return true;
+        }
     }    // namespace detail
 
     template <typename Buffer>
@@ -213,36 +432,17 @@ namespace hpx::parcelset {
                     if (num_parcels != static_cast<std::size_t>(-1))
                         archive << parcels_sent;    //-V128
 
-                    for (std::size_t i = 0; i != parcels_sent; ++i)
+                    // large batches of parcels may be encoded concurrently,
+                    // compressed messages are always encoded sequentially
+                    if (filter.get() != nullptr ||
+                        num_parcels == static_cast<std::size_t>(-1) ||
+                        !detail::encode_parcels_parallel(
+                            pp, archive, ps, parcels_sent, archive_flags))
                     {
-#if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
-    defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
-                        std::size_t const archive_pos = archive.current_pos();
-                        std::int64_t const serialize_time =
-                            timer.elapsed_nanoseconds();
-#endif
-                        LPT_(debug) << ps[i];
-
-                        auto split_gids_map = ps[i].move_split_gids();
-                        if (!split_gids_map.empty())
+                        for (std::size_t i = 0; i != parcels_sent; ++i)
                         {
-                            auto& split_gids = archive.get_extra_data<
-                                serialization::detail::preprocess_gid_types>();
-                            split_gids.set_split_gids(HPX_MOVE(split_gids_map));
+                            detail::encode_parcel(pp, archive, ps[i]);
                         }
-
-                        archive << ps[i];
-
-#if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
-    defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
-                        parcelset::data_point action_data;
-                        action_data.bytes_ =
-                            archive.current_pos() - archive_pos;
-                        action_data.serialization_time_ =
-                            timer.elapsed_nanoseconds() - serialize_time;
-                        action_data.num_parcels_ = 1;
-                        pp.add_sent_data(ps[i].get_action_name(), action_data);
-#endif
                     }
                     archive.flush();
                     arg_size = archive.bytes_written();
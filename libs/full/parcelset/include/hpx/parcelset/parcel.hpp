@@ -52,6 +52,11 @@ namespace hpx::parcelset::detail {
         double start_time_;
         double creation_time_;
 #endif
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        // not serialized, this is used for measuring the time the parcel
+        // waits to be sent
+        std::uint64_t enqueue_time_;
+#endif
 
         bool has_continuation_;
     };
@@ -103,6 +108,9 @@ namespace hpx::parcelset::detail {
         void set_start_time(double time) override;
         double creation_time() const override;
 
+        std::uint64_t enqueue_time() const override;
+        void set_enqueue_time(std::uint64_t time) override;
+
         threads::thread_priority get_thread_priority() const override;
         threads::thread_stacksize get_thread_stacksize() const override;
 
@@ -347,6 +347,11 @@ namespace hpx::parcelset {
         // the maximum size of zero-copy chunks per message received
         std::int64_t get_zchunks_recv_size_max(
             std::string const& pp_type, bool reset) const;
+
+        // the latency of the given phase below which the given percentage of
+        // all parcels or messages fall (nanoseconds)
+        std::int64_t get_parcel_latency(std::string const& pp_type,
+            parcel_latency_phase phase, double percentage, bool reset) const;
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -378,12 +383,30 @@ namespace hpx::parcelset {
         // total data received (bytes)
         std::int64_t get_action_data_received(std::string const& pp_type,
             std::string const& action, bool reset) const;
+
+        // the latency of the given phase below which the given percentage of
+        // the parcels fall (nanoseconds)
+        std::int64_t get_action_parcel_latency(std::string const& pp_type,
+            parcel_latency_phase phase, double percentage,
+            std::string const& action, bool reset) const;
 #endif
 
         //
         std::int64_t get_connection_cache_statistics(std::string const& pp_type,
             parcelport::connection_cache_statistics_type stat_type, bool) const;
 
+        std::vector<std::int64_t> get_connection_statistics(
+            std::string const& pp_type,
+            parcelport::connection_statistics_type stat_type, bool) const;
+
+        std::int64_t get_receive_buffer_pool_statistics(
+            std::string const& pp_type,
+            parcelport::receive_buffer_pool_statistics_type stat_type,
+            bool) const;
+
+        std::int64_t get_parcel_lane_statistics(std::string const& pp_type,
+            parcelport::parcel_lane_statistics_type stat_type, bool) const;
+
         void list_parcelports(std::ostringstream& strm) const;
         void list_parcelport(std::ostringstream& strm,
             std::string const& ppname, int priority, bool bootstrap) const;
@@ -22,6 +22,7 @@
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/thread_support.hpp>
 #include <hpx/modules/threading.hpp>
+#include <hpx/modules/timing.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/modules/util.hpp>
 #include <hpx/util/from_string.hpp>
@@ -32,11 +33,13 @@
 #include <hpx/parcelset/encode_parcels.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
@@ -107,6 +110,45 @@ namespace hpx::parcelset {
                 HPX_PARCEL_MAX_CONNECTIONS_PER_LOCALITY);
         }
 
+        static std::size_t max_priority_connections_per_loc(
+            util::runtime_configuration const& ini)
+        {
+            std::string key("hpx.parcel.");
+            key += connection_handler_type();
+
+            return hpx::util::get_entry_as<std::size_t>(
+                ini, key + ".max_priority_connections_per_locality", 2);
+        }
+
+        // The connections reserved for the priority lane are taken from the
+        // overall budget of connections, proportionally to the number of
+        // connections per locality allowed for each lane.
+        static std::size_t max_priority_connections(
+            util::runtime_configuration const& ini, bool priority_lanes)
+        {
+            if (!priority_lanes)
+                return 0;
+
+            std::size_t const per_loc = max_connections_per_loc(ini);
+            std::size_t const priority_per_loc =
+                max_priority_connections_per_loc(ini);
+
+            return (std::max)(priority_per_loc,
+                max_connections(ini) * priority_per_loc /
+                    (std::max)(per_loc + priority_per_loc, std::size_t(1)));
+        }
+
+        static std::size_t max_normal_connections(
+            util::runtime_configuration const& ini, bool priority_lanes)
+        {
+            std::size_t const max_conns = max_connections(ini);
+            std::size_t const reserved =
+                max_priority_connections(ini, priority_lanes);
+
+            return (std::max)(max_conns > reserved ? max_conns - reserved : 0,
+                max_connections_per_loc(ini));
+        }
+
         static std::size_t zero_copy_serialization_threshold(
             util::runtime_configuration const& ini)
         {
@@ -139,9 +181,15 @@ namespace hpx::parcelset {
           , io_service_pool_(thread_pool_size(ini), notifier, pool_name(),
                 pool_name_postfix())
           , connection_cache_(
-                max_connections(ini), max_connections_per_loc(ini))
+                max_normal_connections(ini, this->priority_lanes()),
+                max_connections_per_loc(ini))
+          , priority_connection_cache_(
+                max_priority_connections(ini, this->priority_lanes()),
+                max_priority_connections_per_loc(ini))
           , archive_flags_(0)
           , operations_in_flight_(0)
+          , striped_messages_(0)
+          , striped_fragments_(0)
           , num_thread_(0)
           , max_background_thread_(max_background_threads(ini))
         {
@@ -193,6 +241,7 @@ namespace hpx::parcelset {
 
         ~parcelport_impl() override
         {
+            priority_connection_cache_.clear();
             connection_cache_.clear();
         }
 
@@ -236,11 +285,13 @@ namespace hpx::parcelset {
 
             if (blocking)
             {
+                priority_connection_cache_.shutdown();
                 connection_cache_.shutdown();
                 connection_handler().do_stop();
                 io_service_pool_.wait();
                 io_service_pool_.stop();
                 io_service_pool_.join();
+                priority_connection_cache_.clear();
                 connection_cache_.clear();
                 io_service_pool_.clear();
             }
@@ -256,6 +307,9 @@ namespace hpx::parcelset {
         {
             HPX_ASSERT(dest.type() == type());
 
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            p.set_enqueue_time(hpx::chrono::high_resolution_clock::now());
+#endif
             // We create a shared pointer of the parcels_await object since it
             // needs to be kept alive as long as there are futures not ready
             // or GIDs to be split. This is necessary to preserve the identity
@@ -271,8 +325,10 @@ namespace hpx::parcelset {
                     else
                     {
                         // enqueue the outgoing parcel ...
-                        enqueue_parcel(dest, HPX_MOVE(p), HPX_MOVE(f));
-                        get_connection_and_send_parcels(dest);
+                        bool const priority = use_priority_lane(p);
+                        enqueue_parcel(
+                            dest, HPX_MOVE(p), HPX_MOVE(f), priority);
+                        get_connection_and_send_parcels(dest, priority);
                     }
                 });
         }
@@ -295,6 +351,13 @@ namespace hpx::parcelset {
                 HPX_ASSERT(parcels[0].destination_locality() ==    //-V767
                     parcels[i].destination_locality());
             }
+#endif
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+            for (parcel const& p : parcels)
+            {
+                p.set_enqueue_time(now);
+            }
 #endif
             // We create a shared pointer of the parcels_await object since it
             // needs to be kept alive as long as there are futures not ready
@@ -313,9 +376,8 @@ namespace hpx::parcelset {
                     }
                     else
                     {
-                        enqueue_parcels(
+                        enqueue_parcels_by_lane(
                             dest, HPX_MOVE(parcels), HPX_MOVE(handlers));
-                        get_connection_and_send_parcels(dest);
                     }
                 });
         }
@@ -398,6 +460,7 @@ namespace hpx::parcelset {
                 }
             }
 
+            priority_connection_cache_.clear(loc);
             connection_cache_.clear(loc);
         }
 
@@ -425,19 +488,38 @@ namespace hpx::parcelset {
             switch (t)
             {
             case connection_cache_insertions:
-                return connection_cache_.get_cache_insertions(reset);
+                return connection_cache_.get_cache_insertions(reset) +
+                    priority_connection_cache_.get_cache_insertions(reset);
 
             case connection_cache_evictions:
-                return connection_cache_.get_cache_evictions(reset);
+                return connection_cache_.get_cache_evictions(reset) +
+                    priority_connection_cache_.get_cache_evictions(reset);
 
             case connection_cache_hits:
-                return connection_cache_.get_cache_hits(reset);
+                return connection_cache_.get_cache_hits(reset) +
+                    priority_connection_cache_.get_cache_hits(reset);
 
             case connection_cache_misses:
-                return connection_cache_.get_cache_misses(reset);
+                return connection_cache_.get_cache_misses(reset) +
+                    priority_connection_cache_.get_cache_misses(reset);
 
             case connection_cache_reclaims:
-                return connection_cache_.get_cache_reclaims(reset);
+                return connection_cache_.get_cache_reclaims(reset) +
+                    priority_connection_cache_.get_cache_reclaims(reset);
+
+            case connection_cache_outstanding_bytes:
+                return connection_cache_.get_outstanding_bytes(reset) +
+                    priority_connection_cache_.get_outstanding_bytes(reset);
+
+            case connection_cache_busy_connections:
+                return connection_cache_.get_busy_connections(reset) +
+                    priority_connection_cache_.get_busy_connections(reset);
+
+            case connection_striped_messages:
+                return util::get_and_reset_value(striped_messages_, reset);
+
+            case connection_striped_fragments:
+                return util::get_and_reset_value(striped_fragments_, reset);
 
             default:
                 break;
@@ -448,6 +530,54 @@ namespace hpx::parcelset {
                 "invalid connection cache statistics type");
         }
 
+        // Return the given statistic for each of the sending connections
+        std::vector<std::int64_t> get_connection_statistics(
+            connection_statistics_type t, bool reset) override
+        {
+            if (t != connection_bytes_sent && t != connection_messages_sent &&
+                t != connection_outstanding_bytes)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "parcelport_impl::get_connection_statistics",
+                    "invalid connection statistics type");
+            }
+
+            // the overall number of bytes and messages is reset only if those
+            // are queried
+            bool const reset_loads = reset && t != connection_outstanding_bytes;
+
+            std::vector<util::connection_load> loads =
+                connection_cache_.get_connection_loads(reset_loads);
+            std::vector<util::connection_load> priority_loads =
+                priority_connection_cache_.get_connection_loads(reset_loads);
+            loads.insert(loads.end(), priority_loads.begin(),
+                priority_loads.end());
+
+            std::vector<std::int64_t> result;
+            result.reserve(loads.size());
+            for (util::connection_load const& load : loads)
+            {
+                switch (t)
+                {
+                case connection_bytes_sent:
+                    result.push_back(
+                        static_cast<std::int64_t>(load.bytes_sent));
+                    break;
+
+                case connection_messages_sent:
+                    result.push_back(
+                        static_cast<std::int64_t>(load.messages_sent));
+                    break;
+
+                default:
+                    result.push_back(
+                        static_cast<std::int64_t>(load.outstanding_bytes));
+                    break;
+                }
+            }
+            return result;
+        }
+
     private:
         ConnectionHandler& connection_handler()
         {
@@ -665,8 +795,8 @@ namespace hpx::parcelset {
 
     private:
         ///////////////////////////////////////////////////////////////////////
-        std::shared_ptr<connection> get_connection(
-            locality const& l, bool /* force */, error_code& ec)
+        std::shared_ptr<connection> get_connection(locality const& l,
+            bool /* force */, bool priority, error_code& ec)
         {
             // Request new connection from connection cache.
             std::shared_ptr<connection> sender_connection;
@@ -680,7 +810,8 @@ namespace hpx::parcelset {
             else
             {
                 // Get a connection or reserve space for a new connection.
-                if (!connection_cache_.get_or_reserve(l, sender_connection))
+                if (!lane_connection_cache(priority).get_or_reserve(
+                        l, sender_connection))
                 {
                     // If no slot is available it's not a problem as the parcel
                     // will be sent out whenever the next connection is returned
@@ -704,8 +835,51 @@ namespace hpx::parcelset {
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void enqueue_parcel(
-            locality const& locality_id, parcel&& p, write_handler_type&& f)
+        // Parcels of actions with a high priority (see traits::action_priority)
+        // bypass the parcels queued for the same destination.
+        bool use_priority_lane(parcel const& p)
+        {
+            if (!priority_lanes())
+                return false;
+
+            // parcels sent immediately bypass the lanes
+            if (connection_handler_traits<
+                    ConnectionHandler>::send_immediate_parcels::value &&
+                can_send_immediate_impl())
+            {
+                return false;
+            }
+
+            switch (p.get_thread_priority())
+            {
+            case threads::thread_priority::high_recursive:
+                [[fallthrough]];
+            case threads::thread_priority::boost:
+                [[fallthrough]];
+            case threads::thread_priority::high:
+                [[fallthrough]];
+            case threads::thread_priority::bound:
+                return true;
+
+            default:
+                break;
+            }
+            return false;
+        }
+
+        pending_parcels_map& pending_parcels(bool priority) noexcept
+        {
+            return priority ? pending_priority_parcels_ : pending_parcels_;
+        }
+
+        util::connection_cache<connection, locality>& lane_connection_cache(
+            bool priority) noexcept
+        {
+            return priority ? priority_connection_cache_ : connection_cache_;
+        }
+
+        void enqueue_parcel(locality const& locality_id, parcel&& p,
+            write_handler_type&& f, bool priority = false)
         {
             using mapped_type = pending_parcels_map::mapped_type;
 
@@ -713,7 +887,7 @@ namespace hpx::parcelset {
 
             [[maybe_unused]] util::ignore_while_checking il(&l);
 
-            mapped_type& e = pending_parcels_[locality_id];
+            mapped_type& e = pending_parcels(priority)[locality_id];
             hpx::get<0>(e).push_back(HPX_MOVE(p));
             hpx::get<1>(e).push_back(HPX_MOVE(f));
 
@@ -726,7 +900,7 @@ namespace hpx::parcelset {
 
         void enqueue_parcels(locality const& locality_id,
             std::vector<parcel>&& parcels,
-            std::vector<write_handler_type>&& handlers)
+            std::vector<write_handler_type>&& handlers, bool priority = false)
         {
             using mapped_type = pending_parcels_map::mapped_type;
 
@@ -736,7 +910,7 @@ namespace hpx::parcelset {
 
             HPX_ASSERT(parcels.size() == handlers.size());
 
-            mapped_type& e = pending_parcels_[locality_id];
+            mapped_type& e = pending_parcels(priority)[locality_id];
             if (hpx::get<0>(e).empty())
             {
                 HPX_ASSERT(hpx::get<1>(e).empty());
@@ -764,24 +938,112 @@ namespace hpx::parcelset {
             }
         }
 
+        // Split the given parcels into the normal and the priority lane and
+        // send them out
+        void enqueue_parcels_by_lane(locality const& locality_id,
+            std::vector<parcel>&& parcels,
+            std::vector<write_handler_type>&& handlers)
+        {
+            auto const is_priority = [this](parcel const& p) {
+                return use_priority_lane(p);
+            };
+
+            std::size_t const num_priority = static_cast<std::size_t>(
+                std::count_if(parcels.begin(), parcels.end(), is_priority));
+
+            if (num_priority == 0 || num_priority == parcels.size())
+            {
+                bool const priority = num_priority != 0;
+                enqueue_parcels(locality_id, HPX_MOVE(parcels),
+                    HPX_MOVE(handlers), priority);
+                get_connection_and_send_parcels(locality_id, priority);
+                return;
+            }
+
+            std::vector<parcel> priority_parcels;
+            std::vector<write_handler_type> priority_handlers;
+            priority_parcels.reserve(num_priority);
+            priority_handlers.reserve(num_priority);
+
+            std::size_t j = 0;
+            for (std::size_t i = 0; i != parcels.size(); ++i)
+            {
+                if (is_priority(parcels[i]))
+                {
+                    priority_parcels.push_back(HPX_MOVE(parcels[i]));
+                    priority_handlers.push_back(HPX_MOVE(handlers[i]));
+                }
+                else
+                {
+                    if (i != j)
+                    {
+                        parcels[j] = HPX_MOVE(parcels[i]);
+                        handlers[j] = HPX_MOVE(handlers[i]);
+                    }
+                    ++j;
+                }
+            }
+            parcels.erase(parcels.begin() + j, parcels.end());
+            handlers.erase(handlers.begin() + j, handlers.end());
+
+            enqueue_parcels(locality_id, HPX_MOVE(priority_parcels),
+                HPX_MOVE(priority_handlers), true);
+            enqueue_parcels(
+                locality_id, HPX_MOVE(parcels), HPX_MOVE(handlers), false);
+
+            get_connection_and_send_parcels(locality_id, true);
+            get_connection_and_send_parcels(locality_id, false);
+        }
+
         bool dequeue_parcels(locality const& locality_id,
             std::vector<parcel>& parcels,
-            std::vector<write_handler_type>& handlers)
+            std::vector<write_handler_type>& handlers, bool priority = false)
         {
             std::unique_lock const l(mtx_, std::try_to_lock);
             if (!l.owns_lock())
                 return false;
 
-            auto const it = pending_parcels_.find(locality_id);
+            pending_parcels_map& pending = pending_parcels(priority);
+            auto const it = pending.find(locality_id);
 
             // do nothing if parcels have already been picked up by another
             // thread
-            if (it != pending_parcels_.end() &&
+            if (it != pending.end() &&
                 !hpx::get<0>(it->second).empty())
             {
                 HPX_ASSERT(it->first == locality_id);
                 HPX_ASSERT(handlers.empty());
                 HPX_ASSERT(handlers.size() == parcels.size());
+
+                std::vector<parcel>& pending_parcels = hpx::get<0>(it->second);
+                std::vector<write_handler_type>& pending_handlers =
+                    hpx::get<1>(it->second);
+
+                // send only the first stripe of parcels, the remaining parcels
+                // stay pending for the next connection
+                std::size_t const count = stripe_count(pending_parcels);
+                if (count != pending_parcels.size())
+                {
+                    HPX_ASSERT(count != 0 && count < pending_parcels.size());
+
+                    parcels.assign(
+                        std::make_move_iterator(pending_parcels.begin()),
+                        std::make_move_iterator(
+                            pending_parcels.begin() + count));
+                    pending_parcels.erase(pending_parcels.begin(),
+                        pending_parcels.begin() + count);
+
+                    handlers.assign(
+                        std::make_move_iterator(pending_handlers.begin()),
+                        std::make_move_iterator(
+                            pending_handlers.begin() + count));
+                    pending_handlers.erase(pending_handlers.begin(),
+                        pending_handlers.begin() + count);
+
+                    ++striped_messages_;
+                    return true;
+                }
+
                 std::swap(parcels, hpx::get<0>(it->second));
                 HPX_ASSERT(hpx::get<0>(it->second).empty());
                 std::swap(handlers, hpx::get<1>(it->second));
@@ -791,19 +1053,145 @@ namespace hpx::parcelset {
             }
             else
             {
-                HPX_ASSERT(hpx::get<1>(it->second).empty());
+                HPX_ASSERT(
+                    it == pending.end() || hpx::get<1>(it->second).empty());
                 return false;
             }
 
-            parcel_destinations_.erase(locality_id);
+            // the destination stays registered as long as parcels are pending
+            // in the other lane
+            pending_parcels_map const& other = pending_parcels(!priority);
+            if (auto const oit = other.find(locality_id);
+                oit != other.end() && !hpx::get<0>(oit->second).empty())
+            {
+                return true;
+            }
 
-            HPX_ASSERT(
-                0 != num_parcel_destinations_.load(std::memory_order_relaxed));
-            --num_parcel_destinations_;
+            if (parcel_destinations_.erase(locality_id) != 0)
+            {
+                HPX_ASSERT(0 !=
+                    num_parcel_destinations_.load(std::memory_order_relaxed));
+                --num_parcel_destinations_;
+            }
 
             return true;
         }
 
+        // Return the number of pending parcels to send in the next message. If
+        // striping is enabled, the parcels pending for a destination are
+        // split into messages of about stripe_size (estimated) bytes which
+        // are sent concurrently over several connections. Parcels larger than
+        // that are sent in a message of their own, which avoids small parcels
+        // being delayed by large ones.
+        std::size_t stripe_count(
+            std::vector<parcel> const& parcels) const noexcept
+        {
+            std::size_t const stripe_size = get_stripe_size();
+            if (stripe_size == 0)
+                return parcels.size();
+
+            std::size_t size = 0;
+            for (std::size_t i = 0; i != parcels.size(); ++i)
+            {
+                std::size_t const parcel_size = parcels[i].size();
+                size += parcel_size;
+                if (size >= stripe_size)
+                {
+                    return (i != 0 && parcel_size >= stripe_size) ? i : i + 1;
+                }
+            }
+            return parcels.size();
+        }
+
+        // Split the zero-copy data of the encoded message over several
+        // connections to the destination if it is larger than stripe_size.
+        // The message carries the first part of the data, the other parts are
+        // sent as fragments over additional connections (as far as those are
+        // available right away) and are reassembled by the receiving end.
+        // Returns the number of bytes sent as fragments.
+        std::size_t stripe_zero_copy_data(locality const& dest,
+            std::shared_ptr<connection> const& sender_connection,
+            bool priority)
+        {
+            if constexpr (!connection_handler_traits<
+                              ConnectionHandler>::stripe_zero_copy_chunks::value)
+            {
+                return 0;
+            }
+            else
+            {
+                auto const& buffer = sender_connection->buffer_;
+
+                std::size_t const stripe_size = get_stripe_size();
+                std::size_t const zero_copy_size =
+                    message_size(buffer) - buffer.data_.size();
+                if (stripe_size == 0 || zero_copy_size <= stripe_size)
+                    return 0;
+
+                std::size_t const max_parts =
+                    (zero_copy_size + stripe_size - 1) / stripe_size;
+
+                std::vector<std::shared_ptr<connection>> fragment_connections;
+                fragment_connections.reserve(max_parts - 1);
+                while (fragment_connections.size() + 1 != max_parts)
+                {
+                    error_code ec(throwmode::lightweight);
+                    std::shared_ptr<connection> conn =
+                        get_connection(dest, false, priority, ec);
+                    if (!conn || ec)
+                        break;
+
+                    fragment_connections.push_back(HPX_MOVE(conn));
+                }
+
+                if (fragment_connections.empty())
+                    return 0;
+
+                // the message itself carries the remainder of the division
+                std::size_t const num_parts = fragment_connections.size() + 1;
+                std::size_t const part_size = zero_copy_size / num_parts;
+                std::size_t offset =
+                    zero_copy_size - part_size * (num_parts - 1);
+
+                sender_connection->set_stripe(
+                    connection_handler().create_stripe_header(offset),
+                    num_parts);
+
+                for (auto& conn : fragment_connections)
+                {
+                    lane_connection_cache(priority).add_outstanding_bytes(
+                        dest, conn, part_size);
+
+                    ++operations_in_flight_;
+                    ++striped_fragments_;
+
+                    conn->async_write_fragment(*sender_connection, offset,
+                        part_size,
+                        hpx::bind_front(
+                            &parcelport_impl::send_pending_parcels_trampoline,
+                            this, priority));
+
+                    offset += part_size;
+                }
+                HPX_ASSERT(offset == zero_copy_size);
+
+                return part_size * (num_parts - 1);
+            }
+        }
+
+        // the overall number of bytes of the encoded message
+        template <typename Buffer>
+        static std::size_t message_size(Buffer const& buffer) noexcept
+        {
+            std::size_t size = buffer.data_.size();
+            for (std::size_t i = 0; i != buffer.num_chunks_.first; ++i)
+            {
+                size += static_cast<std::size_t>(
+                    buffer.transmission_chunks_[i].second);
+            }
+            return size;
+        }
+
     protected:
         bool dequeue_parcel(
             locality& dest, parcel& p, write_handler_type& handler)
@@ -812,23 +1200,28 @@ namespace hpx::parcelset {
             if (!l.owns_lock())
                 return false;
 
-            for (auto& pending : pending_parcels_)
+            // parcels from the priority lane are handed out first
+            for (pending_parcels_map* pending_map :
+                {&pending_priority_parcels_, &pending_parcels_})
             {
-                auto& parcels = hpx::get<0>(pending.second);
-                if (!parcels.empty())
+                for (auto& pending : *pending_map)
                 {
-                    auto& handlers = hpx::get<1>(pending.second);
-                    dest = pending.first;
-                    p = HPX_MOVE(parcels.back());
-                    parcels.pop_back();
-                    handler = HPX_MOVE(handlers.back());
-                    handlers.pop_back();
-
-                    if (parcels.empty())
+                    auto& parcels = hpx::get<0>(pending.second);
+                    if (!parcels.empty())
                     {
-                        pending_parcels_.erase(dest);
+                        auto& handlers = hpx::get<1>(pending.second);
+                        dest = pending.first;
+                        p = HPX_MOVE(parcels.back());
+                        parcels.pop_back();
+                        handler = HPX_MOVE(handlers.back());
+                        handlers.pop_back();
+
+                        if (parcels.empty())
+                        {
+                            pending_map->erase(dest);
+                        }
+                        return true;
                     }
-                    return true;
                 }
             }
             return false;
@@ -840,6 +1233,7 @@ namespace hpx::parcelset {
                 return true;
 
             std::vector<locality> destinations;
+            std::vector<locality> priority_destinations;
 
             {
                 std::unique_lock const l(mtx_, std::try_to_lock);
@@ -849,18 +1243,36 @@ namespace hpx::parcelset {
                 if (parcel_destinations_.empty())
                     return true;
 
+                auto const has_pending = [](pending_parcels_map const& pending,
+                                             locality const& loc) {
+                    auto const it = pending.find(loc);
+                    return it != pending.end() &&
+                        !hpx::get<0>(it->second).empty();
+                };
+
                 destinations.reserve(parcel_destinations_.size());
                 for (locality const& loc : parcel_destinations_)
                 {
-                    destinations.push_back(loc);
+                    if (has_pending(pending_priority_parcels_, loc))
+                    {
+                        priority_destinations.push_back(loc);
+                    }
+                    if (has_pending(pending_parcels_, loc))
+                    {
+                        destinations.push_back(loc);
+                    }
                 }
             }
 
             // Create new HPX threads which send the parcels that are still
-            // pending.
+            // pending, high priority parcels are sent first.
+            for (locality const& loc : priority_destinations)
+            {
+                get_connection_and_send_parcels(loc, true);
+            }
             for (locality const& loc : destinations)
             {
-                get_connection_and_send_parcels(loc);
+                get_connection_and_send_parcels(loc, false);
             }
 
             return true;
@@ -869,12 +1281,25 @@ namespace hpx::parcelset {
     private:
         ///////////////////////////////////////////////////////////////////////
         void get_connection_and_send_parcels(
-            locality const& locality_id, bool /* background */ = false)
+            locality const& locality_id, bool priority = false)
         {
             if (connection_handler_traits<
                     ConnectionHandler>::send_immediate_parcels::value &&
                 can_send_immediate_impl())
             {
+                // The lanes are bypassed while parcels are sent immediately.
+                // Parcels queued in the priority lane before are handed over
+                // to the normal lane.
+                if (priority)
+                {
+                    std::vector<parcel> parcels;
+                    std::vector<write_handler_type> handlers;
+                    if (dequeue_parcels(locality_id, parcels, handlers, true))
+                    {
+                        enqueue_parcels(locality_id, HPX_MOVE(parcels),
+                            HPX_MOVE(handlers), false);
+                    }
+                }
                 send_immediate_impl(locality_id, nullptr, nullptr, 0);
                 return;
             }
@@ -885,7 +1310,7 @@ namespace hpx::parcelset {
 
             error_code ec;
             std::shared_ptr<connection> sender_connection =
-                get_connection(locality_id, force_connection, ec);
+                get_connection(locality_id, force_connection, priority, ec);
 
             if (!sender_connection)
             {
@@ -899,22 +1324,40 @@ namespace hpx::parcelset {
             std::vector<parcel> parcels;
             std::vector<write_handler_type> handlers;
 
-            if (!dequeue_parcels(locality_id, parcels, handlers))
+            if (!dequeue_parcels(locality_id, parcels, handlers, priority))
             {
                 // Give this connection back to the cache as we couldn't dequeue
                 // parcels.
-                connection_cache_.reclaim(locality_id, sender_connection);
+                lane_connection_cache(priority).reclaim(
+                    locality_id, sender_connection);
             }
             else
             {
                 // send parcels if they didn't get sent by another connection
                 send_pending_parcels(locality_id, sender_connection,
-                    HPX_MOVE(parcels), HPX_MOVE(handlers));
+                    HPX_MOVE(parcels), HPX_MOVE(handlers), priority);
+
+                // send the remaining stripes using other connections, if
+                // available
+                if (get_stripe_size() != 0 &&
+                    has_pending_parcels(locality_id, priority))
+                {
+                    get_connection_and_send_parcels(locality_id, priority);
+                }
             }
         }
 
-        void send_pending_parcels_trampoline(std::error_code const& ec,
-            locality const& locality_id,
+        bool has_pending_parcels(locality const& locality_id, bool priority)
+        {
+            std::lock_guard l(mtx_);
+
+            pending_parcels_map const& pending = pending_parcels(priority);
+            auto const it = pending.find(locality_id);
+            return it != pending.end() && !hpx::get<0>(it->second).empty();
+        }
+
+        void send_pending_parcels_trampoline(bool priority,
+            std::error_code const& ec, locality const& locality_id,
             std::shared_ptr<connection> sender_connection)
         {
             HPX_ASSERT(operations_in_flight_ != 0);
@@ -927,35 +1370,32 @@ namespace hpx::parcelset {
             {
                 // Give this connection back to the cache as it's not
                 // needed anymore.
-                connection_cache_.reclaim(locality_id, sender_connection);
+                lane_connection_cache(priority).reclaim(
+                    locality_id, sender_connection);
             }
             else
             {
                 // remove this connection from cache
-                connection_cache_.clear(locality_id, sender_connection);
+                lane_connection_cache(priority).clear(
+                    locality_id, sender_connection);
             }
 
+            // HPX_ASSERT(locality_id == sender_connection->destination());
+            if (!has_pending_parcels(locality_id, priority))
             {
-                std::lock_guard l(mtx_);
-
-                // HPX_ASSERT(locality_id == sender_connection->destination());
-                if (auto const it = pending_parcels_.find(locality_id);
-                    it == pending_parcels_.end() ||
-                    hpx::get<0>(it->second).empty())
-                {
-                    return;
-                }
+                return;
             }
 
             // Create a new HPX thread which sends parcels that are still
             // pending.
-            get_connection_and_send_parcels(locality_id);
+            get_connection_and_send_parcels(locality_id, priority);
         }
 
         void send_pending_parcels(parcelset::locality const& parcel_locality_id,
             std::shared_ptr<connection> sender_connection,
             std::vector<parcel>&& parcels,                 //-V826
-            std::vector<write_handler_type>&& handlers)    //-V826
+            std::vector<write_handler_type>&& handlers,    //-V826
+            bool priority)
         {
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
             sender_connection->set_state(connection::state_send_pending);
@@ -966,11 +1406,43 @@ namespace hpx::parcelset {
             // HPX_ASSERT(parcel_locality_id == sender_connection->destination());
             sender_connection->verify_(parcel_locality_id);
 #endif
+            // Compressing the parcels may take a while, this should not be
+            // done on one of the networking threads.
+            if (threads::get_self_ptr() == nullptr && !parcels.empty())
+            {
+                std::unique_ptr<serialization::binary_filter> const filter(
+                    parcels[0].get_serialization_filter());
+
+                if (filter)
+                {
+                    connection_handler().reschedule_on_thread(
+                        util::deferred_call(
+                            &parcelport_impl::send_pending_parcels, this,
+                            parcel_locality_id, HPX_MOVE(sender_connection),
+                            HPX_MOVE(parcels), HPX_MOVE(handlers), priority),
+                        threads::thread_schedule_state::pending,
+                        "send_pending_parcels");
+                    return;
+                }
+            }
+
             // encode the parcels
             std::size_t const num_parcels = encode_parcels(*this,
                 parcels.data(), parcels.size(), sender_connection->buffer_,
                 archive_flags_, this->get_max_outbound_message_size());
 
+            add_parcel_lane_statistics(
+                priority, static_cast<std::int64_t>(num_parcels));
+
+            // send parts of large zero-copy data over other connections
+            std::size_t const striped_bytes = stripe_zero_copy_data(
+                parcel_locality_id, sender_connection, priority);
+
+            // the message is outstanding until it has been delivered
+            lane_connection_cache(priority).add_outstanding_bytes(
+                parcel_locality_id, sender_connection,
+                message_size(sender_connection->buffer_) - striped_bytes);
+
             using hpx::parcelset::detail::call_for_each;
             if (num_parcels == parcels.size())
             {
@@ -981,7 +1453,7 @@ namespace hpx::parcelset {
                     call_for_each(HPX_MOVE(handlers), HPX_MOVE(parcels)),
                     hpx::bind_front(
                         &parcelport_impl::send_pending_parcels_trampoline,
-                        this));
+                        this, priority));
             }
             else
             {
@@ -1008,15 +1480,15 @@ namespace hpx::parcelset {
                         HPX_MOVE(handled_handlers), HPX_MOVE(handled_parcels)),
                     hpx::bind_front(
                         &parcelport_impl::send_pending_parcels_trampoline,
-                        this));
+                        this, priority));
 
                 // give back unhandled parcels
                 parcels.erase(parcels.begin(), parcels.begin() + num_parcels);
                 handlers.erase(
                     handlers.begin(), handlers.begin() + num_parcels);
 
-                enqueue_parcels(
-                    parcel_locality_id, HPX_MOVE(parcels), HPX_MOVE(handlers));
+                enqueue_parcels(parcel_locality_id, HPX_MOVE(parcels),
+                    HPX_MOVE(handlers), priority);
             }
 
             // We yield here for a short amount of time to give another HPX
@@ -1038,11 +1510,21 @@ namespace hpx::parcelset {
         /// The connection cache for sending connections
         util::connection_cache<connection, locality> connection_cache_;
 
+        /// The connections reserved for sending high priority parcels
+        util::connection_cache<connection, locality> priority_connection_cache_;
+
         using mutex_type = hpx::spinlock;
 
         int archive_flags_;
         hpx::util::atomic_count operations_in_flight_;
 
+        // number of messages holding only part of the pending parcels
+        std::atomic<std::int64_t> striped_messages_;
+
+        // number of fragments of zero-copy data sent over other connections
+        // than the message they belong to
+        std::atomic<std::int64_t> striped_fragments_;
+
         std::atomic<std::size_t> num_thread_;
         std::size_t const max_background_thread_;
     };
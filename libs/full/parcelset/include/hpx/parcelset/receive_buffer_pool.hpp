@@ -0,0 +1,163 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/parcelset_base/parcelport.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset {
+
+    /// A pool of receive buffers owned by a single receiving connection. The
+    /// buffers are grouped into size classes (powers of two), a buffer which
+    /// is handed back keeps its capacity and is reused for the next message
+    /// of the same size class. The pool is not thread-safe.
+    ///
+    /// The pool statistics are accumulated locally and are periodically
+    /// added to the statistics of the owning parcelport.
+    template <typename BufferType>
+    class receive_buffer_pool
+    {
+    public:
+        // all buffers smaller than 2^min_size_class bytes share the smallest
+        // size class, buffers larger than 2^(max_size_class - 1) bytes are
+        // not pooled to avoid keeping large amounts of memory alive
+        static constexpr std::size_t min_size_class = 8;
+        static constexpr std::size_t max_size_class = 24;
+        static constexpr std::size_t max_buffers_per_class = 4;
+
+        explicit receive_buffer_pool(parcelport* pp = nullptr) noexcept
+          : pp_(pp)
+        {
+        }
+
+        receive_buffer_pool(receive_buffer_pool const&) = delete;
+        receive_buffer_pool(receive_buffer_pool&&) = delete;
+        receive_buffer_pool& operator=(receive_buffer_pool const&) = delete;
+        receive_buffer_pool& operator=(receive_buffer_pool&&) = delete;
+
+        ~receive_buffer_pool()
+        {
+            flush_statistics();
+        }
+
+        /// Return a buffer holding the given number of bytes
+        BufferType acquire(std::size_t size)
+        {
+            std::size_t const c = size_class(size);
+            if (c < max_size_class)
+            {
+                auto& buffers = buffers_[c];
+                if (!buffers.empty())
+                {
+                    BufferType buffer = HPX_MOVE(buffers.back());
+                    buffers.pop_back();
+                    buffer.resize(size);
+
+                    ++hits_;
+                    bytes_recycled_ += static_cast<std::int64_t>(size);
+                    update_statistics();
+                    return buffer;
+                }
+            }
+
+            // round up the capacity to the size class, this allows to reuse
+            // the buffer for all messages of the same size class
+            BufferType buffer;
+            if (c < max_size_class)
+            {
+                buffer.reserve(static_cast<std::size_t>(1) << c);
+            }
+            buffer.resize(size);
+
+            ++misses_;
+            update_statistics();
+            return buffer;
+        }
+
+        /// Hand back a buffer, the buffer is left empty
+        void release(BufferType& buffer) noexcept
+        {
+            // the capacity of the buffer covers all sizes of the largest
+            // size class not exceeding it
+            std::size_t const capacity = buffer.capacity();
+            if (capacity >= (static_cast<std::size_t>(1) << min_size_class) &&
+                capacity < (static_cast<std::size_t>(1) << max_size_class))
+            {
+                std::size_t c = min_size_class;
+                while ((static_cast<std::size_t>(1) << (c + 1)) <= capacity)
+                {
+                    ++c;
+                }
+
+                if (buffers_[c].size() < max_buffers_per_class)
+                {
+                    buffer.clear();
+                    buffers_[c].push_back(HPX_MOVE(buffer));
+                    buffer = BufferType();
+                    return;
+                }
+            }
+            buffer = BufferType();
+        }
+
+        /// Add the accumulated statistics to the owning parcelport
+        void flush_statistics() noexcept
+        {
+            if (pp_ != nullptr && (hits_ != 0 || misses_ != 0))
+            {
+                pp_->add_receive_buffer_pool_statistics(
+                    hits_, misses_, bytes_recycled_);
+            }
+            hits_ = 0;
+            misses_ = 0;
+            bytes_recycled_ = 0;
+            pending_ = 0;
+        }
+
+    private:
+        static constexpr std::size_t statistics_interval = 64;
+
+        // the smallest size class (at least min_size_class) holding buffers
+        // of the given size, max_size_class if the size is too large
+        static std::size_t size_class(std::size_t size) noexcept
+        {
+            std::size_t c = min_size_class;
+            while (c != max_size_class &&
+                (static_cast<std::size_t>(1) << c) < size)
+            {
+                ++c;
+            }
+            return c;
+        }
+
+        void update_statistics() noexcept
+        {
+            if (++pending_ == statistics_interval)
+            {
+                flush_statistics();
+            }
+        }
+
+        parcelport* pp_;
+        std::array<std::vector<BufferType>, max_size_class> buffers_;
+
+        std::int64_t hits_ = 0;
+        std::int64_t misses_ = 0;
+        std::int64_t bytes_recycled_ = 0;
+        std::size_t pending_ = 0;
+    };
+}    // namespace hpx::parcelset
+
+#endif
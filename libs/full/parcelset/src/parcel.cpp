@@ -42,7 +42,9 @@ namespace hpx::parcelset::detail {
 #if defined(HPX_HAVE_PARCEL_PROFILING)
       , start_time_(0)
       , creation_time_(chrono::high_resolution_timer::now())
-
+#endif
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+      , enqueue_time_(0)
 #endif
       , has_continuation_(false)
     {
@@ -56,6 +58,9 @@ namespace hpx::parcelset::detail {
 #if defined(HPX_HAVE_PARCEL_PROFILING)
       , start_time_(0)
       , creation_time_(chrono::high_resolution_timer::now())
+#endif
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+      , enqueue_time_(0)
 #endif
       , has_continuation_(has_continuation)
     {
@@ -69,6 +74,9 @@ namespace hpx::parcelset::detail {
       , parcel_id_(HPX_MOVE(rhs.parcel_id_))
       , start_time_(rhs.start_time_)
       , creation_time_(rhs.creation_time_)
+#endif
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+      , enqueue_time_(rhs.enqueue_time_)
 #endif
       , has_continuation_(rhs.has_continuation_)
     {
@@ -80,6 +88,9 @@ namespace hpx::parcelset::detail {
         rhs.parcel_id_ = naming::invalid_gid;
         rhs.start_time_ = 0;
         rhs.creation_time_ = 0;
+#endif
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        rhs.enqueue_time_ = 0;
 #endif
     }
 
@@ -92,6 +103,9 @@ namespace hpx::parcelset::detail {
         parcel_id_ = HPX_MOVE(rhs.parcel_id_);
         start_time_ = rhs.start_time_;
         creation_time_ = rhs.creation_time_;
+#endif
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        enqueue_time_ = rhs.enqueue_time_;
 #endif
         has_continuation_ = rhs.has_continuation_;
 
@@ -102,6 +116,9 @@ namespace hpx::parcelset::detail {
         rhs.parcel_id_ = naming::invalid_gid;
         rhs.start_time_ = 0;
         rhs.creation_time_ = 0;
+#endif
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        rhs.enqueue_time_ = 0;
 #endif
         return *this;
     }
@@ -289,6 +306,24 @@ namespace hpx::parcelset::detail {
 #endif
     }
 
+    std::uint64_t parcel::enqueue_time() const
+    {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        return data_.enqueue_time_;
+#else
+        return 0;
+#endif
+    }
+
+    void parcel::set_enqueue_time(std::uint64_t time)
+    {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        data_.enqueue_time_ = time;
+#else
+        HPX_UNUSED(time);
+#endif
+    }
+
     threads::thread_priority parcel::get_thread_priority() const
     {
         return action_->get_thread_priority();
@@ -1263,6 +1263,16 @@ namespace hpx::parcelset {
         return pp ? pp->get_zchunks_recv_size_max(reset) : 0;
     }
 
+    // the latency of the given phase below which the given percentage of all
+    // parcels or messages fall (nanoseconds)
+    std::int64_t parcelhandler::get_parcel_latency(std::string const& pp_type,
+        parcel_latency_phase phase, double percentage, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_parcel_latency(phase, percentage, reset) : 0;
+    }
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
@@ -1323,6 +1333,19 @@ namespace hpx::parcelset {
         parcelport* pp = find_parcelport(pp_type, ec);
         return pp ? pp->get_action_data_received(action, reset) : 0;
     }
+
+    // the latency of the given phase below which the given percentage of the
+    // parcels fall (nanoseconds)
+    std::int64_t parcelhandler::get_action_parcel_latency(
+        std::string const& pp_type, parcel_latency_phase phase,
+        double percentage, std::string const& action, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ?
+            pp->get_action_parcel_latency(phase, percentage, action, reset) :
+            0;
+    }
 #endif
 #endif
     // connection stack statistics
@@ -1336,6 +1359,39 @@ namespace hpx::parcelset {
         return pp ? pp->get_connection_cache_statistics(stat_type, reset) : 0;
     }
 
+    // per-connection statistics
+    std::vector<std::int64_t> parcelhandler::get_connection_statistics(
+        std::string const& pp_type,
+        parcelport::connection_statistics_type stat_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_connection_statistics(stat_type, reset) :
+                    std::vector<std::int64_t>();
+    }
+
+    // receive buffer pool statistics
+    std::int64_t parcelhandler::get_receive_buffer_pool_statistics(
+        std::string const& pp_type,
+        parcelport::receive_buffer_pool_statistics_type stat_type,
+        bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_receive_buffer_pool_statistics(stat_type, reset) :
+                    0;
+    }
+
+    // parcel lane statistics
+    std::int64_t parcelhandler::get_parcel_lane_statistics(
+        std::string const& pp_type,
+        parcelport::parcel_lane_statistics_type stat_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_parcel_lane_statistics(stat_type, reset) : 0;
+    }
+
     std::vector<plugins::parcelport_factory_base*>&
     parcelhandler::get_parcelport_factories()
     {
@@ -1410,6 +1466,8 @@ namespace hpx::parcelset {
                               "$[hpx.parcel.zero_copy_optimization]}");
         ini_defs.emplace_back(
             "async_serialization = ${HPX_PARCEL_ASYNC_SERIALIZATION:1}");
+        ini_defs.emplace_back(
+            "priority_lanes = ${HPX_PARCEL_PRIORITY_LANES:0}");
 #if defined(HPX_HAVE_PARCEL_COALESCING)
         ini_defs.emplace_back(
             "message_handlers = ${HPX_PARCEL_MESSAGE_HANDLERS:1}");
@@ -1421,6 +1479,9 @@ namespace hpx::parcelset {
             "zero_copy_serialization_threshold = "
             "${HPX_PARCEL_ZERO_COPY_SERIALIZATION_THRESHOLD:" HPX_PP_STRINGIZE(
                 HPX_ZERO_COPY_SERIALIZATION_THRESHOLD) "}");
+        ini_defs.emplace_back("parallel_encoding_threshold = "
+                              "${HPX_PARCEL_PARALLEL_ENCODING_THRESHOLD:0}");
+        ini_defs.emplace_back("stripe_size = ${HPX_PARCEL_STRIPE_SIZE:0}");
         ini_defs.emplace_back("max_background_threads = "
                               "${HPX_PARCEL_MAX_BACKGROUND_THREADS:-1}");
 
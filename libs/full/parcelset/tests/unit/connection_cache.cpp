@@ -0,0 +1,237 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset/connection_cache.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct dummy_connection
+{
+};
+
+using cache_type = hpx::util::connection_cache<dummy_connection, int>;
+using connection_type = cache_type::connection_type;
+
+constexpr int destination = 1;
+
+std::vector<connection_type> create_connections(
+    cache_type& cache, std::size_t count)
+{
+    std::vector<connection_type> connections;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        connection_type conn;
+        HPX_TEST(cache.get_or_reserve(destination, conn));
+        HPX_TEST(!conn);
+
+        connections.push_back(std::make_shared<dummy_connection>());
+    }
+    return connections;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_outstanding_bytes()
+{
+    cache_type cache(8, 4);
+
+    std::vector<connection_type> connections = create_connections(cache, 3);
+    HPX_TEST_EQ(cache.get_busy_connections(false), std::int64_t(3));
+
+    cache.add_outstanding_bytes(destination, connections[0], 1000);
+    cache.add_outstanding_bytes(destination, connections[1], 10);
+    cache.add_outstanding_bytes(destination, connections[2], 500);
+
+    HPX_TEST_EQ(cache.outstanding_bytes(destination), std::size_t(1510));
+    HPX_TEST_EQ(cache.outstanding_bytes(2), std::size_t(0));
+    HPX_TEST_EQ(cache.get_outstanding_bytes(false), std::int64_t(1510));
+
+    // the bytes are outstanding until the connection is returned
+    cache.reclaim(destination, connections[0]);
+    HPX_TEST_EQ(cache.outstanding_bytes(destination), std::size_t(510));
+    HPX_TEST_EQ(cache.get_busy_connections(false), std::int64_t(2));
+
+    cache.reclaim(destination, connections[1]);
+    cache.reclaim(destination, connections[2]);
+    HPX_TEST_EQ(cache.outstanding_bytes(destination), std::size_t(0));
+    HPX_TEST_EQ(cache.get_outstanding_bytes(false), std::int64_t(0));
+    HPX_TEST_EQ(cache.get_busy_connections(false), std::int64_t(0));
+
+    // the overall load of each connection is retained
+    std::vector<hpx::util::connection_load> const loads =
+        cache.get_connection_loads(destination);
+    HPX_TEST_EQ(loads.size(), std::size_t(3));
+
+    std::uint64_t bytes_sent = 0;
+    for (hpx::util::connection_load const& load : loads)
+    {
+        HPX_TEST_EQ(load.outstanding_bytes, std::size_t(0));
+        HPX_TEST_EQ(load.messages_sent, std::uint64_t(1));
+        bytes_sent += load.bytes_sent;
+    }
+    HPX_TEST_EQ(bytes_sent, std::uint64_t(1510));
+
+    // removing a destination releases its outstanding bytes
+    connection_type conn = cache.get(destination);
+    HPX_TEST(conn);
+    cache.add_outstanding_bytes(destination, conn, 100);
+    HPX_TEST_EQ(cache.get_outstanding_bytes(false), std::int64_t(100));
+
+    cache.clear(destination);
+    HPX_TEST_EQ(cache.get_outstanding_bytes(false), std::int64_t(0));
+    HPX_TEST(cache.get_connection_loads(destination).empty());
+}
+
+// the least loaded of the available connections is handed out
+void test_least_loaded()
+{
+    cache_type cache(8, 4);
+
+    std::vector<connection_type> connections = create_connections(cache, 3);
+
+    cache.add_outstanding_bytes(destination, connections[0], 1000);
+    cache.add_outstanding_bytes(destination, connections[1], 10);
+    cache.add_outstanding_bytes(destination, connections[2], 500);
+
+    for (connection_type const& conn : connections)
+    {
+        cache.reclaim(destination, conn);
+    }
+
+    connection_type conn = cache.get(destination);
+    HPX_TEST(conn == connections[1]);
+    cache.add_outstanding_bytes(destination, conn, 2000);
+    cache.reclaim(destination, conn);
+
+    HPX_TEST(cache.get_or_reserve(destination, conn));
+    HPX_TEST(conn == connections[2]);
+
+    // the remaining connections are handed out by increasing load
+    connection_type conn2 = cache.get(destination);
+    HPX_TEST(conn2 == connections[0]);
+
+    connection_type conn3 = cache.get(destination);
+    HPX_TEST(conn3 == connections[1]);
+
+    HPX_TEST(!cache.get(destination));
+
+    cache.reclaim(destination, conn);
+    cache.reclaim(destination, conn2);
+    cache.reclaim(destination, conn3);
+    HPX_TEST_EQ(cache.get_busy_connections(false), std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// a connection which keeps messages in flight after having been returned to
+// the cache (as streaming connections do)
+struct reporting_connection
+{
+    std::size_t outstanding_bytes() const noexcept
+    {
+        return in_flight;
+    }
+
+    std::size_t in_flight = 0;
+};
+
+using reporting_cache_type =
+    hpx::util::connection_cache<reporting_connection, int>;
+using reporting_connection_type = reporting_cache_type::connection_type;
+
+// the load of cached connections is the number of bytes they have in flight
+void test_bytes_in_flight()
+{
+    reporting_cache_type cache(8, 4);
+
+    std::vector<reporting_connection_type> connections;
+    for (std::size_t i = 0; i != 3; ++i)
+    {
+        reporting_connection_type conn;
+        HPX_TEST(cache.get_or_reserve(destination, conn));
+        HPX_TEST(!conn);
+
+        connections.push_back(std::make_shared<reporting_connection>());
+    }
+
+    // the bytes are accounted for by the connections themselves
+    connections[0]->in_flight = 1000;
+    connections[1]->in_flight = 10;
+    connections[2]->in_flight = 500;
+
+    cache.add_outstanding_bytes(destination, connections[0], 1000);
+    cache.add_outstanding_bytes(destination, connections[1], 10);
+    cache.add_outstanding_bytes(destination, connections[2], 500);
+
+    for (reporting_connection_type const& conn : connections)
+    {
+        cache.reclaim(destination, conn);
+    }
+
+    // the messages are still in flight after the connections were returned
+    HPX_TEST_EQ(cache.get_busy_connections(false), std::int64_t(0));
+    HPX_TEST_EQ(cache.outstanding_bytes(destination), std::size_t(1510));
+    HPX_TEST_EQ(cache.get_outstanding_bytes(false), std::int64_t(1510));
+
+    // the connection with the least bytes in flight is handed out, even if
+    // it has sent more bytes overall
+    connections[1]->in_flight = 2000;
+    connections[2]->in_flight = 0;
+
+    reporting_connection_type conn = cache.get(destination);
+    HPX_TEST(conn == connections[2]);
+    cache.reclaim(destination, conn);
+
+    // the per-connection loads are reported for all destinations
+    std::vector<hpx::util::connection_load> loads =
+        cache.get_connection_loads(true);
+    HPX_TEST_EQ(loads.size(), std::size_t(3));
+
+    std::size_t in_flight = 0;
+    std::uint64_t bytes_sent = 0;
+    for (hpx::util::connection_load const& load : loads)
+    {
+        HPX_TEST_EQ(load.messages_sent, std::uint64_t(1));
+        in_flight += load.outstanding_bytes;
+        bytes_sent += load.bytes_sent;
+    }
+    HPX_TEST_EQ(in_flight, std::size_t(3000));
+    HPX_TEST_EQ(bytes_sent, std::uint64_t(1510));
+
+    // the overall bytes and messages were reset, the bytes in flight are not
+    loads = cache.get_connection_loads(false);
+    HPX_TEST_EQ(loads.size(), std::size_t(3));
+
+    in_flight = 0;
+    for (hpx::util::connection_load const& load : loads)
+    {
+        HPX_TEST_EQ(load.messages_sent, std::uint64_t(0));
+        HPX_TEST_EQ(load.bytes_sent, std::uint64_t(0));
+        in_flight += load.outstanding_bytes;
+    }
+    HPX_TEST_EQ(in_flight, std::size_t(3000));
+}
+
+int main()
+{
+    test_outstanding_bytes();
+    test_least_loaded();
+    test_bytes_in_flight();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
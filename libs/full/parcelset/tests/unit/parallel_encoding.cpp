@@ -0,0 +1,156 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test sends large batches of parcels, these are encoded using several
+// threads if hpx.parcel.parallel_encoding_threshold is set.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/shared_ptr.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t numparcels_default = 256;
+
+///////////////////////////////////////////////////////////////////////////////
+double sum(std::vector<double> const& data)
+{
+    double result = 0.0;
+    for (double d : data)
+    {
+        result += d;
+    }
+    return result;
+}
+HPX_PLAIN_ACTION(sum)
+
+// both arguments refer to the same object, the receiving side has to see
+// this as well
+bool shared(std::shared_ptr<std::vector<double>> const& lhs,
+    std::shared_ptr<std::vector<double>> const& rhs)
+{
+    return lhs == rhs && lhs->size() == static_cast<std::size_t>((*lhs)[0]);
+}
+HPX_PLAIN_ACTION(shared)
+
+template <typename Action, typename T, typename... Ts>
+hpx::parcelset::parcel generate_parcel(hpx::id_type const& dest_id,
+    hpx::id_type const& cont, std::size_t size, Ts&&... vs)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<T>(cont), Action(),
+        hpx::launch::async, std::forward<Ts>(vs)...));
+
+    p.set_source_id(hpx::find_here());
+    p.size() = size;
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// parcels of different sizes, the larger ones are sent as zero-copy chunks
+void test_mixed_sizes(hpx::id_type const& id)
+{
+    std::vector<hpx::future<double>> results;
+    results.reserve(numparcels_default);
+
+    std::vector<double> expected;
+    expected.reserve(numparcels_default);
+
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        std::vector<double> data((i % 7) * 512 + 1, static_cast<double>(i));
+        expected.push_back(sum(data));
+
+        hpx::distributed::promise<double> p;
+        results.push_back(p.get_future());
+
+        std::size_t const size = data.size() * sizeof(double);
+        parcels.push_back(generate_parcel<sum_action, double>(
+            id, p.get_id(), size, std::move(data)));
+    }
+
+    hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
+        std::move(parcels));
+
+    hpx::wait_all(results);
+
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), expected[i]);
+    }
+}
+
+// tracked pointers have to be restored correctly in all parcels
+void test_shared_arguments(hpx::id_type const& id)
+{
+    std::vector<hpx::future<bool>> results;
+    results.reserve(numparcels_default);
+
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        std::size_t const size = i + 1;
+        auto data = std::make_shared<std::vector<double>>(
+            size, static_cast<double>(size));
+
+        hpx::distributed::promise<bool> p;
+        results.push_back(p.get_future());
+
+        parcels.push_back(generate_parcel<shared_action, bool>(
+            id, p.get_id(), size * sizeof(double), data, data));
+    }
+
+    hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
+        std::move(parcels));
+
+    hpx::wait_all(results);
+
+    for (hpx::future<bool>& f : results)
+    {
+        HPX_TEST(f.get());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_mixed_sizes(id);
+        test_shared_arguments(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // explicitly disable message handlers (parcel coalescing)
+    std::vector<std::string> const cfg = {
+#if defined(HPX_HAVE_NETWORKING)
+        "hpx.parcel.message_handlers=0"
+#endif
+    };
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,172 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t vsize_default = 1024;
+constexpr std::size_t numparcels_default = 10;
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::id_type bulk(std::vector<double> const&)
+{
+    return hpx::find_here();
+}
+HPX_PLAIN_ACTION(bulk)
+
+hpx::id_type urgent()
+{
+    return hpx::find_here();
+}
+HPX_PLAIN_ACTION(urgent)
+HPX_ACTION_HAS_HIGH_PRIORITY(urgent_action)
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_parcel_lane_statistics(
+    hpx::parcelset::parcelport::parcel_lane_statistics_type t)
+{
+    auto& ph = hpx::get_runtime_distributed().get_parcel_handler();
+
+    std::int64_t result = 0;
+    ph.enum_parcelports([&](std::string const& type) -> bool {
+        result += ph.get_parcel_lane_statistics(type, t, false);
+        return true;
+    });
+    return result;
+}
+
+template <typename Action, typename... Ts>
+hpx::parcelset::parcel generate_parcel(hpx::id_type const& dest_id,
+    hpx::id_type const& cont, hpx::threads::thread_priority priority,
+    Ts&&... vs)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<hpx::id_type>(cont), Action(),
+        hpx::launch::async_policy(priority), std::forward<Ts>(vs)...));
+
+    p.set_source_id(hpx::find_here());
+    p.size() = 4096;
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// parcels of high priority actions are sent using the priority lane
+void test_async(hpx::id_type const& id)
+{
+    std::vector<double> data(vsize_default);
+
+    std::vector<hpx::future<hpx::id_type>> results;
+    results.reserve(2 * numparcels_default);
+
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        results.push_back(hpx::async<bulk_action>(id, data));
+        results.push_back(hpx::async<urgent_action>(id));
+    }
+
+    hpx::wait_all(results);
+
+    for (hpx::future<hpx::id_type>& f : results)
+    {
+        HPX_TEST_EQ(f.get(), id);
+    }
+}
+
+// a batch of parcels with mixed priorities is split between the lanes
+void test_mixed_priorities(hpx::id_type const& id)
+{
+    std::vector<double> data(vsize_default);
+
+    std::vector<hpx::future<hpx::id_type>> results;
+    results.reserve(2 * numparcels_default);
+
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != 2 * numparcels_default; ++i)
+    {
+        hpx::distributed::promise<hpx::id_type> p;
+        results.push_back(p.get_future());
+
+        if (i % 2)
+        {
+            parcels.push_back(generate_parcel<urgent_action>(
+                id, p.get_id(), hpx::threads::thread_priority::high));
+        }
+        else
+        {
+            parcels.push_back(generate_parcel<bulk_action>(
+                id, p.get_id(), hpx::threads::thread_priority::normal, data));
+        }
+    }
+
+    hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
+        std::move(parcels));
+
+    hpx::wait_all(results);
+
+    for (hpx::future<hpx::id_type>& f : results)
+    {
+        HPX_TEST_EQ(f.get(), id);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    using hpx::parcelset::parcelport;
+
+    std::vector<hpx::id_type> const localities = hpx::find_remote_localities();
+    for (hpx::id_type const& id : localities)
+    {
+        test_async(id);
+        test_mixed_priorities(id);
+    }
+
+    std::int64_t const priority_parcels =
+        get_parcel_lane_statistics(parcelport::priority_lane_parcels);
+    std::int64_t const priority_messages =
+        get_parcel_lane_statistics(parcelport::priority_lane_messages);
+    std::int64_t const normal_parcels =
+        get_parcel_lane_statistics(parcelport::normal_lane_parcels);
+
+    HPX_TEST_LTE(priority_messages, priority_parcels);
+
+    // parcelports sending parcels immediately don't use the lanes at all
+    if (priority_parcels + normal_parcels != 0)
+    {
+        if (hpx::get_config_entry("hpx.parcel.priority_lanes", "0") == "0")
+        {
+            HPX_TEST_EQ(priority_parcels, static_cast<std::int64_t>(0));
+        }
+        else
+        {
+            HPX_TEST_LTE(static_cast<std::int64_t>(
+                             2 * numparcels_default * localities.size()),
+                priority_parcels);
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,136 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset/receive_buffer_pool.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t allocations = 0;
+
+template <typename T>
+struct counting_allocator : std::allocator<T>
+{
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template <typename U>
+    counting_allocator(counting_allocator<U> const&) noexcept
+    {
+    }
+
+    template <typename U>
+    struct rebind
+    {
+        using other = counting_allocator<U>;
+    };
+
+    T* allocate(std::size_t n)
+    {
+        ++allocations;
+        return std::allocator<T>::allocate(n);
+    }
+};
+
+using buffer_type = std::vector<char, counting_allocator<char>>;
+using pool_type = hpx::parcelset::receive_buffer_pool<buffer_type>;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reuse()
+{
+    pool_type pool;
+
+    buffer_type buffer = pool.acquire(1000);
+    HPX_TEST_EQ(buffer.size(), static_cast<std::size_t>(1000));
+    HPX_TEST_EQ(buffer.capacity(), static_cast<std::size_t>(1024));
+
+    char const* data = buffer.data();
+    pool.release(buffer);
+    HPX_TEST(buffer.empty());
+
+    // all sizes of the same size class reuse the buffer
+    buffer = pool.acquire(600);
+    HPX_TEST_EQ(buffer.size(), static_cast<std::size_t>(600));
+    HPX_TEST_EQ(buffer.data(), data);
+    pool.release(buffer);
+
+    // a larger size class requires a new buffer
+    buffer = pool.acquire(2000);
+    HPX_TEST_NEQ(buffer.data(), data);
+    HPX_TEST_EQ(buffer.capacity(), static_cast<std::size_t>(2048));
+    pool.release(buffer);
+
+    // small buffers share the smallest size class
+    buffer_type small = pool.acquire(1);
+    HPX_TEST_EQ(small.capacity(),
+        static_cast<std::size_t>(1) << pool_type::min_size_class);
+
+    char const* small_data = small.data();
+    pool.release(small);
+
+    small = pool.acquire(100);
+    HPX_TEST_EQ(small.data(), small_data);
+    pool.release(small);
+}
+
+void test_limits()
+{
+    pool_type pool;
+
+    // huge buffers are not pooled
+    std::size_t const huge = static_cast<std::size_t>(1)
+        << pool_type::max_size_class;
+
+    buffer_type buffer = pool.acquire(huge);
+    HPX_TEST_EQ(buffer.size(), huge);
+    pool.release(buffer);
+    HPX_TEST(buffer.empty());
+
+    buffer = pool.acquire(huge);
+    HPX_TEST_EQ(buffer.size(), huge);
+    pool.release(buffer);
+
+    // at most max_buffers_per_class buffers are kept per size class
+    std::vector<buffer_type> buffers(2 * pool_type::max_buffers_per_class);
+    for (auto& b : buffers)
+    {
+        b = pool.acquire(4096);
+    }
+    for (auto& b : buffers)
+    {
+        pool.release(b);
+    }
+
+    allocations = 0;
+    for (auto& b : buffers)
+    {
+        b = pool.acquire(4096);
+    }
+    HPX_TEST_EQ(allocations,
+        buffers.size() - static_cast<std::size_t>(
+                             pool_type::max_buffers_per_class));
+}
+
+int main()
+{
+    test_reuse();
+    test_limits();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -63,6 +63,15 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::cout << "using seed: " << seed << std::endl;
     std::srand(seed);
 
+    // the TCP parcelport silently falls back to asio if the requested
+    // backend is not available, make sure the expected one is in use
+    if (vm.count("tcp-backend"))
+    {
+        HPX_TEST_EQ(
+            hpx::get_config_entry("hpx.parcel.tcp.active_backend", ""),
+            vm["tcp-backend"].as<std::string>());
+    }
+
     for (hpx::id_type const& id : hpx::find_remote_localities())
     {
         test_zero_copy_parcel(id);
@@ -81,6 +90,8 @@ int main(int argc, char* argv[])
     desc_commandline.add_options()
         ("seed,s", value<unsigned int>(),
          "the random number generator seed to use for this run")
+        ("tcp-backend", value<std::string>(),
+         "the backend the TCP parcelport is expected to use")
         ;
     // clang-format on
 
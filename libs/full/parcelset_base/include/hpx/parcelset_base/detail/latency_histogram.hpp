@@ -0,0 +1,255 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/modules/synchronization.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset {
+
+    /// The phases a parcel goes through while being sent to and handled on
+    /// the destination locality, the latency of each of those is tracked
+    /// separately.
+    enum class parcel_latency_phase : std::uint8_t
+    {
+        // from handing the parcel to the parcelport until its serialization
+        // starts
+        enqueue = 0,
+        // serialization of the parcel, or of the whole message
+        serialize = 1,
+        // sending the message, from async_write to the completion handler
+        send = 2,
+        // receiving the message until it is handed over for decoding
+        receive = 3,
+        // de-serialization of the parcel, or of the whole message
+        decode = 4,
+        // from the parcel being decoded until its action is scheduled
+        schedule = 5
+    };
+
+    inline constexpr std::size_t num_parcel_latency_phases = 6;
+
+    namespace detail {
+
+        /// Collect the distribution of latencies (nanoseconds). Similar to a
+        /// HDR histogram, the values are stored in buckets growing in powers
+        /// of two, each of which is divided into linear sub-buckets. This
+        /// bounds the relative error of the reported values by
+        /// 1 / sub_bucket_count.
+        template <typename Mutex>
+        class latency_histogram
+        {
+        public:
+            static constexpr std::size_t sub_bucket_bits = 4;
+            static constexpr std::size_t sub_bucket_count = std::size_t(1)
+                << sub_bucket_bits;
+
+            // values larger than 2^max_value_bits nanoseconds (about 18
+            // minutes) are accounted for in the last bucket
+            static constexpr std::size_t max_value_bits = 40;
+            static constexpr std::size_t bucket_count =
+                (max_value_bits - sub_bucket_bits + 1) * sub_bucket_count;
+
+            latency_histogram() = default;
+
+            inline void add_value(std::int64_t value);
+
+            // number of values collected since the current interval started
+            inline std::int64_t count();
+
+            // the largest value collected since the current interval started
+            inline std::int64_t max();
+
+            // the value below which the given percentage (0...100) of the
+            // collected values fall
+            //
+            // Queries which reset are served from a snapshot of the values
+            // of the last interval, thus all percentiles read during one
+            // interval are consistent. The snapshot is replaced by the values
+            // collected since (and a new interval is started) as soon as a
+            // percentage is queried a second time or if there is no snapshot
+            // yet. Queries which do not reset report all values collected
+            // since the last interval started.
+            inline std::int64_t percentile(double percentage, bool reset);
+
+            static constexpr std::size_t bucket_index(
+                std::uint64_t value) noexcept
+            {
+                if (value < sub_bucket_count)
+                {
+                    return static_cast<std::size_t>(value);
+                }
+
+                std::size_t msb = sub_bucket_bits;
+                while (msb != max_value_bits - 1 && (value >> (msb + 1)) != 0)
+                {
+                    ++msb;
+                }
+
+                if ((value >> (msb + 1)) != 0)
+                {
+                    return bucket_count - 1;
+                }
+
+                std::size_t const shift = msb - sub_bucket_bits;
+                return (shift + 1) * sub_bucket_count +
+                    static_cast<std::size_t>(
+                        (value >> shift) & (sub_bucket_count - 1));
+            }
+
+            // the largest value which is accounted for in the given bucket
+            static constexpr std::uint64_t highest_equivalent_value(
+                std::size_t index) noexcept
+            {
+                if (index < sub_bucket_count)
+                {
+                    return index;
+                }
+
+                std::size_t const shift = index / sub_bucket_count - 1;
+                std::uint64_t const sub = index % sub_bucket_count;
+                return ((sub_bucket_count + sub + 1) << shift) - 1;
+            }
+
+        private:
+            struct values
+            {
+                void clear() noexcept
+                {
+                    counts.fill(0);
+                    count = 0;
+                    max = 0;
+                }
+
+                std::array<std::int64_t, bucket_count> counts{};
+                std::int64_t count = 0;
+                std::int64_t max = 0;
+            };
+
+            // the value below which the given percentage of the values in
+            // both sets fall
+            static std::int64_t value_at(values const& first,
+                values const& second, double percentage) noexcept;
+
+            // values collected during the current interval
+            values current_;
+
+            // values collected during the last interval (allocated once a
+            // percentile is queried with reset) and the percentages which
+            // have been read from those
+            std::unique_ptr<values> snapshot_;
+            std::vector<double> snapshot_readers_;
+
+            Mutex mtx_;
+        };
+
+        template <typename Mutex>
+        void latency_histogram<Mutex>::add_value(std::int64_t value)
+        {
+            value = (std::max)(value, static_cast<std::int64_t>(0));
+            std::size_t const index =
+                bucket_index(static_cast<std::uint64_t>(value));
+
+            std::lock_guard l(mtx_);
+            ++current_.counts[index];
+            ++current_.count;
+            current_.max = (std::max)(current_.max, value);
+        }
+
+        template <typename Mutex>
+        std::int64_t latency_histogram<Mutex>::count()
+        {
+            std::lock_guard l(mtx_);
+            return snapshot_ ? snapshot_->count + current_.count :
+                               current_.count;
+        }
+
+        template <typename Mutex>
+        std::int64_t latency_histogram<Mutex>::max()
+        {
+            std::lock_guard l(mtx_);
+            return snapshot_ ? (std::max)(snapshot_->max, current_.max) :
+                               current_.max;
+        }
+
+        template <typename Mutex>
+        std::int64_t latency_histogram<Mutex>::percentile(
+            double percentage, bool reset)
+        {
+            static values const empty;
+
+            std::lock_guard l(mtx_);
+
+            if (!reset)
+            {
+                return value_at(
+                    current_, snapshot_ ? *snapshot_ : empty, percentage);
+            }
+
+            if (!snapshot_)
+            {
+                snapshot_ = std::make_unique<values>();
+                std::swap(*snapshot_, current_);
+            }
+            else if (std::find(snapshot_readers_.begin(),
+                         snapshot_readers_.end(),
+                         percentage) != snapshot_readers_.end())
+            {
+                // start a new interval
+                std::swap(*snapshot_, current_);
+                current_.clear();
+                snapshot_readers_.clear();
+            }
+            snapshot_readers_.push_back(percentage);
+
+            return value_at(*snapshot_, empty, percentage);
+        }
+
+        template <typename Mutex>
+        std::int64_t latency_histogram<Mutex>::value_at(values const& first,
+            values const& second, double percentage) noexcept
+        {
+            std::int64_t const count = first.count + second.count;
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            percentage = (std::min)((std::max)(percentage, 0.0), 100.0);
+
+            // the number of values which have to be accounted for
+            auto target = static_cast<std::int64_t>(
+                percentage / 100.0 * static_cast<double>(count) + 0.5);
+            target = (std::max)(target, static_cast<std::int64_t>(1));
+
+            std::int64_t const max = (std::max)(first.max, second.max);
+            std::int64_t seen = 0;
+            for (std::size_t i = 0; i != bucket_count; ++i)
+            {
+                seen += first.counts[i] + second.counts[i];
+                if (seen >= target)
+                {
+                    return (std::min)(max,
+                        static_cast<std::int64_t>(highest_equivalent_value(i)));
+                }
+            }
+            return max;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    using latency_histogram = detail::latency_histogram<hpx::spinlock>;
+    using latency_histogram_nolock = detail::latency_histogram<hpx::no_mutex>;
+}    // namespace hpx::parcelset
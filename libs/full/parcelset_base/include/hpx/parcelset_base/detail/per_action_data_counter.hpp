@@ -16,7 +16,9 @@
 
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/gatherer.hpp>
+#include <hpx/parcelset_base/detail/latency_histogram.hpp>
 
+#include <array>
 #include <cstdint>
 #include <string>
 #include <unordered_map>
@@ -50,6 +52,33 @@ namespace hpx::parcelset::detail {
         mutex_type mtx_;
         counter_data_map data_;
     };
+
+    // Per-action based parcel latency statistics
+    struct per_action_latency_counter
+    {
+        using mutex_type = hpx::spinlock;
+
+        // add collected latency (nanoseconds)
+        void add_value(char const* action,
+            parcelset::parcel_latency_phase phase, std::int64_t value);
+
+        // retrieve counter data
+
+        // the latency below which the given percentage of the parcels fall
+        // (nanoseconds)
+        std::int64_t percentile(std::string const& action,
+            parcelset::parcel_latency_phase phase, double percentage,
+            bool reset);
+
+    private:
+        using histograms_type = std::array<parcelset::latency_histogram_nolock,
+            parcelset::num_parcel_latency_phases>;
+        using counter_data_map = std::unordered_map<std::string,
+            histograms_type, hpx::util::jenkins_hash>;
+
+        mutex_type mtx_;
+        counter_data_map data_;
+    };
 }    // namespace hpx::parcelset::detail
 
 #endif
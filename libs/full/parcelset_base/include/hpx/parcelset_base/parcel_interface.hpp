@@ -72,6 +72,9 @@ namespace hpx::parcelset::detail {
         virtual void set_start_time(double time) = 0;
         virtual double creation_time() const = 0;
 
+        virtual std::uint64_t enqueue_time() const = 0;
+        virtual void set_enqueue_time(std::uint64_t time) = 0;
+
         virtual threads::thread_priority get_thread_priority() const = 0;
         virtual threads::thread_stacksize get_thread_stacksize() const = 0;
 
@@ -154,6 +157,11 @@ namespace hpx::parcelset {
         void set_start_time(double time) const;
         [[nodiscard]] double creation_time() const;
 
+        // the time the parcel was handed to the parcelport (nanoseconds),
+        // this is tracked only if parcelport counters are enabled
+        [[nodiscard]] std::uint64_t enqueue_time() const;
+        void set_enqueue_time(std::uint64_t time) const;
+
         [[nodiscard]] threads::thread_priority get_thread_priority() const;
         [[nodiscard]] threads::thread_stacksize get_thread_stacksize() const;
 
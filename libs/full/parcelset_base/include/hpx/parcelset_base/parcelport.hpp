@@ -21,11 +21,13 @@
 
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/gatherer.hpp>
+#include <hpx/parcelset_base/detail/latency_histogram.hpp>
 #include <hpx/parcelset_base/detail/per_action_data_counter.hpp>
 #include <hpx/parcelset_base/locality.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
 #include <hpx/parcelset_base/parcelset_base_fwd.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -82,6 +84,15 @@ namespace hpx::parcelset {
         // serialize an entity
         std::size_t get_zero_copy_serialization_threshold() const noexcept;
 
+        /// Return the minimal number of parcels an outgoing message has to
+        /// hold for it to be encoded using several threads (0 if disabled)
+        std::size_t get_parallel_encoding_threshold() const noexcept;
+
+        /// Return the maximal (estimated) number of bytes of parcels sent in
+        /// one message if further parcels to the same destination are pending
+        /// (0 if disabled)
+        std::size_t get_stripe_size() const noexcept;
+
         /// Start the parcelport I/O thread pool.
         ///
         /// \param blocking [in] If blocking is set to \a true the routine will
@@ -171,7 +182,11 @@ namespace hpx::parcelset {
             connection_cache_evictions = 1,
             connection_cache_hits = 2,
             connection_cache_misses = 3,
-            connection_cache_reclaims = 4
+            connection_cache_reclaims = 4,
+            connection_cache_outstanding_bytes = 5,
+            connection_cache_busy_connections = 6,
+            connection_striped_messages = 7,
+            connection_striped_fragments = 8
         };
 
         // invoke pending background work
@@ -182,6 +197,56 @@ namespace hpx::parcelset {
         virtual std::int64_t get_connection_cache_statistics(
             connection_cache_statistics_type, bool reset) = 0;
 
+        /// Return the given statistic for each of the sending connections
+        enum connection_statistics_type
+        {
+            connection_bytes_sent = 0,
+            connection_messages_sent = 1,
+            connection_outstanding_bytes = 2
+        };
+
+        // retrieve performance counter values (one per connection) for given
+        // statistics type
+        virtual std::vector<std::int64_t> get_connection_statistics(
+            connection_statistics_type, bool reset) = 0;
+
+        /// Return the given receive buffer pool statistic
+        enum receive_buffer_pool_statistics_type
+        {
+            receive_buffer_pool_hits = 0,
+            receive_buffer_pool_misses = 1,
+            receive_buffer_pool_bytes_recycled = 2
+        };
+
+        // retrieve performance counter value for given statistics type
+        std::int64_t get_receive_buffer_pool_statistics(
+            receive_buffer_pool_statistics_type, bool reset);
+
+        // accumulate the statistics of a receive buffer pool
+        void add_receive_buffer_pool_statistics(std::int64_t hits,
+            std::int64_t misses, std::int64_t bytes_recycled) noexcept;
+
+        /// Return the given parcel lane statistic
+        enum parcel_lane_statistics_type
+        {
+            normal_lane_parcels = 0,
+            normal_lane_messages = 1,
+            priority_lane_parcels = 2,
+            priority_lane_messages = 3
+        };
+
+        // retrieve performance counter value for given statistics type
+        std::int64_t get_parcel_lane_statistics(
+            parcel_lane_statistics_type, bool reset);
+
+        // account for a message holding the given number of parcels which was
+        // sent using the normal or the priority lane
+        void add_parcel_lane_statistics(
+            bool priority, std::int64_t parcels) noexcept;
+
+        /// Return whether high priority parcels are sent using a separate lane
+        bool priority_lanes() const noexcept;
+
         /// Return the name of this locality
         virtual std::string get_locality_name() const = 0;
 
@@ -258,6 +323,11 @@ namespace hpx::parcelset {
 
         //// the maximum size of zero-copy chunks per message received
         std::int64_t get_zchunks_recv_size_max(bool reset);
+
+        /// the latency of the given phase below which the given percentage
+        /// of all parcels or messages fall (nanoseconds)
+        std::int64_t get_parcel_latency(
+            parcel_latency_phase phase, double percentage, bool reset);
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -285,6 +355,11 @@ namespace hpx::parcelset {
 
         // total data received (bytes)
         std::int64_t get_action_data_received(std::string const&, bool reset);
+
+        // the latency of the given phase below which the given percentage of
+        // the parcels fall (nanoseconds)
+        std::int64_t get_action_parcel_latency(parcel_latency_phase phase,
+            double percentage, std::string const&, bool reset);
 #endif
         std::int64_t get_pending_parcels_count(bool /*reset*/);
 
@@ -294,6 +369,9 @@ namespace hpx::parcelset {
         void add_received_data(parcelset::data_point const& data);
 
         void add_sent_data(parcelset::data_point const& data);
+
+        void add_parcel_latency(
+            parcel_latency_phase phase, std::int64_t latency);
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -302,6 +380,9 @@ namespace hpx::parcelset {
 
         void add_sent_data(
             char const* action, parcelset::data_point const& data);
+
+        void add_parcel_latency(char const* action,
+            parcel_latency_phase phase, std::int64_t latency);
 #endif
 
         /// Return the configured maximal allowed inbound message data
@@ -342,9 +423,24 @@ namespace hpx::parcelset {
         using pending_parcels_map = std::map<locality, map_second_type>;
         pending_parcels_map pending_parcels_;
 
+        // The cache for pending high priority parcels, those are sent ahead
+        // of the parcels in pending_parcels_ using separate connections
+        pending_parcels_map pending_priority_parcels_;
+
         // The local locality
         locality here_;
 
+        // statistics of the receive buffer pools of all connections
+        std::atomic<std::int64_t> receive_buffer_pool_hits_;
+        std::atomic<std::int64_t> receive_buffer_pool_misses_;
+        std::atomic<std::int64_t> receive_buffer_pool_bytes_recycled_;
+
+        // statistics of the parcels sent using the normal and priority lanes
+        std::atomic<std::int64_t> normal_lane_parcels_;
+        std::atomic<std::int64_t> normal_lane_messages_;
+        std::atomic<std::int64_t> priority_lane_parcels_;
+        std::atomic<std::int64_t> priority_lane_messages_;
+
         // The maximally allowed message size
         std::int64_t const max_inbound_message_size_;
         std::int64_t const max_outbound_message_size_;
@@ -353,12 +449,17 @@ namespace hpx::parcelset {
         // Overall parcel statistics
         parcelset::gatherer parcels_sent_;
         parcelset::gatherer parcels_received_;
+
+        // Latencies of the phases parcels go through
+        std::array<parcelset::latency_histogram, num_parcel_latency_phases>
+            parcel_latencies_;
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         // Per-action based parcel statistics
         detail::per_action_data_counter action_parcels_sent_;
         detail::per_action_data_counter action_parcels_received_;
+        detail::per_action_latency_counter action_parcel_latencies_;
 #endif
 
         /// serialization is allowed to use array optimization
@@ -369,11 +470,16 @@ namespace hpx::parcelset {
         /// async serialization of parcels
         bool async_serialization_;
 
+        /// high priority parcels are sent using a separate lane
+        bool priority_lanes_;
+
         /// priority of the parcelport
         int priority_;
         std::string type_;
 
         std::size_t zero_copy_serialization_threshold_;
+        std::size_t parallel_encoding_threshold_;
+        std::size_t stripe_size_;
     };
 }    // namespace hpx::parcelset
 
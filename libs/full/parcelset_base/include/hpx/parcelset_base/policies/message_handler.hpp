@@ -13,11 +13,16 @@
 
 #include <hpx/parcelset_base/parcelset_base_fwd.hpp>
 
+#include <memory>
+
 #include <system_error>
 
 namespace hpx::parcelset::policies {
 
+    // Message handlers are owned by the parcel handler through a shared_ptr,
+    // asynchronous operations may keep a handler alive.
     struct message_handler
+      : std::enable_shared_from_this<message_handler>
     {
         enum flush_mode
         {
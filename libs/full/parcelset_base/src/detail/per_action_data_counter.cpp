@@ -11,6 +11,7 @@
     defined(HPX_HAVE_NETWORKING)
 #include <hpx/parcelset_base/detail/per_action_data_counter.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <mutex>
 #include <string>
@@ -50,6 +51,27 @@ namespace hpx::parcelset::detail {
         std::lock_guard l(mtx_);
         return data_[action].total_bytes(reset);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // add collected latency (nanoseconds)
+    void per_action_latency_counter::add_value(char const* action,
+        parcelset::parcel_latency_phase phase, std::int64_t value)
+    {
+        std::lock_guard l(mtx_);
+        data_[std::string(action)][static_cast<std::size_t>(phase)].add_value(
+            value);
+    }
+
+    // the latency below which the given percentage of the parcels fall
+    // (nanoseconds)
+    std::int64_t per_action_latency_counter::percentile(
+        std::string const& action, parcelset::parcel_latency_phase phase,
+        double percentage, bool reset)
+    {
+        std::lock_guard l(mtx_);
+        return data_[action][static_cast<std::size_t>(phase)].percentile(
+            percentage, reset);
+    }
 }    // namespace hpx::parcelset::detail
 
 #endif
@@ -126,6 +126,16 @@ namespace hpx::parcelset {
         return data_->creation_time();
     }
 
+    std::uint64_t parcel::enqueue_time() const
+    {
+        return data_->enqueue_time();
+    }
+
+    void parcel::set_enqueue_time(std::uint64_t time) const
+    {
+        data_->set_enqueue_time(time);
+    }
+
     threads::thread_priority parcel::get_thread_priority() const
     {
         return data_->get_thread_priority();
@@ -37,6 +37,13 @@ namespace hpx::parcelset {
         std::size_t zero_copy_serialization_threshold)
       : num_parcel_destinations_(0)
       , here_(HPX_MOVE(here))
+      , receive_buffer_pool_hits_(0)
+      , receive_buffer_pool_misses_(0)
+      , receive_buffer_pool_bytes_recycled_(0)
+      , normal_lane_parcels_(0)
+      , normal_lane_messages_(0)
+      , priority_lane_parcels_(0)
+      , priority_lane_messages_(0)
       , max_inbound_message_size_(
             static_cast<std::int64_t>(ini.get_max_inbound_message_size()))
       , max_outbound_message_size_(
@@ -45,10 +52,15 @@ namespace hpx::parcelset {
       , allow_zero_copy_optimizations_(true)
       , allow_zero_copy_receive_optimizations_(true)
       , async_serialization_(false)
+      , priority_lanes_(false)
       , priority_(hpx::util::get_entry_as<int>(
             ini, "hpx.parcel." + type + ".priority", 0))
       , type_(type)
       , zero_copy_serialization_threshold_(zero_copy_serialization_threshold)
+      , parallel_encoding_threshold_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel." + type + ".parallel_encoding_threshold", 0))
+      , stripe_size_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel." + type + ".stripe_size", 0))
     {
         std::string key("hpx.parcel.");
         key += type;
@@ -77,6 +89,11 @@ namespace hpx::parcelset {
         {
             async_serialization_ = true;
         }
+
+        if (hpx::util::get_entry_as<int>(ini, key + ".priority_lanes", 0) != 0)
+        {
+            priority_lanes_ = true;
+        }
     }
 
     int parcelport::priority() const noexcept
@@ -95,6 +112,16 @@ namespace hpx::parcelset {
         return zero_copy_serialization_threshold_;
     }
 
+    std::size_t parcelport::get_parallel_encoding_threshold() const noexcept
+    {
+        return parallel_encoding_threshold_;
+    }
+
+    std::size_t parcelport::get_stripe_size() const noexcept
+    {
+        return stripe_size_;
+    }
+
     locality const& parcelport::here() const noexcept
     {
         return here_;
@@ -114,11 +141,25 @@ namespace hpx::parcelset {
     void parcelport::add_received_data(parcelset::data_point const& data)
     {
         parcels_received_.add_data(data);
+
+        add_parcel_latency(parcel_latency_phase::receive, data.time_);
+        add_parcel_latency(
+            parcel_latency_phase::decode, data.serialization_time_);
     }
 
     void parcelport::add_sent_data(parcelset::data_point const& data)
     {
         parcels_sent_.add_data(data);
+
+        add_parcel_latency(
+            parcel_latency_phase::serialize, data.serialization_time_);
+        add_parcel_latency(parcel_latency_phase::send, data.time_);
+    }
+
+    void parcelport::add_parcel_latency(
+        parcel_latency_phase phase, std::int64_t latency)
+    {
+        parcel_latencies_[static_cast<std::size_t>(phase)].add_value(latency);
     }
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
@@ -127,12 +168,22 @@ namespace hpx::parcelset {
         char const* action, parcelset::data_point const& data)
     {
         action_parcels_received_.add_data(action, data);
+        action_parcel_latencies_.add_value(
+            action, parcel_latency_phase::decode, data.serialization_time_);
     }
 
     void parcelport::add_sent_data(
         char const* action, parcelset::data_point const& data)
     {
         action_parcels_sent_.add_data(action, data);
+        action_parcel_latencies_.add_value(
+            action, parcel_latency_phase::serialize, data.serialization_time_);
+    }
+
+    void parcelport::add_parcel_latency(
+        char const* action, parcel_latency_phase phase, std::int64_t latency)
+    {
+        action_parcel_latencies_.add_value(action, phase, latency);
     }
 #endif
 
@@ -271,6 +322,15 @@ namespace hpx::parcelset {
     {
         return parcels_received_.size_zchunks_max(reset);
     }
+
+    // the latency of the given phase below which the given percentage of all
+    // parcels or messages fall (nanoseconds)
+    std::int64_t parcelport::get_parcel_latency(
+        parcel_latency_phase phase, double percentage, bool reset)
+    {
+        return parcel_latencies_[static_cast<std::size_t>(phase)].percentile(
+            percentage, reset);
+    }
 #endif
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
@@ -331,7 +391,101 @@ namespace hpx::parcelset {
             return parcels_received_.total_bytes(reset);
         return action_parcels_received_.total_bytes(action, reset);
     }
+
+    // the latency of the given phase below which the given percentage of the
+    // parcels fall (nanoseconds)
+    std::int64_t parcelport::get_action_parcel_latency(
+        parcel_latency_phase phase, double percentage,
+        std::string const& action, bool reset)
+    {
+        if (action.empty())
+            return get_parcel_latency(phase, percentage, reset);
+        return action_parcel_latencies_.percentile(
+            action, phase, percentage, reset);
+    }
 #endif
+    std::int64_t parcelport::get_receive_buffer_pool_statistics(
+        receive_buffer_pool_statistics_type t, bool reset)
+    {
+        switch (t)
+        {
+        case receive_buffer_pool_hits:
+            return util::get_and_reset_value(receive_buffer_pool_hits_, reset);
+
+        case receive_buffer_pool_misses:
+            return util::get_and_reset_value(
+                receive_buffer_pool_misses_, reset);
+
+        case receive_buffer_pool_bytes_recycled:
+            return util::get_and_reset_value(
+                receive_buffer_pool_bytes_recycled_, reset);
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+            "parcelport::get_receive_buffer_pool_statistics",
+            "invalid receive buffer pool statistics type");
+    }
+
+    void parcelport::add_receive_buffer_pool_statistics(std::int64_t hits,
+        std::int64_t misses, std::int64_t bytes_recycled) noexcept
+    {
+        receive_buffer_pool_hits_.fetch_add(hits, std::memory_order_relaxed);
+        receive_buffer_pool_misses_.fetch_add(
+            misses, std::memory_order_relaxed);
+        receive_buffer_pool_bytes_recycled_.fetch_add(
+            bytes_recycled, std::memory_order_relaxed);
+    }
+
+    std::int64_t parcelport::get_parcel_lane_statistics(
+        parcel_lane_statistics_type t, bool reset)
+    {
+        switch (t)
+        {
+        case normal_lane_parcels:
+            return util::get_and_reset_value(normal_lane_parcels_, reset);
+
+        case normal_lane_messages:
+            return util::get_and_reset_value(normal_lane_messages_, reset);
+
+        case priority_lane_parcels:
+            return util::get_and_reset_value(priority_lane_parcels_, reset);
+
+        case priority_lane_messages:
+            return util::get_and_reset_value(priority_lane_messages_, reset);
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+            "parcelport::get_parcel_lane_statistics",
+            "invalid parcel lane statistics type");
+    }
+
+    void parcelport::add_parcel_lane_statistics(
+        bool priority, std::int64_t parcels) noexcept
+    {
+        if (priority)
+        {
+            priority_lane_parcels_.fetch_add(
+                parcels, std::memory_order_relaxed);
+            priority_lane_messages_.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            normal_lane_parcels_.fetch_add(parcels, std::memory_order_relaxed);
+            normal_lane_messages_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    bool parcelport::priority_lanes() const noexcept
+    {
+        return priority_lanes_;
+    }
+
     std::int64_t parcelport::get_pending_parcels_count(bool /*reset*/)
     {
         std::lock_guard<hpx::spinlock> l(mtx_);
@@ -342,6 +496,12 @@ namespace hpx::parcelset {
             HPX_ASSERT(
                 hpx::get<0>(p.second).size() == hpx::get<1>(p.second).size());
         }
+        for (auto&& p : pending_priority_parcels_)
+        {
+            count += hpx::get<0>(p.second).size();
+            HPX_ASSERT(
+                hpx::get<0>(p.second).size() == hpx::get<1>(p.second).size());
+        }
         return count;
     }
 
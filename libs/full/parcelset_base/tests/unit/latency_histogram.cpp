@@ -0,0 +1,135 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset_base/detail/latency_histogram.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+using histogram_type = hpx::parcelset::latency_histogram_nolock;
+
+///////////////////////////////////////////////////////////////////////////////
+// each value is accounted for in a bucket covering it, the buckets are
+// contiguous
+void test_buckets()
+{
+    for (std::size_t i = 0; i != histogram_type::bucket_count - 1; ++i)
+    {
+        std::uint64_t const value =
+            histogram_type::highest_equivalent_value(i);
+
+        HPX_TEST_EQ(histogram_type::bucket_index(value), i);
+        HPX_TEST_EQ(histogram_type::bucket_index(value + 1), i + 1);
+    }
+
+    // small values are exact
+    for (std::uint64_t value = 0; value != 2 * histogram_type::sub_bucket_count;
+         ++value)
+    {
+        HPX_TEST_EQ(histogram_type::highest_equivalent_value(
+                        histogram_type::bucket_index(value)),
+            value);
+    }
+
+    // the relative error is bounded by the number of sub-buckets
+    for (std::uint64_t value = 1; value < (std::uint64_t(1) << 39);
+         value = value * 3 + 1)
+    {
+        std::uint64_t const reported = histogram_type::highest_equivalent_value(
+            histogram_type::bucket_index(value));
+
+        HPX_TEST_LTE(value, reported);
+        HPX_TEST_LTE(reported - value,
+            value / histogram_type::sub_bucket_count + 1);
+    }
+
+    // values out of range end up in the last bucket
+    HPX_TEST_EQ(histogram_type::bucket_index(std::uint64_t(1) << 50),
+        histogram_type::bucket_count - 1);
+    HPX_TEST_EQ(histogram_type::bucket_index(~std::uint64_t(0)),
+        histogram_type::bucket_count - 1);
+}
+
+void test_percentiles()
+{
+    histogram_type histogram;
+    HPX_TEST_EQ(histogram.percentile(99.0, false), std::int64_t(0));
+
+    // 1000 values from 1us to 1ms
+    for (std::int64_t i = 1; i <= 1000; ++i)
+    {
+        histogram.add_value(i * 1000);
+    }
+    HPX_TEST_EQ(histogram.count(), std::int64_t(1000));
+    HPX_TEST_EQ(histogram.max(), std::int64_t(1000000));
+
+    std::int64_t const p50 = histogram.percentile(50.0, false);
+    HPX_TEST_LTE(std::int64_t(500000), p50);
+    HPX_TEST_LTE(p50, std::int64_t(500000 + 500000 / 16));
+
+    std::int64_t const p99 = histogram.percentile(99.0, false);
+    HPX_TEST_LTE(std::int64_t(990000), p99);
+    HPX_TEST_LTE(p99, std::int64_t(1000000));
+
+    HPX_TEST_EQ(histogram.percentile(100.0, false), std::int64_t(1000000));
+
+    std::int64_t const p0 = histogram.percentile(0.0, false);
+    HPX_TEST_LTE(std::int64_t(1000), p0);
+    HPX_TEST_LTE(p0, std::int64_t(1000 + 1000 / 16));
+
+    // a single outlier shows up in the tail only
+    histogram.add_value(std::int64_t(1) << 30);
+    HPX_TEST_LTE(histogram.percentile(99.0, false),
+        std::int64_t(1000000 + 1000000 / 16));
+    HPX_TEST_EQ(histogram.percentile(100.0, false), std::int64_t(1) << 30);
+
+    // negative values are treated as zero
+    histogram_type negative;
+    negative.add_value(-10);
+    HPX_TEST_EQ(negative.count(), std::int64_t(1));
+    HPX_TEST_EQ(negative.percentile(50.0, false), std::int64_t(0));
+}
+
+void test_reset()
+{
+    histogram_type histogram;
+    // small values are exact
+    for (std::int64_t i = 1; i <= 20; ++i)
+    {
+        histogram.add_value(i);
+    }
+
+    // all percentiles read with reset during one interval see the same values
+    HPX_TEST_EQ(histogram.percentile(50.0, true), std::int64_t(10));
+    histogram.add_value(1000);
+    HPX_TEST_EQ(histogram.percentile(100.0, true), std::int64_t(20));
+    HPX_TEST_EQ(histogram.percentile(90.0, true), std::int64_t(18));
+
+    // queries without reset see the values of the current interval as well
+    HPX_TEST_EQ(histogram.count(), std::int64_t(21));
+    HPX_TEST_EQ(histogram.percentile(100.0, false), std::int64_t(1000));
+    HPX_TEST_EQ(histogram.percentile(50.0, false), std::int64_t(11));
+
+    // reading a percentile again starts the next interval
+    HPX_TEST_EQ(histogram.percentile(50.0, true), std::int64_t(1000));
+    HPX_TEST_EQ(histogram.count(), std::int64_t(1));
+    HPX_TEST_EQ(histogram.percentile(100.0, true), std::int64_t(1000));
+
+    // intervals without values report zero
+    HPX_TEST_EQ(histogram.percentile(50.0, true), std::int64_t(0));
+    HPX_TEST_EQ(histogram.percentile(100.0, true), std::int64_t(0));
+    HPX_TEST_EQ(histogram.count(), std::int64_t(0));
+}
+
+int main()
+{
+    test_buckets();
+    test_percentiles();
+    test_reset();
+
+    return hpx::util::report_errors();
+}
@@ -65,6 +65,15 @@ namespace hpx { namespace performance_counters {
                 &agas::addressing_service::get_cache_erase_entry_time,
                 &client));
 
+        hpx::function<std::int64_t(bool)> refcnt_requests_received(
+            hpx::bind_front(
+                &agas::addressing_service::get_refcnt_requests_received,
+                &client));
+        hpx::function<std::int64_t(bool)> refcnt_ranges_sent(hpx::bind_front(
+            &agas::addressing_service::get_refcnt_ranges_sent, &client));
+        hpx::function<std::int64_t(bool)> refcnt_parcels_sent(hpx::bind_front(
+            &agas::addressing_service::get_refcnt_parcels_sent, &client));
+
         using placeholders::_1;
         using placeholders::_2;
         performance_counters::generic_counter_type_data const counter_types[] =
@@ -196,6 +205,36 @@ namespace hpx { namespace performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         cache_erase_entry_time, _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/refcnt/requests",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of reference count decrements "
+                    "buffered by the AGAS client",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        refcnt_requests_received, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/refcnt/ranges",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of GID ranges the buffered reference "
+                    "count decrements were coalesced into",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        refcnt_ranges_sent, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/refcnt/parcels",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of bulk reference count decrement "
+                    "requests sent by the AGAS client",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        refcnt_parcels_sent, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
             };
 
         performance_counters::install_counter_types(
@@ -17,6 +17,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace hpx::performance_counters {
 
@@ -518,6 +519,30 @@ namespace hpx::performance_counters {
         hpx::function<std::int64_t(bool)> cache_reclaims(
             hpx::bind_front(&parcelhandler::get_connection_cache_statistics,
                 &ph, pp_type, parcelport::connection_cache_reclaims));
+        hpx::function<std::int64_t(bool)> outstanding_bytes(
+            hpx::bind_front(&parcelhandler::get_connection_cache_statistics,
+                &ph, pp_type, parcelport::connection_cache_outstanding_bytes));
+        hpx::function<std::int64_t(bool)> busy_connections(
+            hpx::bind_front(&parcelhandler::get_connection_cache_statistics,
+                &ph, pp_type, parcelport::connection_cache_busy_connections));
+        hpx::function<std::int64_t(bool)> striped_messages(
+            hpx::bind_front(&parcelhandler::get_connection_cache_statistics,
+                &ph, pp_type, parcelport::connection_striped_messages));
+        hpx::function<std::int64_t(bool)> striped_fragments(
+            hpx::bind_front(&parcelhandler::get_connection_cache_statistics,
+                &ph, pp_type, parcelport::connection_striped_fragments));
+
+        hpx::function<std::vector<std::int64_t>(bool)> connection_bytes_sent(
+            hpx::bind_front(&parcelhandler::get_connection_statistics, &ph,
+                pp_type, parcelport::connection_bytes_sent));
+        hpx::function<std::vector<std::int64_t>(bool)>
+            connection_messages_sent(
+                hpx::bind_front(&parcelhandler::get_connection_statistics, &ph,
+                    pp_type, parcelport::connection_messages_sent));
+        hpx::function<std::vector<std::int64_t>(bool)>
+            connection_outstanding_bytes(
+                hpx::bind_front(&parcelhandler::get_connection_statistics, &ph,
+                    pp_type, parcelport::connection_outstanding_bytes));
 
         performance_counters::generic_counter_type_data const
             connection_cache_types[] = {
@@ -584,12 +609,375 @@ namespace hpx::performance_counters {
                     hpx::bind(
                         &performance_counters::locality_raw_counter_creator, _1,
                         HPX_MOVE(cache_reclaims), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/outstanding-bytes", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of bytes currently in flight "
+                        "over all connections of the {} connection type on "
+                        "the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(outstanding_bytes), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/busy-connections", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of connections of the {} "
+                        "connection type currently used for sending messages "
+                        "on the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(busy_connections), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/striped-messages", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of messages of the {} connection "
+                        "type holding only part of the parcels pending for "
+                        "their destination (see hpx.parcel.stripe_size) on the "
+                        "referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(striped_messages), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/striped-fragments", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of fragments of large zero-copy "
+                        "data sent over other connections of the {} "
+                        "connection type than the message they belong to (see "
+                        "hpx.parcel.stripe_size) on the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(striped_fragments), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/connection-bytes-sent", pp_type),
+                    performance_counters::counter_type::raw_values,
+                    hpx::util::format(
+                        "returns the number of bytes sent over each of the "
+                        "connections of the {} connection type on the "
+                        "referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&performance_counters::
+                                  locality_raw_values_counter_creator,
+                        _1, HPX_MOVE(connection_bytes_sent), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/connection-messages-sent", pp_type),
+                    performance_counters::counter_type::raw_values,
+                    hpx::util::format(
+                        "returns the number of messages sent over each of the "
+                        "connections of the {} connection type on the "
+                        "referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&performance_counters::
+                                  locality_raw_values_counter_creator,
+                        _1, HPX_MOVE(connection_messages_sent), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/connection-outstanding-bytes",
+                     pp_type),
+                    performance_counters::counter_type::raw_values,
+                    hpx::util::format(
+                        "returns the number of bytes in flight over each of "
+                        "the connections of the {} connection type on the "
+                        "referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&performance_counters::
+                                  locality_raw_values_counter_creator,
+                        _1, HPX_MOVE(connection_outstanding_bytes), _2),
                     &performance_counters::locality_counter_discoverer, ""}};
 
         performance_counters::install_counter_types(
             connection_cache_types, std::size(connection_cache_types));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // register connection specific performance counters related to the pools
+    // of receive buffers
+    void register_receive_buffer_pool_counter_types(
+        parcelset::parcelhandler& ph, std::string const& pp_type)
+    {
+        if (!ph.is_networking_enabled())
+        {
+            return;
+        }
+
+        using hpx::placeholders::_1;
+        using hpx::placeholders::_2;
+
+        using parcelset::parcelhandler;
+        using parcelset::parcelport;
+
+        hpx::function<std::int64_t(bool)> pool_hits(
+            hpx::bind_front(&parcelhandler::get_receive_buffer_pool_statistics,
+                &ph, pp_type, parcelport::receive_buffer_pool_hits));
+        hpx::function<std::int64_t(bool)> pool_misses(
+            hpx::bind_front(&parcelhandler::get_receive_buffer_pool_statistics,
+                &ph, pp_type, parcelport::receive_buffer_pool_misses));
+        hpx::function<std::int64_t(bool)> pool_bytes_recycled(
+            hpx::bind_front(&parcelhandler::get_receive_buffer_pool_statistics,
+                &ph, pp_type, parcelport::receive_buffer_pool_bytes_recycled));
+
+        performance_counters::generic_counter_type_data const
+            receive_buffer_pool_types[] = {
+                {hpx::util::format(
+                     "/parcelport/count/{}/receive-pool-hits", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of receive buffers which were "
+                        "taken from the receive buffer pools for the {} "
+                        "connection type on the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(pool_hits), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/receive-pool-misses", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of receive buffers which had to "
+                        "be allocated as the receive buffer pools for the {} "
+                        "connection type on the referenced locality had no "
+                        "suitable buffer",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(pool_misses), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/receive-pool-recycled", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of bytes received into recycled "
+                        "buffers taken from the receive buffer pools for the "
+                        "{} connection type on the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(pool_bytes_recycled), _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "bytes"}};
+
+        performance_counters::install_counter_types(
+            receive_buffer_pool_types, std::size(receive_buffer_pool_types));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // register connection specific performance counters related to the
+    // normal and the priority lanes used for sending parcels
+    void register_parcel_lane_counter_types(
+        parcelset::parcelhandler& ph, std::string const& pp_type)
+    {
+        if (!ph.is_networking_enabled())
+        {
+            return;
+        }
+
+        using hpx::placeholders::_1;
+        using hpx::placeholders::_2;
+
+        using parcelset::parcelhandler;
+        using parcelset::parcelport;
+
+        hpx::function<std::int64_t(bool)> normal_lane_parcels(
+            hpx::bind_front(&parcelhandler::get_parcel_lane_statistics, &ph,
+                pp_type, parcelport::normal_lane_parcels));
+        hpx::function<std::int64_t(bool)> normal_lane_messages(
+            hpx::bind_front(&parcelhandler::get_parcel_lane_statistics, &ph,
+                pp_type, parcelport::normal_lane_messages));
+        hpx::function<std::int64_t(bool)> priority_lane_parcels(
+            hpx::bind_front(&parcelhandler::get_parcel_lane_statistics, &ph,
+                pp_type, parcelport::priority_lane_parcels));
+        hpx::function<std::int64_t(bool)> priority_lane_messages(
+            hpx::bind_front(&parcelhandler::get_parcel_lane_statistics, &ph,
+                pp_type, parcelport::priority_lane_messages));
+
+        performance_counters::generic_counter_type_data const
+            parcel_lane_types[] = {
+                {hpx::util::format(
+                     "/parcelport/count/{}/normal-lane/parcels", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of parcels sent using the normal "
+                        "lane of the {} connection type on the referenced "
+                        "locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(normal_lane_parcels), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/normal-lane/messages", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of messages sent using the normal "
+                        "lane of the {} connection type on the referenced "
+                        "locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(normal_lane_messages), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/priority-lane/parcels", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of high priority parcels sent "
+                        "using the priority lane of the {} connection type on "
+                        "the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(priority_lane_parcels), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/priority-lane/messages", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of messages sent using the "
+                        "priority lane of the {} connection type on the "
+                        "referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(priority_lane_messages), _2),
+                    &performance_counters::locality_counter_discoverer, ""}};
+
+        performance_counters::install_counter_types(
+            parcel_lane_types, std::size(parcel_lane_types));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // register connection specific performance counters exposing percentiles
+    // of the latencies of the phases parcels go through
+    void register_parcel_latency_counter_types(
+        [[maybe_unused]] parcelset::parcelhandler& ph,
+        [[maybe_unused]] std::string const& pp_type)
+    {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        if (!ph.is_networking_enabled())
+        {
+            return;
+        }
+
+        using hpx::placeholders::_1;
+        using hpx::placeholders::_2;
+
+        using parcelset::parcel_latency_phase;
+        using parcelset::parcelhandler;
+
+        struct phase_data
+        {
+            parcel_latency_phase phase;
+            char const* name;
+            char const* description;
+        };
+
+        phase_data const phases[] = {
+            {parcel_latency_phase::enqueue, "enqueue",
+                "the time parcels wait from being handed to the parcelport "
+                "until their serialization starts"},
+            {parcel_latency_phase::serialize, "serialize",
+                "the time required to serialize a message"},
+            {parcel_latency_phase::send, "send",
+                "the time between the start of the asynchronous write of a "
+                "message and the invocation of the write callback"},
+            {parcel_latency_phase::receive, "receive",
+                "the time required to receive a message until it is handed "
+                "over for de-serialization"},
+            {parcel_latency_phase::decode, "decode",
+                "the time required to de-serialize a message"},
+            {parcel_latency_phase::schedule, "schedule",
+                "the time parcels wait from being de-serialized until their "
+                "action is scheduled"}};
+
+        struct percentile_data
+        {
+            char const* name;
+            char const* description;
+            double percentage;
+        };
+
+        percentile_data const percentiles[] = {{"p50", "median", 50.0},
+            {"p90", "90th percentile", 90.0}, {"p99", "99th percentile", 99.0},
+            {"p999", "99.9th percentile", 99.9}, {"max", "maximum", 100.0}};
+
+        std::vector<performance_counters::generic_counter_type_data>
+            parcel_latency_types;
+        parcel_latency_types.reserve(
+            std::size(phases) * std::size(percentiles));
+
+        for (phase_data const& ph_data : phases)
+        {
+            for (percentile_data const& pct : percentiles)
+            {
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+                hpx::function<std::int64_t(std::string const&, bool)> latency(
+                    hpx::bind_front(&parcelhandler::get_action_parcel_latency,
+                        &ph, pp_type, ph_data.phase, pct.percentage));
+#else
+                hpx::function<std::int64_t(bool)> latency(
+                    hpx::bind_front(&parcelhandler::get_parcel_latency, &ph,
+                        pp_type, ph_data.phase, pct.percentage));
+#endif
+                std::string name = hpx::util::format(
+                    "/parcels/time/{}/{}/{}", pp_type, ph_data.name, pct.name);
+                std::string helptext = hpx::util::format(
+                    "returns the {} of {} using the {} connection type for the "
+                    "referenced locality (all percentiles of this phase "
+                    "which are reset report the same interval)",
+                    pct.description, ph_data.description, pp_type);
+
+                parcel_latency_types.push_back({HPX_MOVE(name),
+                    performance_counters::counter_type::raw,
+                    HPX_MOVE(helptext),
+                    HPX_PERFORMANCE_COUNTER_V1,
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+                    hpx::bind(
+                        &performance_counters::per_action_data_counter_creator,
+                        _1, HPX_MOVE(latency), _2),
+                    &performance_counters::per_action_data_counter_discoverer,
+#else
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(latency), _2),
+                    &performance_counters::locality_counter_discoverer,
+#endif
+                    "ns"});
+            }
+        }
+
+        performance_counters::install_counter_types(
+            parcel_latency_types.data(), parcel_latency_types.size());
+#endif
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void register_parcelhandler_counter_types(parcelset::parcelhandler& ph)
     {
@@ -597,6 +985,9 @@ namespace hpx::performance_counters {
         ph.enum_parcelports([&](std::string const& type) -> bool {
             register_parcelhandler_counter_types(ph, type);
             register_connection_cache_counter_types(ph, type);
+            register_receive_buffer_pool_counter_types(ph, type);
+            register_parcel_lane_counter_types(ph, type);
+            register_parcel_latency_counter_types(ph, type);
             return true;
         });
 
@@ -10,6 +10,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/errors.hpp>
@@ -34,6 +35,8 @@ namespace hpx::performance_counters::detail {
         bool reset) const;
     using threadpool_counter_func = std::int64_t (threads::thread_pool_base::*)(
         std::size_t num_thread, bool reset);
+    using pool_counter_func =
+        std::int64_t (threads::thread_pool_base::*)() const;
 
     naming::gid_type locality_pool_thread_counter_creator(
         threads::threadmanager* tm, threadmanager_counter_func total_func,
@@ -123,10 +126,11 @@ namespace hpx::performance_counters::detail {
         return naming::invalid_gid;
     }
 
-    // scheduler utilization counter creation function
-    naming::gid_type scheduler_utilization_counter_creator(
-        threads::threadmanager const* tm, counter_info const& info,
-        error_code& ec)
+    // locality/pool counter creation function (scheduler utilization, CPU
+    // quota)
+    naming::gid_type locality_pool_counter_creator(
+        threads::threadmanager const* tm, pool_counter_func pool_func,
+        counter_info const& info, error_code& ec)
     {
         // verify the validity of the counter instance name
         counter_path_elements paths;
@@ -136,11 +140,11 @@ namespace hpx::performance_counters::detail {
             return naming::invalid_gid;
         }
         // /scheduler{locality#%d/total}/utilization/instantaneous
-        // /scheduler{locality#%d/pool#%s/total}/utilization/instantaneous
+        // /scheduler{locality#%d/pool#%s}/utilization/instantaneous
         if (paths.parentinstance_is_basename_)
         {
             HPX_THROWS_IF(ec, hpx::error::bad_parameter,
-                "scheduler_utilization_creator",
+                "locality_pool_counter_creator",
                 "invalid counter instance parent name: {}",
                 paths.parentinstancename_);
             return naming::invalid_gid;
@@ -152,8 +156,7 @@ namespace hpx::performance_counters::detail {
         if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
         {
             // counter for default pool
-            hpx::function<std::int64_t()> f = hpx::bind_back(
-                &threads::thread_pool_base::get_scheduler_utilization, &pool);
+            hpx::function<std::int64_t()> f = hpx::bind_back(pool_func, &pool);
             return create_raw_counter(info, HPX_MOVE(f), ec);
         }
         else if (paths.instancename_ == "pool")
@@ -161,9 +164,8 @@ namespace hpx::performance_counters::detail {
             if (paths.instanceindex_ < 0)
             {
                 // counter for default pool
-                hpx::function<std::int64_t()> f = hpx::bind_back(
-                    &threads::thread_pool_base::get_scheduler_utilization,
-                    &pool);
+                hpx::function<std::int64_t()> f =
+                    hpx::bind_back(pool_func, &pool);
                 return create_raw_counter(info, HPX_MOVE(f), ec);
             }
             else if (static_cast<std::size_t>(paths.instanceindex_) <
@@ -173,15 +175,14 @@ namespace hpx::performance_counters::detail {
                 threads::thread_pool_base& pool_instance =
                     hpx::resource::get_thread_pool(paths.instanceindex_);
 
-                hpx::function<std::int64_t()> f = hpx::bind_back(
-                    &threads::thread_pool_base::get_scheduler_utilization,
-                    &pool_instance);
+                hpx::function<std::int64_t()> f =
+                    hpx::bind_back(pool_func, &pool_instance);
                 return create_raw_counter(info, HPX_MOVE(f), ec);
             }
         }
 
         HPX_THROWS_IF(ec, hpx::error::bad_parameter,
-            "scheduler_utilization_creator",
+            "locality_pool_counter_creator",
             "invalid counter instance name: {}", paths.instancename_);
         return naming::invalid_gid;
     }
@@ -347,6 +348,51 @@ namespace hpx::performance_counters::detail {
         return naming::invalid_gid;
     }
 #endif
+
+    ///////////////////////////////////////////////////////////////////////
+    // stack pool counter creation function
+    naming::gid_type stack_pool_counter_creator(
+        counter_info const& info, error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        namespace stack_pool = threads::coroutines::detail::stack_pool;
+
+        struct creator_data
+        {
+            char const* const countername;
+            hpx::function<std::int64_t(bool)> total_func;
+        };
+
+        creator_data data[] = {
+            // /threads{locality#%d/total}/count/stack-pool-hits
+            {"count/stack-pool-hits", &stack_pool::get_hit_count},
+            // /threads{locality#%d/total}/count/stack-pool-misses
+            {"count/stack-pool-misses", &stack_pool::get_miss_count},
+            // /threads{locality#%d/total}/stack-pool/resident
+            {"stack-pool/resident", &stack_pool::get_resident_bytes},
+        };
+
+        for (creator_data const& d : data)
+        {
+            if (paths.countername_ == d.countername)
+            {
+                return counter_creator(info, paths, d.total_func,
+                    hpx::function<std::int64_t(bool)>(), "", 0, ec);
+            }
+        }
+
+        HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+            "stack_pool_counter_creator", "invalid counter instance name: {}",
+            paths.instancename_);
+        return naming::invalid_gid;
+    }
 }    // namespace hpx::performance_counters::detail
 
 namespace hpx::performance_counters {
@@ -358,6 +404,8 @@ namespace hpx::performance_counters {
         create_counter_func counts_creator(
             hpx::bind_front(&detail::thread_counts_counter_creator));
 #endif
+        create_counter_func stack_pool_creator(
+            hpx::bind_front(&detail::stack_pool_counter_creator));
 
         generic_counter_type_data const counter_types[] = {
             // length of thread queue(s)
@@ -378,6 +426,16 @@ namespace hpx::performance_counters {
                     &threads::threadmanager::get_average_thread_wait_time,
                     &threads::thread_pool_base::get_average_thread_wait_time),
                 &locality_pool_thread_counter_discoverer, "ns"},
+            {"/threads/count/handoff-wakeups",
+                counter_type::monotonically_increasing,
+                "returns the number of HPX threads which were woken up by "
+                "another HPX thread and were run directly by the referenced "
+                "worker-thread, bypassing the scheduler queues",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_handoff_count,
+                    &threads::thread_pool_base::get_handoff_count),
+                &locality_pool_thread_counter_discoverer, ""},
             // average task wait time for queue(s)
             {"/threads/wait-time/staged", counter_type::average_timer,
                 "returns the average wait time of staged threads (task "
@@ -600,6 +658,110 @@ namespace hpx::performance_counters {
                     &tm, &threads::threadmanager::get_thread_count_staged,
                     &threads::thread_pool_base::get_thread_count_staged),
                 &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stack-pool-hits",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stacks which were "
+                "served from the stack pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-misses",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stacks which had to be "
+                "newly allocated as the stack pool was empty for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/stack-pool/resident", counter_type::raw,
+                "returns the number of bytes of HPX-thread stacks currently "
+                "held resident by the per-worker stack pool caches for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &locality_counter_discoverer, "bytes"},
+            {"/threads/count/deadline-missed",
+                counter_type::monotonically_increasing,
+                "returns the number of HPX-threads which have finished "
+                "executing after their deadline on the referenced "
+                "worker-thread (deadline aware schedulers only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_deadline_misses,
+                    &threads::thread_pool_base::get_num_deadline_misses),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-from-core-group",
+                counter_type::monotonically_increasing,
+                "returns the number of HPX-threads stolen by the referenced "
+                "worker-thread from queues sharing its cache "
+                "(shared_priority_queue_scheduler only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::get_num_stolen_from_core_group,
+                    &threads::thread_pool_base::get_num_stolen_from_core_group),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-from-numa-domain",
+                counter_type::monotonically_increasing,
+                "returns the number of HPX-threads stolen by the referenced "
+                "worker-thread from other queues on its NUMA domain "
+                "(shared_priority_queue_scheduler only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::get_num_stolen_from_numa_domain,
+                    &threads::thread_pool_base::
+                        get_num_stolen_from_numa_domain),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-from-remote",
+                counter_type::monotonically_increasing,
+                "returns the number of HPX-threads stolen by the referenced "
+                "worker-thread from queues on other NUMA domains "
+                "(shared_priority_queue_scheduler only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_stolen_from_remote,
+                    &threads::thread_pool_base::get_num_stolen_from_remote),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/steal-requests-satisfied",
+                counter_type::monotonically_increasing,
+                "returns the number of steal requests satisfied by the "
+                "referenced worker-thread (local_workrequesting_scheduler "
+                "only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::get_num_steal_requests_satisfied,
+                    &threads::thread_pool_base::
+                        get_num_steal_requests_satisfied),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/steal-requests-tasks-sent",
+                counter_type::monotonically_increasing,
+                "returns the number of tasks sent by the referenced "
+                "worker-thread in response to steal requests "
+                "(local_workrequesting_scheduler only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::get_num_steal_requests_tasks_sent,
+                    &threads::thread_pool_base::
+                        get_num_steal_requests_tasks_sent),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/cpu-quota-throttled",
+                counter_type::monotonically_increasing,
+                "returns the number of times the referenced worker-thread was "
+                "blocked because the CPU quota of its pool was exhausted",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_cpu_quota_throttled_count,
+                    &threads::thread_pool_base::get_cpu_quota_throttled_count),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/time/cpu-quota-throttled",
+                counter_type::monotonically_increasing,
+                "returns the time the referenced worker-thread was blocked "
+                "because the CPU quota of its pool was exhausted",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_cpu_quota_throttled_time,
+                    &threads::thread_pool_base::get_cpu_quota_throttled_time),
+                &locality_pool_thread_counter_discoverer, "ns"},
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
             {"/threads/count/stack-recycles",
                 counter_type::monotonically_increasing,
@@ -682,8 +844,15 @@ namespace hpx::performance_counters {
             {"/scheduler/utilization/instantaneous", counter_type::raw,
                 "returns the current scheduler utilization",
                 HPX_PERFORMANCE_COUNTER_V1,
-                hpx::bind_front(
-                    &detail::scheduler_utilization_counter_creator, &tm),
+                hpx::bind_front(&detail::locality_pool_counter_creator, &tm,
+                    &threads::thread_pool_base::get_scheduler_utilization),
+                &locality_pool_counter_discoverer, "%"},
+            // CPU quota
+            {"/scheduler/cpu-quota/instantaneous", counter_type::raw,
+                "returns the current CPU quota of the referenced thread pool",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_counter_creator, &tm,
+                    &threads::thread_pool_base::get_cpu_quota_percentage),
                 &locality_pool_counter_discoverer, "%"},
             // idle-loop count
             {"/threads/idle-loop-count/instantaneous", counter_type::raw,
@@ -39,6 +39,15 @@ char const* const locality_pool_thread_counter_names[] =
     "/threads/count/instantaneous/suspended",
     "/threads/count/instantaneous/terminated",
     "/threads/count/instantaneous/staged",
+    "/threads/count/deadline-missed",
+    "/threads/count/stolen-from-core-group",
+    "/threads/count/stolen-from-numa-domain",
+    "/threads/count/stolen-from-remote",
+    "/threads/count/steal-requests-satisfied",
+    "/threads/count/steal-requests-tasks-sent",
+    "/threads/count/cpu-quota-throttled",
+    "/threads/time/cpu-quota-throttled",
+    "/threads/count/handoff-wakeups",
 #ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
     "/threads/count/cumulative",
     "/threads/count/cumulative-phases",
@@ -83,7 +92,9 @@ char const* const locality_counter_names[] = {
     "/threads/count/stack-unbinds",
 #endif
 #endif
-    "/scheduler/utilization/instantaneous", nullptr};
+    "/threads/count/stack-pool-hits", "/threads/count/stack-pool-misses",
+    "/threads/stack-pool/resident", "/scheduler/utilization/instantaneous",
+    "/scheduler/cpu-quota/instantaneous", nullptr};
 
 ///////////////////////////////////////////////////////////////////////////////
 void test_all_locality_thread_counters(char const* const* counter_names,
@@ -112,6 +112,12 @@ namespace hpx::plugins {
                 "zero_copy_serialization_threshold = ${HPX_PARCEL_" + name_uc +
                 "_ZERO_COPY_SERIALIZATION_THRESHOLD:"
                 "$[hpx.parcel.zero_copy_serialization_threshold]}");
+            fillini.emplace_back(
+                "parallel_encoding_threshold = ${HPX_PARCEL_" + name_uc +
+                "_PARALLEL_ENCODING_THRESHOLD:"
+                "$[hpx.parcel.parallel_encoding_threshold]}");
+            fillini.emplace_back("stripe_size = ${HPX_PARCEL_" + name_uc +
+                "_STRIPE_SIZE:$[hpx.parcel.stripe_size]}");
             fillini.emplace_back("max_background_threads = ${HPX_PARCEL_" +
                 name_uc +
                 "_MAX_BACKGROUND_THREADS:"
@@ -120,6 +126,8 @@ namespace hpx::plugins {
                 name_uc +
                 "_ASYNC_SERIALIZATION:"
                 "$[hpx.parcel.async_serialization]}");
+            fillini.emplace_back("priority_lanes = ${HPX_PARCEL_" + name_uc +
+                "_PRIORITY_LANES:$[hpx.parcel.priority_lanes]}");
             fillini.emplace_back("priority = ${HPX_PARCEL_" + name_uc +
                 "_PRIORITY:" +
                 traits::plugin_config_data<Parcelport>::priority() + "}");
@@ -12,6 +12,7 @@
 #include <hpx/async_colocated/server/destroy_component.hpp>
 #include <hpx/components_base/component_type.hpp>
 #include <hpx/components_base/traits/component_config_data.hpp>
+#include <hpx/components_base/traits/component_supports_direct_addressing.hpp>
 #include <hpx/preprocessor/cat.hpp>
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
@@ -99,6 +100,9 @@ namespace hpx::components {
                 components::set_component_type<type_holder>(type);
             }
             components::enabled(type) = enabled;
+            components::supports_direct_addressing(type) =
+                traits::component_supports_direct_addressing<
+                    type_holder>::call();
             components::deleter(type) = &server::destroy<Component>;
         }
     };
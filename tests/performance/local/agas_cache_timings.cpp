@@ -14,8 +14,10 @@
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 
+#include <hpx/agas/detail/gva_cache.hpp>
 #include <hpx/cache/entries/lfu_entry.hpp>
 #include <hpx/cache/local_cache.hpp>
+#include <hpx/cache/lru_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/preprocessor/stringize.hpp>
@@ -30,6 +32,7 @@
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -126,6 +129,60 @@ typedef hpx::util::cache::local_cache<gva_cache_key, gva_entry_type,
     hpx::util::cache::statistics::local_full_statistics>
     gva_cache_type;
 
+// The cache used by the addressing service before it was sharded: an LRU
+// cache protected by a single lock which has to be acquired exclusively even
+// for lookups, as these update the LRU order.
+typedef hpx::util::cache::lru_cache<gva_cache_key, hpx::agas::gva,
+    hpx::util::cache::statistics::local_full_statistics>
+    lru_gva_cache_type;
+
+struct locked_lru_gva_cache
+{
+    explicit locked_lru_gva_cache(std::size_t cache_size)
+      : cache_(cache_size)
+    {
+    }
+
+    void insert(hpx::naming::gid_type const& id, hpx::agas::gva const& g)
+    {
+        std::unique_lock<hpx::shared_mutex> l(mtx_);
+        cache_.insert(gva_cache_key(id, 1), g);
+    }
+
+    bool get_entry(hpx::naming::gid_type const& id, hpx::agas::gva& g)
+    {
+        gva_cache_key idbase;
+        std::unique_lock<hpx::shared_mutex> l(mtx_);
+        return cache_.get_entry(gva_cache_key(id, 1), idbase, g);
+    }
+
+    hpx::shared_mutex mtx_;
+    lru_gva_cache_type cache_;
+};
+
+// The sharded cache used by the addressing service
+struct sharded_gva_cache
+{
+    explicit sharded_gva_cache(std::size_t cache_size)
+      : cache_(cache_size)
+    {
+    }
+
+    void insert(hpx::naming::gid_type const& id, hpx::agas::gva const& g)
+    {
+        hpx::agas::detail::gva_cache::key_type existing;
+        cache_.update_if(id, 1, g, existing);
+    }
+
+    bool get_entry(hpx::naming::gid_type const& id, hpx::agas::gva& g)
+    {
+        hpx::naming::gid_type idbase;
+        return cache_.get_entry(id, idbase, g);
+    }
+
+    hpx::agas::detail::gva_cache cache_;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 void calculate_histogram(
     std::string const& prefix, std::vector<std::uint64_t> const& timings)
@@ -230,6 +287,84 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Look up the given keys from an increasing number of concurrent tasks, return
+// the number of lookups per second
+template <typename Cache>
+double test_concurrent_get(Cache& cache,
+    std::vector<hpx::naming::gid_type> const& keys, std::size_t num_tasks,
+    std::size_t num_lookups)
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    hpx::chrono::high_resolution_timer t;
+
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([&cache, &keys, i, num_lookups]() {
+            std::size_t hits = 0;
+            std::size_t k = (i * 7919) % keys.size();
+            for (std::size_t j = 0; j != num_lookups; ++j)
+            {
+                hpx::agas::gva g;
+                if (cache.get_entry(keys[k], g))
+                    ++hits;
+                if (++k == keys.size())
+                    k = 0;
+            }
+            HPX_TEST_NEQ(hits, std::size_t(0));
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    return static_cast<double>(num_tasks * num_lookups) / t.elapsed();
+}
+
+template <typename Cache>
+std::vector<hpx::naming::gid_type> fill_cache(
+    Cache& cache, std::size_t num_entries)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::int32_t ct = to_int(hpx::components::component_enum_type::invalid);
+
+    std::vector<hpx::naming::gid_type> keys;
+    keys.reserve(num_entries);
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        keys.push_back(hpx::detail::get_next_id());
+        cache.insert(
+            keys.back(), hpx::agas::gva(locality, ct, 1, std::uint64_t(0), 0));
+    }
+    return keys;
+}
+
+void test_scaling(std::size_t cache_size, std::size_t num_entries,
+    std::size_t max_tasks, std::size_t num_lookups)
+{
+    locked_lru_gva_cache locked_cache(cache_size);
+    sharded_gva_cache sharded_cache(cache_size);
+
+    std::vector<hpx::naming::gid_type> const locked_keys =
+        fill_cache(locked_cache, num_entries);
+    std::vector<hpx::naming::gid_type> const sharded_keys =
+        fill_cache(sharded_cache, num_entries);
+
+    std::cout << "tasks, locked LRU [lookups/s], sharded [lookups/s]\n";
+    for (std::size_t num_tasks = 1; num_tasks <= max_tasks; num_tasks *= 2)
+    {
+        double const locked = test_concurrent_get(
+            locked_cache, locked_keys, num_tasks, num_lookups);
+        double const sharded = test_concurrent_get(
+            sharded_cache, sharded_keys, num_tasks, num_lookups);
+
+        std::cout << std::setw(5) << num_tasks << ", " << std::setw(12)
+                  << std::setprecision(4) << locked << ", " << std::setw(12)
+                  << sharded << std::endl;
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -241,6 +376,14 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (vm.count("num_entries"))
         num_entries = vm["num_entries"].as<std::size_t>();
 
+    std::size_t max_tasks = 2 * hpx::get_os_thread_count();
+    if (vm.count("max_tasks"))
+        max_tasks = vm["max_tasks"].as<std::size_t>();
+
+    std::size_t num_lookups = 100000;
+    if (vm.count("num_lookups"))
+        num_lookups = vm["num_lookups"].as<std::size_t>();
+
     gva_cache_type cache;
     cache.reserve(cache_size);
 
@@ -255,6 +398,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
 
+    if (num_entries != 0)
+    {
+        test_scaling(cache_size, num_entries, max_tasks, num_lookups);
+    }
+
     return hpx::finalize();
 }
 
@@ -268,7 +416,12 @@ int main(int argc, char* argv[])
         "initial cache size (default: " HPX_PP_STRINGIZE(
             HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")("num_entries,n",
         value<std::size_t>(),
-        "number of items to insert into cache (default: 1000)");
+        "number of items to insert into cache (default: 1000)")(
+        "max_tasks", value<std::size_t>(),
+        "maximal number of tasks looking up entries concurrently "
+        "(default: twice the number of cores)")("num_lookups",
+        value<std::size_t>(),
+        "number of lookups performed by each task (default: 100000)");
 
     // Initialize and run HPX
     hpx::init_params init_args;
@@ -0,0 +1,211 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the throughput of the bind, resolve, credit, and unbind operations
+// of the AGAS primary namespace while an increasing number of tasks access it
+// concurrently. Ranges of GIDs bound in bulk (as created by bulk component
+// creation) cross the blocks of GIDs the tables are partitioned by, those
+// are bound before and unbound after the operations on single GIDs.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/agas_base/server/primary_namespace.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/modules/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using primary_namespace = hpx::agas::server::primary_namespace;
+
+///////////////////////////////////////////////////////////////////////////////
+// run the given operation for the entries of each task concurrently, return
+// the number of operations per second
+template <typename F>
+double run_concurrently(std::vector<hpx::naming::gid_type> const& first_ids,
+    std::size_t num_entries, F const& f, std::uint64_t stride = 1)
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(first_ids.size());
+
+    hpx::chrono::high_resolution_timer t;
+
+    for (hpx::naming::gid_type const& first : first_ids)
+    {
+        tasks.push_back(hpx::async([&f, first, num_entries, stride]() {
+            hpx::naming::gid_type id = first;
+            for (std::size_t i = 0; i != num_entries; ++i, id += stride)
+            {
+                f(id, i);
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    double const elapsed = t.elapsed();
+    return static_cast<double>(first_ids.size() * num_entries) / elapsed;
+}
+
+double run_benchmark(primary_namespace& server, std::size_t num_tasks,
+    std::size_t num_entries, std::size_t bulk_count)
+{
+    hpx::naming::gid_type const locality = hpx::get_locality();
+    std::int32_t const type =
+        to_int(hpx::components::component_enum_type::base_lco_with_value);
+
+    // every task operates on its own range of ids
+    std::vector<hpx::naming::gid_type> first_ids;
+    first_ids.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        first_ids.push_back(hpx::naming::detail::get_stripped_gid(
+            server.allocate(num_entries).first));
+    }
+
+    // every task binds num_bulk ranges of bulk_count ids each
+    std::size_t const num_bulk =
+        bulk_count != 0 ? (std::max)(num_entries / bulk_count, std::size_t(1)) :
+                          0;
+
+    std::vector<hpx::naming::gid_type> first_bulk_ids;
+    first_bulk_ids.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks && num_bulk != 0; ++i)
+    {
+        first_bulk_ids.push_back(hpx::naming::detail::get_stripped_gid(
+            server.allocate(num_bulk * bulk_count).first));
+    }
+
+    hpx::chrono::high_resolution_timer t;
+
+    double const bulk_bind = run_concurrently(
+        first_bulk_ids, num_bulk,
+        [&](hpx::naming::gid_type const& id, std::size_t i) {
+            hpx::agas::gva const g(
+                locality, type, bulk_count, static_cast<std::uint64_t>(i + 1));
+            HPX_TEST(server.bind_gid(g, id, locality));
+        },
+        bulk_count);
+
+    double const bind = run_concurrently(first_ids, num_entries,
+        [&](hpx::naming::gid_type const& id, std::size_t i) {
+            hpx::agas::gva const g(
+                locality, type, 1, static_cast<std::uint64_t>(i + 1));
+            HPX_TEST(server.bind_gid(g, id, locality));
+        });
+
+    double const resolve = run_concurrently(first_ids, num_entries,
+        [&](hpx::naming::gid_type const& id, std::size_t i) {
+            primary_namespace::resolved_type const r = server.resolve_gid(id);
+            HPX_TEST_EQ(hpx::get<0>(r), id);
+            HPX_TEST(hpx::get<1>(r).lva() ==
+                reinterpret_cast<void*>(static_cast<std::uint64_t>(i + 1)));
+        });
+
+    // the credits are given back right away, thus no object is destroyed
+    double const credit = 2 *
+        run_concurrently(first_ids, num_entries,
+            [&](hpx::naming::gid_type const& id, std::size_t) {
+                server.increment_credit(16, id, id);
+
+                std::vector<hpx::tuple<std::int64_t, hpx::naming::gid_type,
+                    hpx::naming::gid_type>>
+                    requests;
+                requests.emplace_back(-16, id, id);
+                server.decrement_credit(requests);
+            });
+
+    double const unbind = run_concurrently(first_ids, num_entries,
+        [&](hpx::naming::gid_type const& id, std::size_t) {
+            HPX_TEST(server.unbind_gid(1, id));
+        });
+
+    double const bulk_unbind = run_concurrently(
+        first_bulk_ids, num_bulk,
+        [&](hpx::naming::gid_type const& id, std::size_t) {
+            HPX_TEST(server.unbind_gid(bulk_count, id));
+        },
+        bulk_count);
+
+    double const elapsed = t.elapsed();
+
+    std::cout << std::setw(6) << num_tasks << ", " << std::setw(12)
+              << static_cast<std::uint64_t>(bind) << ", " << std::setw(12)
+              << static_cast<std::uint64_t>(resolve) << ", " << std::setw(12)
+              << static_cast<std::uint64_t>(credit) << ", " << std::setw(12)
+              << static_cast<std::uint64_t>(unbind) << ", " << std::setw(12)
+              << static_cast<std::uint64_t>(bulk_bind) << ", "
+              << std::setw(12) << static_cast<std::uint64_t>(bulk_unbind)
+              << std::endl;
+
+    return elapsed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_entries = vm["num_entries"].as<std::size_t>();
+    std::size_t const bulk_count = vm["bulk_count"].as<std::size_t>();
+
+    std::size_t max_tasks = hpx::get_os_thread_count();
+    if (vm.count("max_tasks"))
+        max_tasks = vm["max_tasks"].as<std::size_t>();
+
+    primary_namespace server;
+    server.set_local_locality(hpx::get_locality());
+
+    std::cout << " tasks,   bind [1/s], resolve [1/s],  credit [1/s], "
+                 " unbind [1/s],   bulk [1/s], unbulk [1/s]"
+              << std::endl;
+
+    double elapsed = 0.0;
+    for (std::size_t num_tasks = 1; num_tasks <= max_tasks; num_tasks *= 2)
+    {
+        elapsed += run_benchmark(server, num_tasks, num_entries, bulk_count);
+    }
+
+    hpx::util::print_cdash_timing("AGASPrimaryNamespace", elapsed);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("num_entries,n", value<std::size_t>()->default_value(100000),
+         "number of ids each of the tasks operates on (default: 100000)")
+        ("bulk_count", value<std::size_t>()->default_value(64),
+         "number of ids in each of the ranges bound in bulk, 0 disables "
+         "binding ranges in bulk (default: 64)")
+        ("max_tasks", value<std::size_t>(),
+         "maximal number of concurrent tasks (default: number of cores)")
+        ;
+    // clang-format on
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
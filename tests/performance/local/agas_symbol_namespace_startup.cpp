@@ -0,0 +1,173 @@
+//  Copyright (c) 2024 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the throughput of the AGAS symbol namespace while registering a
+// large number of names (as done by applications registering their components
+// during startup), resolving them, and querying them using patterns.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/agas_base/server/symbol_namespace.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/modules/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using symbol_namespace = hpx::agas::server::symbol_namespace;
+
+///////////////////////////////////////////////////////////////////////////////
+// the names are grouped by the (simulated) locality registering them
+std::string make_name(std::size_t group, std::size_t i)
+{
+    return "/benchmark/" + std::to_string(group) + "/component#" +
+        std::to_string(i);
+}
+
+void print_rate(char const* what, std::size_t count, double elapsed)
+{
+    std::cout << std::setw(24) << what << ": " << std::setw(12)
+              << static_cast<std::uint64_t>(
+                     static_cast<double>(count) / elapsed)
+              << " [1/s]" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_names = vm["num_names"].as<std::size_t>();
+    std::size_t const num_groups = vm["num_groups"].as<std::size_t>();
+    std::size_t const num_queries = vm["num_queries"].as<std::size_t>();
+
+    std::size_t const names_per_group = (num_names + num_groups - 1) /
+        num_groups;
+
+    std::vector<std::string> names;
+    names.reserve(num_names);
+    for (std::size_t i = 0; i != num_names; ++i)
+    {
+        names.push_back(make_name(i / names_per_group, i % names_per_group));
+    }
+
+    // the ids registered below do not carry any credits, thus neither
+    // resolving nor iterating over them requires splitting credits
+    auto const make_gid = [](std::size_t i) {
+        return hpx::naming::gid_type(
+            0x1000000000000000ull, static_cast<std::uint64_t>(i + 1));
+    };
+
+    symbol_namespace server;
+
+    hpx::chrono::high_resolution_timer t;
+
+    hpx::chrono::high_resolution_timer t_bind;
+    for (std::size_t i = 0; i != num_names; ++i)
+    {
+        HPX_TEST(server.bind(names[i], make_gid(i)));
+    }
+    double const bind = t_bind.elapsed();
+
+    hpx::chrono::high_resolution_timer t_resolve;
+    for (std::size_t i = 0; i != num_names; ++i)
+    {
+        std::size_t const n = (i * 7919) % num_names;
+        HPX_TEST_EQ(server.resolve(names[n]), make_gid(n));
+    }
+    double const resolve = t_resolve.elapsed();
+
+    // query the names registered by a single group
+    hpx::chrono::high_resolution_timer t_prefix;
+    std::size_t found_prefix = 0;
+    for (std::size_t i = 0; i != num_queries; ++i)
+    {
+        std::string const pattern =
+            "/benchmark/" + std::to_string(i % num_groups) + "/*";
+        found_prefix += server.iterate(pattern).size();
+    }
+    double const prefix = t_prefix.elapsed();
+
+    // query a handful of names of a single group using a wildcard pattern
+    hpx::chrono::high_resolution_timer t_pattern;
+    std::size_t found_pattern = 0;
+    for (std::size_t i = 0; i != num_queries; ++i)
+    {
+        std::string const pattern = "/benchmark/" +
+            std::to_string(i % num_groups) + "/component#1?";
+        found_pattern += server.iterate(pattern).size();
+    }
+    double const pattern = t_pattern.elapsed();
+
+    // exact names are looked up without building a regular expression
+    hpx::chrono::high_resolution_timer t_exact;
+    std::size_t found_exact = 0;
+    for (std::size_t i = 0; i != num_queries; ++i)
+    {
+        found_exact += server.iterate(names[(i * 7919) % num_names]).size();
+    }
+    double const exact = t_exact.elapsed();
+    HPX_TEST_EQ(found_exact, num_queries);
+
+    hpx::chrono::high_resolution_timer t_unbind;
+    for (std::size_t i = 0; i != num_names; ++i)
+    {
+        HPX_TEST_EQ(server.unbind(names[i]), make_gid(i));
+    }
+    double const unbind = t_unbind.elapsed();
+
+    double const elapsed = t.elapsed();
+
+    std::cout << "names: " << num_names << ", groups: " << num_groups
+              << ", queries: " << num_queries << std::endl;
+    print_rate("bind", num_names, bind);
+    print_rate("resolve", num_names, resolve);
+    print_rate("iterate (prefix)", num_queries, prefix);
+    print_rate("iterate (pattern)", num_queries, pattern);
+    print_rate("iterate (exact name)", num_queries, exact);
+    print_rate("unbind", num_names, unbind);
+    std::cout << "entries found (prefix/pattern): " << found_prefix << "/"
+              << found_pattern << std::endl;
+
+    hpx::util::print_cdash_timing("AGASSymbolNamespaceStartup", elapsed);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("num_names,n", value<std::size_t>()->default_value(1000000),
+         "number of names to register (default: 1000000)")
+        ("num_groups", value<std::size_t>()->default_value(1000),
+         "number of groups sharing a common prefix (default: 1000)")
+        ("num_queries", value<std::size_t>()->default_value(1000),
+         "number of pattern queries to run (default: 1000)")
+        ;
+    // clang-format on
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif